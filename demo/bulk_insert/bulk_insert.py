@@ -23,6 +23,7 @@ class Type:
     BOOL = 1
     NUMERIC = 2
     STRING = 3
+    LONG = 4
 
 # User-configurable thresholds for when to send queries to Redis
 class Configs(object):
@@ -277,6 +278,14 @@ def prop_to_binary(prop_str):
         # An empty field indicates a NULL property
         return struct.pack(format_str, Type.NULL)
 
+    # If field can be cast to an integer, store it as a 64-bit integer
+    try:
+        long_prop = int(prop_str)
+        if -2**63 <= long_prop < 2**63:
+            return struct.pack(format_str + "q", Type.LONG, long_prop)
+    except:
+        pass
+
     # If field can be cast to a float, allow it
     try:
         numeric_prop = float(prop_str)
@@ -5314,6 +5314,16 @@ GrB_Info GxB_Matrix_Pending
     bool *pending                   // are there any pending operations
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_MemoryUsage:  Reports number of bytes allocated by matrix
+//------------------------------------------------------------------------------
+GrB_Info GxB_Matrix_MemoryUsage
+(
+    GrB_Matrix A,                   // matrix to query
+    size_t *size,                   // number of bytes allocated by A
+    bool *is_hyper                  // optional, true if A is hypersparse
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_MatrixTupleIter:  Iterates over all none zero values of a matrix
 //------------------------------------------------------------------------------
@@ -5344,6 +5354,14 @@ GrB_Info GxB_MatrixTupleIter_iterate_column
     GrB_Index colIdx        // column index to iterate over
 ) ;
 
+// Iterate over columns startColIdx up to (not including) endColIdx
+GrB_Info GxB_MatrixTupleIter_iterate_range
+(
+    GxB_MatrixTupleIter *iter,       // iterator to use
+    GrB_Index startColIdx,  // first column to iterate over
+    GrB_Index endColIdx     // iteration stops at this column
+) ;
+
 // Advance iterator to the next none zero value
 GrB_Info GxB_MatrixTupleIter_next
 (
@@ -0,0 +1,34 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_MemoryUsage: reports memory allocated by a matrix
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_MemoryUsage     // memory allocated by matrix
+(
+    GrB_Matrix A,           // matrix to query
+    size_t *size,           // number of bytes allocated by A
+    bool *is_hyper          // optional, true if A is hypersparse
+)
+{
+    GB_WHERE ("GxB_Matrix_MemoryUsage (A)") ;
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (size) ;
+
+    // header, vector pointers A->p, hyperlist A->h, indices A->i and values A->x
+    size_t s = sizeof (struct GB_Matrix_opaque) ;
+    if (A->p != NULL) s += (A->plen + 1) * sizeof (int64_t) ;
+    if (A->h != NULL) s += A->plen * sizeof (int64_t) ;
+    if (A->i != NULL) s += A->nzmax * sizeof (int64_t) ;
+    if (A->x != NULL) s += A->nzmax * A->type->size ;
+
+    // pending tuples
+    s += A->max_n_pending * (2 * sizeof (int64_t) + A->type_pending_size) ;
+
+    (*size) = s ;
+    if (is_hyper != NULL) (*is_hyper) = A->is_hyper ;
+    return (GrB_SUCCESS) ;
+}
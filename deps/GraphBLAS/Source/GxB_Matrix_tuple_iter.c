@@ -2,6 +2,10 @@
 // GxB_MatrixTupleIter: Iterates over matrix none zero values
 //------------------------------------------------------------------------------
 
+// Both standard and hypersparse matrices are supported, the iterator
+// walks over the matrix vectors, col_idx is the index of the current
+// vector, which for a hypersparse matrix maps to column A->h [col_idx].
+
 #include "GB.h"
 
 // Create a new iterator
@@ -42,9 +46,68 @@ GrB_Info GxB_MatrixTupleIter_iterate_column
         return (GB_ERROR (GrB_INVALID_INDEX, (GB_LOG, "Column index out of range"))) ;
     }
 
-    iter->nvals = iter->A->p[colIdx+1] ;
-    iter->nnz_idx = iter->A->p[colIdx] ;
-    iter->col_idx = colIdx ;
+    GrB_Matrix A = iter->A ;
+    int64_t pstart ;
+    int64_t pend ;
+    int64_t k = 0 ;
+    if (GB_lookup (A->is_hyper, A->h, A->p, &k, A->nvec-1, colIdx, &pstart,
+        &pend))
+    {
+        iter->nvals = pend ;
+        iter->nnz_idx = pstart ;
+        iter->col_idx = (A->is_hyper) ? k : colIdx ;
+    }
+    else
+    {
+        // Column is empty.
+        iter->nvals = 0 ;
+        iter->nnz_idx = 0 ;
+        iter->col_idx = 0 ;
+    }
+    iter->p = 0 ;
+    return (GrB_SUCCESS) ;
+}
+
+// Update iter to scan a range of columns
+GrB_Info GxB_MatrixTupleIter_iterate_range
+(
+    GxB_MatrixTupleIter *iter,
+    GrB_Index startColIdx,
+    GrB_Index endColIdx
+)
+{
+    GB_WHERE ("GxB_MatrixTupleIter_iterate_range (iter, startColIdx, endColIdx)") ;
+    GB_RETURN_IF_NULL (iter) ;
+
+    GrB_Matrix A = iter->A ;
+    if (endColIdx > iter->ncols) endColIdx = iter->ncols ;
+    if (startColIdx > endColIdx) startColIdx = endColIdx ;
+
+    // Locate the first vector of each range boundary.
+    int64_t kstart = startColIdx ;
+    int64_t kend = endColIdx ;
+    if (A->is_hyper)
+    {
+        const int64_t *Ah = A->h ;
+        int64_t lo = 0, hi = A->nvec ;
+        while (lo < hi)
+        {
+            int64_t mid = (lo + hi) / 2 ;
+            if (Ah [mid] < (int64_t) startColIdx) lo = mid + 1 ; else hi = mid ;
+        }
+        kstart = lo ;
+        hi = A->nvec ;
+        while (lo < hi)
+        {
+            int64_t mid = (lo + hi) / 2 ;
+            if (Ah [mid] < (int64_t) endColIdx) lo = mid + 1 ; else hi = mid ;
+        }
+        kend = lo ;
+    }
+
+    iter->nnz_idx = A->p [kstart] ;
+    iter->nvals = A->p [kend] ;
+    iter->col_idx = kstart ;
     iter->p = 0 ;
     return (GrB_SUCCESS) ;
 }
@@ -81,14 +144,16 @@ GrB_Info GxB_MatrixTupleIter_next
     //--------------------------------------------------------------------------
 
     const int64_t *Ap = A->p ;
+    const int64_t *Ah = A->h ;
+    int64_t nvec = A->nvec ;
     int64_t j = iter->col_idx ;
 
-    for (; j < iter->ncols ; j++)
+    for (; j < nvec ; j++)
     {
         int64_t p = iter->p + Ap [j] ;
         if (p < Ap [j+1]) {
             iter->p++ ;
-            if (col) *col = j ;
+            if (col) *col = (A->is_hyper) ? Ah [j] : j ;
             break ;
         }
         iter->p = 0 ;
@@ -1,3 +1,4 @@
+#include <stdlib.h>
 #include "./GxB_Delete.h"
 
 GrB_Info GxB_Matrix_Delete
@@ -23,3 +24,42 @@ GrB_Info GxB_Matrix_Delete
     GrB_Matrix_free(&Z);
     return info;
 }
+
+GrB_Info GxB_Matrix_DeleteTuples
+(
+    GrB_Matrix M,
+    const GrB_Index *rows,
+    const GrB_Index *cols,
+    GrB_Index n
+)
+{
+    if (n == 0) return GrB_SUCCESS ;
+
+    GrB_Info info ;
+    GrB_Index nrows ;
+    GrB_Index ncols ;
+    GrB_Matrix_nrows (&nrows, M) ;
+    GrB_Matrix_ncols (&ncols, M) ;
+
+    // Mask marking entries to clear.
+    GrB_Matrix mask ;
+    GrB_Matrix_new (&mask, GrB_BOOL, nrows, ncols) ;
+    bool *X = malloc (sizeof (bool) * n) ;
+    for (GrB_Index i = 0 ; i < n ; i++) X [i] = true ;
+    info = GrB_Matrix_build_BOOL (mask, rows, cols, X, n, GrB_LOR) ;
+    free (X) ;
+
+    if (info == GrB_SUCCESS)
+    {
+        // Assigning an empty matrix under the mask removes masked entries,
+        // entries outside of the mask are left untouched.
+        GrB_Matrix Z ;
+        GrB_Matrix_new (&Z, GrB_BOOL, nrows, ncols) ;
+        info = GrB_Matrix_assign (M, mask, GrB_NULL, Z, GrB_ALL, nrows,
+                                  GrB_ALL, ncols, GrB_NULL) ;
+        GrB_Matrix_free (&Z) ;
+    }
+
+    GrB_Matrix_free (&mask) ;
+    return info ;
+}
@@ -20,4 +20,14 @@ GrB_Info GxB_Matrix_Delete
     GrB_Index col
 ) ;
 
+/* Clears entries at positions M[rows[i],cols[i]] for i in [0, n)
+ * using a single masked assignment, duplicate positions are allowed. */
+GrB_Info GxB_Matrix_DeleteTuples
+(
+    GrB_Matrix M,
+    const GrB_Index *rows,
+    const GrB_Index *cols,
+    GrB_Index n
+) ;
+
 #endif
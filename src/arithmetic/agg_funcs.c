@@ -13,6 +13,7 @@
 #include "../util/qsort.h"
 #include <assert.h>
 #include <math.h>
+#include <string.h>
 
 #define ISLT(a,b) ((*a) < (*b))
 
@@ -50,12 +51,20 @@ int __agg_sumReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_sumCombine(AggCtx *ctx, AggCtx *other) {
+    __agg_sumCtx *ac = Agg_FuncCtx(ctx);
+    __agg_sumCtx *oc = Agg_FuncCtx(other);
+    ac->num += oc->num;
+    ac->total += oc->total;
+    return AGG_OK;
+}
+
 AggCtx* Agg_SumFunc() {
     __agg_sumCtx *ac = malloc(sizeof(__agg_sumCtx));
     ac->num = 0;
     ac->total = 0;
     
-    return Agg_Reduce(ac, __agg_sumStep, __agg_sumReduceNext);
+    return Agg_Reduce(ac, __agg_sumStep, __agg_sumReduceNext, __agg_sumCombine);
 }
 
 //------------------------------------------------------------------------
@@ -100,12 +109,20 @@ int __agg_avgReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_avgCombine(AggCtx *ctx, AggCtx *other) {
+    __agg_avgCtx *ac = Agg_FuncCtx(ctx);
+    __agg_avgCtx *oc = Agg_FuncCtx(other);
+    ac->count += oc->count;
+    ac->total += oc->total;
+    return AGG_OK;
+}
+
 AggCtx* Agg_AvgFunc() {
     __agg_avgCtx *ac = malloc(sizeof(__agg_avgCtx));
     ac->count = 0;
     ac->total = 0;
     
-    return Agg_Reduce(ac, __agg_avgStep, __agg_avgReduceNext);
+    return Agg_Reduce(ac, __agg_avgStep, __agg_avgReduceNext, __agg_avgCombine);
 }
 
 //------------------------------------------------------------------------
@@ -141,12 +158,18 @@ int __agg_maxReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_maxCombine(AggCtx *ctx, AggCtx *other) {
+    __agg_maxCtx *oc = Agg_FuncCtx(other);
+    if(!oc->init) return AGG_OK;
+    return __agg_maxStep(ctx, &oc->max, 1);
+}
+
 AggCtx* Agg_MaxFunc() {
     __agg_maxCtx *ac = malloc(sizeof(__agg_maxCtx));
     // ac->max = SI_DoubleVal(DBL_MIN);
     ac->init = false;
     
-    return Agg_Reduce(ac, __agg_maxStep, __agg_maxReduceNext);
+    return Agg_Reduce(ac, __agg_maxStep, __agg_maxReduceNext, __agg_maxCombine);
 }
 
 //------------------------------------------------------------------------
@@ -182,12 +205,18 @@ int __agg_minReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_minCombine(AggCtx *ctx, AggCtx *other) {
+    __agg_minCtx *oc = Agg_FuncCtx(other);
+    if(!oc->init) return AGG_OK;
+    return __agg_minStep(ctx, &oc->min, 1);
+}
+
 AggCtx* Agg_MinFunc() {
     __agg_minCtx *ac = malloc(sizeof(__agg_minCtx));
     // ac->min = SI_DoubleVal(DBL_MAX);
     ac->init = false;
     
-    return Agg_Reduce(ac, __agg_minStep, __agg_minReduceNext);
+    return Agg_Reduce(ac, __agg_minStep, __agg_minReduceNext, __agg_minCombine);
 }
 
 //------------------------------------------------------------------------
@@ -211,11 +240,18 @@ int __agg_countReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_countCombine(AggCtx *ctx, AggCtx *other) {
+    __agg_countCtx *ac = Agg_FuncCtx(ctx);
+    __agg_countCtx *oc = Agg_FuncCtx(other);
+    ac->count += oc->count;
+    return AGG_OK;
+}
+
 AggCtx* Agg_CountFunc() {
     __agg_countCtx *ac = malloc(sizeof(__agg_countCtx));
     ac->count = 0;
     
-    return Agg_Reduce(ac, __agg_countStep, __agg_countReduceNext);
+    return Agg_Reduce(ac, __agg_countStep, __agg_countReduceNext, __agg_countCombine);
 }
 
 //------------------------------------------------------------------------
@@ -268,6 +304,25 @@ int __agg_percStep(AggCtx *ctx, SIValue *argv, int argc) {
     return AGG_OK;
 }
 
+// Appends other's values, which are released.
+int __agg_percCombine(AggCtx *ctx, AggCtx *other) {
+    __agg_percCtx *ac = Agg_FuncCtx(ctx);
+    __agg_percCtx *oc = Agg_FuncCtx(other);
+    if (ac->percentile < 0) ac->percentile = oc->percentile;
+
+    if (ac->count + oc->count > ac->values_allocated) {
+        ac->values_allocated = ac->count + oc->count;
+        ac->values = realloc(ac->values, sizeof(double) * ac->values_allocated);
+    }
+    memcpy(ac->values + ac->count, oc->values, sizeof(double) * oc->count);
+    ac->count += oc->count;
+
+    free(oc->values);
+    oc->values = NULL;
+    oc->count = 0;
+    return AGG_OK;
+}
+
 int __agg_percDiscReduceNext(AggCtx *ctx) {
     __agg_percCtx *ac = Agg_FuncCtx(ctx);
 
@@ -324,7 +379,7 @@ AggCtx* Agg_PercDiscFunc() {
     ac->values_allocated = 1024;
     // Percentile will be updated by the first call to Step
     ac->percentile = -1;
-    return Agg_Reduce(ac, __agg_percStep, __agg_percDiscReduceNext);
+    return Agg_Reduce(ac, __agg_percStep, __agg_percDiscReduceNext, __agg_percCombine);
 }
 
 AggCtx* Agg_PercContFunc() {
@@ -334,7 +389,7 @@ AggCtx* Agg_PercContFunc() {
     ac->values_allocated = 1024;
     // Percentile will be updated by the first call to Step
     ac->percentile = -1;
-    return Agg_Reduce(ac, __agg_percStep, __agg_percContReduceNext);
+    return Agg_Reduce(ac, __agg_percStep, __agg_percContReduceNext, __agg_percCombine);
 }
 
 //------------------------------------------------------------------------
@@ -398,6 +453,25 @@ int __agg_StdevReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+// Appends other's values, which are released.
+int __agg_StdevCombine(AggCtx *ctx, AggCtx *other) {
+    __agg_stdevCtx *ac = Agg_FuncCtx(ctx);
+    __agg_stdevCtx *oc = Agg_FuncCtx(other);
+
+    if (ac->count + oc->count > ac->values_allocated) {
+        ac->values_allocated = ac->count + oc->count;
+        ac->values = realloc(ac->values, sizeof(double) * ac->values_allocated);
+    }
+    memcpy(ac->values + ac->count, oc->values, sizeof(double) * oc->count);
+    ac->count += oc->count;
+    ac->total += oc->total;
+
+    free(oc->values);
+    oc->values = NULL;
+    oc->count = 0;
+    return AGG_OK;
+}
+
 AggCtx* Agg_StdevFunc() {
     __agg_stdevCtx *ac = malloc(sizeof(__agg_stdevCtx));
     ac->is_sampled = 1;
@@ -405,7 +479,7 @@ AggCtx* Agg_StdevFunc() {
     ac->total = 0;
     ac->values = malloc(1024 * sizeof(double));
     ac->values_allocated = 1024;
-    return Agg_Reduce(ac, __agg_StdevStep, __agg_StdevReduceNext);
+    return Agg_Reduce(ac, __agg_StdevStep, __agg_StdevReduceNext, __agg_StdevCombine);
 }
 
 // StdevP is identical to Stdev save for an altered value we can check for with a bool
@@ -7,10 +7,11 @@
 
 #include "aggregate.h"
 
-AggCtx *Agg_Reduce(void *ctx, StepFunc f, ReduceFunc reduce) {
+AggCtx *Agg_Reduce(void *ctx, StepFunc f, ReduceFunc reduce, CombineFunc combine) {
   AggCtx *ac = Agg_NewCtx(ctx);
   ac->Step = f;
   ac->ReduceNext = reduce;
+  ac->Combine = combine;
   return ac;
 }
 
@@ -21,6 +22,7 @@ AggCtx *Agg_NewCtx(void *fctx) {
     ac->result = SI_NullVal();
     ac->Step = NULL;
     ac->ReduceNext = NULL;
+    ac->Combine = NULL;
     return ac;
 }
 
@@ -46,6 +48,13 @@ int Agg_Finalize(AggCtx *ctx) {
   return ctx->ReduceNext(ctx);
 }
 
+int Agg_Combine(AggCtx *ctx, AggCtx *other) {
+  // Keep the first error encountered.
+  if (!ctx->err) ctx->err = other->err;
+  other->err = NULL;
+  return ctx->Combine(ctx, other);
+}
+
 inline void *Agg_FuncCtx(AggCtx *ctx) { return ctx->fctx; }
 
 inline void Agg_SetResult(struct AggCtx *ctx, SIValue v) {
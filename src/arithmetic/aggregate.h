@@ -25,8 +25,9 @@
 
 typedef int (*StepFunc)(AggCtx *ctx, SIValue *argv, int argc);
 typedef int (*ReduceFunc)(AggCtx *ctx);
+typedef int (*CombineFunc)(AggCtx *ctx, AggCtx *other);
 
-AggCtx *Agg_Reduce(void *ctx, StepFunc f, ReduceFunc reduce);
+AggCtx *Agg_Reduce(void *ctx, StepFunc f, ReduceFunc reduce, CombineFunc combine);
 AggCtx *Agg_NewCtx(void *fctx);
 void AggCtx_Free(AggCtx *ctx);
 int Agg_SetError(AggCtx *ctx, AggError *err);
@@ -36,4 +37,9 @@ void Agg_SetResult(AggCtx *ctx, SIValue v);
 int Agg_Step(AggCtx *ctx, SIValue *argv, int argc);
 int Agg_Finalize(AggCtx *ctx);
 
+/* Merges the partial aggregation state of other into ctx,
+ * both contexts must be of the same function and not yet finalized.
+ * other is left in an unspecified state and should only be freed. */
+int Agg_Combine(AggCtx *ctx, AggCtx *other);
+
 #endif
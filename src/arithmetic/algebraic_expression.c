@@ -7,17 +7,37 @@
 
 #include "algebraic_expression.h"
 #include "../util/arr.h"
+#include "../util/arena.h"
 #include "../util/rmalloc.h"
 #include <assert.h>
+#include <pthread.h>
+#include <string.h>
+
+// Number of multiplications after which an expression's product is cached.
+#define AE_CACHE_MIN_EXECUTIONS 4
+
+static GxB_SelectOp _rowMaskOp = NULL;
+static pthread_once_t _rowMaskOnce = PTHREAD_ONCE_INIT;
 
 AlgebraicExpression *_AE_MUL(size_t operand_cap) {
     AlgebraicExpression *ae = malloc(sizeof(AlgebraicExpression));
     ae->op = AL_EXP_MUL;
     ae->operand_cap = operand_cap;
     ae->operand_count = 0;
-    ae->operands = malloc(sizeof(AlgebraicExpressionOperand) * ae->operand_cap);
+    // Operands are allocated from current arena, if set.
+    ae->operands = Arena_Alloc(Arena_GetCurrent(), sizeof(AlgebraicExpressionOperand) * ae->operand_cap);
     ae->edge = NULL;
     ae->edgeLength = NULL;
+    ae->desc = NULL;
+    ae->rowMask = NULL;
+    ae->rowMaskRows = 0;
+    ae->rowMaskVersion = 0;
+    ae->product = NULL;
+    ae->executions = 0;
+    ae->cacheDisabled = false;
+    ae->graph = NULL;
+    ae->pathCache = NULL;
+    ae->cacheEntry = NULL;
     return ae;
 }
 
@@ -229,8 +249,9 @@ AlgebraicExpression **_AlgebraicExpression_Intermidate_Expressions(AlgebraicExpr
             iexp->operands[iexp->operand_count++] = exp->operands[operandIdx++];
         }
 
-        /* If intermidate node is referenced, create a new algebraic expression. */
-        if(_intermidate_node(dest) && _referred_node(dest, ref_entities)) {
+        /* If intermidate node is referenced, create a new algebraic expression,
+         * unless pattern ends at it, e.g. closing a cycle. */
+        if(operandIdx < exp->operand_count && _intermidate_node(dest) && _referred_node(dest, ref_entities)) {
             // Finalize current expression.
             iexp->dest_node = dest;
 
@@ -248,6 +269,57 @@ AlgebraicExpression **_AlgebraicExpression_Intermidate_Expressions(AlgebraicExpr
     return expressions;
 }
 
+/* Select function, keeps entry (i,j) if row i is set
+ * in the row mask of the expression passed as thunk. */
+static bool _AlgebraicExpression_RowInMask(GrB_Index i, GrB_Index j, GrB_Index nrows,
+                                           GrB_Index ncols, const void *x, const void *thunk) {
+    const AlgebraicExpression *ae = thunk;
+    if(i >= ae->rowMaskRows) return false;
+    return (ae->rowMask[i >> 6] >> (i & 63)) & 1;
+}
+
+static void _AlgebraicExpression_CreateRowMaskOp(void) {
+    GxB_SelectOp_new(&_rowMaskOp, _AlgebraicExpression_RowInMask, NULL);
+}
+
+/* Computes a bitmap of the rows present in diagonal label matrix L,
+ * the bitmap is kept until either the graph or C's dimension changes,
+ * expressions unaware of their graph rebuild it on every execution. */
+static void _AlgebraicExpression_BuildRowMask(AlgebraicExpression *ae, GrB_Matrix L, GrB_Index nrows) {
+    bool tracked = (ae->graph != NULL);
+    uint64_t version = tracked ? Graph_Version(ae->graph) : 0;
+    if(tracked && ae->rowMask && ae->rowMaskRows == nrows && ae->rowMaskVersion == version) return;
+
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, L);
+
+    size_t words = (nrows + 63) / 64;
+    if(ae->rowMaskRows != nrows) {
+        ae->rowMask = rm_realloc(ae->rowMask, sizeof(uint64_t) * words);
+    }
+    memset(ae->rowMask, 0, sizeof(uint64_t) * words);
+    ae->rowMaskRows = nrows;
+    ae->rowMaskVersion = version;
+
+    GrB_Index *rows = rm_malloc(sizeof(GrB_Index) * nvals);
+    GrB_Matrix_extractTuples_BOOL(rows, NULL, NULL, &nvals, L);
+    for(GrB_Index k = 0; k < nvals; k++) {
+        GrB_Index i = rows[k];
+        if(i < nrows) ae->rowMask[i >> 6] |= ((uint64_t)1 << (i & 63));
+    }
+    rm_free(rows);
+}
+
+/* Restricts C to rows present in diagonal label matrix L,
+ * equivalent to C = L*C without the cost of a multiplication. */
+static void _AlgebraicExpression_RowMask(AlgebraicExpression *ae, GrB_Matrix C, GrB_Matrix L) {
+    pthread_once(&_rowMaskOnce, _AlgebraicExpression_CreateRowMaskOp);
+    GrB_Index nrows;
+    GrB_Matrix_nrows(&nrows, C);
+    _AlgebraicExpression_BuildRowMask(ae, L, nrows);
+    GxB_select(C, NULL, NULL, _rowMaskOp, C, ae, NULL);
+}
+
 static inline void _AlgebraicExpression_Execute_MUL(GrB_Matrix C, GrB_Matrix A, GrB_Matrix B, GrB_Descriptor desc) {
     // Using our own compile-time, user defined semiring see rg_structured_bool.m4
     // A,B,C must be boolean matrices.
@@ -276,16 +348,24 @@ void _AlgebraicExpression_ReverseOperandOrder(AlgebraicExpression *exp) {
     }
 }
 
+static void _AE_GrowOperands(AlgebraicExpression *ae) {
+    size_t old_size = sizeof(AlgebraicExpressionOperand) * ae->operand_cap;
+    ae->operand_cap += 4;
+    ae->operands = Arena_Realloc(Arena_GetCurrent(), ae->operands, old_size,
+                                 sizeof(AlgebraicExpressionOperand) * ae->operand_cap);
+}
+
 void AlgebraicExpression_AppendTerm(AlgebraicExpression *ae, GrB_Matrix m, bool transposeOp, bool freeOp) {
     assert(ae);    
     if(ae->operand_count+1 > ae->operand_cap) {
-        ae->operand_cap += 4;
-        ae->operands = realloc(ae->operands, sizeof(AlgebraicExpressionOperand) * ae->operand_cap);
+        _AE_GrowOperands(ae);
     }
 
     ae->operands[ae->operand_count].transpose = transposeOp;
     ae->operands[ae->operand_count].free = freeOp;
+    ae->operands[ae->operand_count].diagonal = false;
     ae->operands[ae->operand_count].operand = m;
+    ae->operands[ae->operand_count].transposed = NULL;
     ae->operand_count++;
 }
 
@@ -294,8 +374,7 @@ void AlgebraicExpression_PrependTerm(AlgebraicExpression *ae, GrB_Matrix m, bool
 
     ae->operand_count++;
     if(ae->operand_count+1 > ae->operand_cap) {
-        ae->operand_cap += 4;
-        ae->operands = realloc(ae->operands, sizeof(AlgebraicExpressionOperand) * ae->operand_cap);
+        _AE_GrowOperands(ae);
     }
 
     // TODO: might be optimized with memcpy.
@@ -306,7 +385,9 @@ void AlgebraicExpression_PrependTerm(AlgebraicExpression *ae, GrB_Matrix m, bool
 
     ae->operands[0].transpose = transposeOp;
     ae->operands[0].free = freeOp;
+    ae->operands[0].diagonal = false;
     ae->operands[0].operand = m;
+    ae->operands[0].transposed = NULL;
 }
 
 AlgebraicExpression **AlgebraicExpression_From_Query(const AST *ast, Vector *matchPattern, const QueryGraph *q, size_t *exp_count) {
@@ -340,7 +421,10 @@ AlgebraicExpression **AlgebraicExpression_From_Query(const AST *ast, Vector *mat
 
         if(exp->operand_count == 0) {
             exp->src_node = src;
-            if(src->mat) AlgebraicExpression_AppendTerm(exp, src->mat, false, false);
+            if(src->mat) {
+                AlgebraicExpression_AppendTerm(exp, src->mat, false, false);
+                exp->operands[exp->operand_count-1].diagonal = true;
+            }
         }
 
         // ()-[:A|:B.]->()
@@ -374,7 +458,10 @@ AlgebraicExpression **AlgebraicExpression_From_Query(const AST *ast, Vector *mat
             AlgebraicExpression_AppendTerm(exp, mat, transpose, freeMatrix);
         }
 
-        if(dest->mat) AlgebraicExpression_AppendTerm(exp, dest->mat, false, false);
+        if(dest->mat) {
+            AlgebraicExpression_AppendTerm(exp, dest->mat, false, false);
+            exp->operands[exp->operand_count-1].diagonal = true;
+        }
     }
 
     exp->dest_node = dest;
@@ -389,17 +476,31 @@ AlgebraicExpression **AlgebraicExpression_From_Query(const AST *ast, Vector *mat
     return expressions;
 }
 
-void AlgebraicExpression_Execute(AlgebraicExpression *ae, GrB_Matrix res) {
-    assert(ae && res);
-
+/* Evaluates expression into res, evaluation is abandoned
+ * returning false as soon as an intermediate product holds
+ * more than limit entries. */
+static bool _AlgebraicExpression_Evaluate(AlgebraicExpression *ae, GrB_Matrix res, GrB_Index limit) {
     size_t operand_count = ae->operand_count;
     assert(operand_count > 1);
 
+    /* Multiplying by a diagonal label matrix merely filters rows,
+     * a leading label operand is applied as a row mask
+     * on the final product instead. */
+    AlgebraicExpressionOperand *terms = ae->operands;
+    GrB_Matrix rowMask = NULL;
+    if(operand_count > 2 && terms[0].diagonal) {
+        rowMask = terms[0].operand;
+        terms++;
+        operand_count--;
+    }
+
     AlgebraicExpressionOperand operands[operand_count];
-    memcpy(operands, ae->operands, sizeof(AlgebraicExpressionOperand) * operand_count);
+    memcpy(operands, terms, sizeof(AlgebraicExpressionOperand) * operand_count);
+    GrB_Index nvals = 0;
 
-    GrB_Descriptor desc;
-    GrB_Descriptor_new(&desc);
+    // Descriptor is created once and restored to default after each use.
+    if(!ae->desc) GrB_Descriptor_new(&ae->desc);
+    GrB_Descriptor desc = ae->desc;
     AlgebraicExpressionOperand leftTerm;
     AlgebraicExpressionOperand rightTerm;
 
@@ -412,28 +513,153 @@ void AlgebraicExpression_Execute(AlgebraicExpression *ae, GrB_Matrix res) {
         rightTerm = operands[operand_count-1];
         leftTerm = operands[operand_count-2];
 
+        // Prefer maintained transposed matrices over transposing on the fly.
+        if(leftTerm.transpose && leftTerm.transposed) {
+            leftTerm.operand = leftTerm.transposed;
+            leftTerm.transpose = false;
+        }
+        if(rightTerm.transpose && rightTerm.transposed) {
+            rightTerm.operand = rightTerm.transposed;
+            rightTerm.transpose = false;
+        }
+
         // Multiply and reduce.
         if(leftTerm.transpose) GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
         if(rightTerm.transpose) GrB_Descriptor_set(desc, GrB_INP1, GrB_TRAN);
 
         _AlgebraicExpression_Execute_MUL(res, leftTerm.operand, rightTerm.operand, desc);
 
+        // Restore descriptor to default.
+        if(leftTerm.transpose) GrB_Descriptor_set(desc, GrB_INP0, GxB_DEFAULT);
+        if(rightTerm.transpose) GrB_Descriptor_set(desc, GrB_INP1, GxB_DEFAULT);
+
         // Quick return if C is ZERO, there's no way to make progress.
-        GrB_Index nvals = 0;
         GrB_Matrix_nvals(&nvals, res);
         if(nvals == 0) break;
-
-        // Restore descriptor to default.
-        GrB_Descriptor_set(desc, GrB_INP0, GxB_DEFAULT);
-        GrB_Descriptor_set(desc, GrB_INP1, GxB_DEFAULT);
+        if(nvals > limit) return false;
 
         // Assign result and update operands count.
         operands[operand_count-2].operand = res;
         operands[operand_count-2].transpose = false;
+        operands[operand_count-2].transposed = NULL;
         operand_count--;        
     }
 
-    GrB_Descriptor_free(&desc);
+    if(rowMask && nvals > 0) _AlgebraicExpression_RowMask(ae, res, rowMask);
+    return true;
+}
+
+void AlgebraicExpression_Execute(AlgebraicExpression *ae, GrB_Matrix res) {
+    assert(ae && res);
+    _AlgebraicExpression_Evaluate(ae, res, UINT64_MAX);
+}
+
+/* Builds a key describing ae's operands e.g. L1.R0'.L2,
+ * returns false if an operand isn't maintained by the graph. */
+static bool _AlgebraicExpression_ProductKey(const AlgebraicExpression *ae, char *key, size_t len) {
+    size_t offset = 0;
+    for(size_t i = 0; i < ae->operand_count; i++) {
+        const AlgebraicExpressionOperand *op = ae->operands + i;
+        if(op->free) return false;
+
+        char type;
+        int id;
+        bool transposed;
+        if(!Graph_IdentifyMatrix(ae->graph, op->operand, &type, &id, &transposed)) return false;
+
+        // Transposing a maintained transpose yields the original matrix,
+        // label matrices are diagonal and never transposed.
+        bool transpose = (type != 'L' && op->transpose != transposed);
+        int n = snprintf(key + offset, len - offset, "%s%c%d%s", (i > 0) ? "." : "",
+                         type, id, transpose ? "'" : "");
+        if(n < 0 || (size_t)n >= len - offset) return false;
+        offset += n;
+    }
+    return true;
+}
+
+// Looks up ae's product in the shared path cache.
+static void _AlgebraicExpression_LookupProduct(AlgebraicExpression *ae) {
+    char key[256];
+    if(!ae->pathCache || !_AlgebraicExpression_ProductKey(ae, key, sizeof(key))) return;
+
+    ae->cacheEntry = PathCache_Get(ae->pathCache, key, Graph_Version(ae->graph));
+    if(ae->cacheEntry) ae->product = PathCacheEntry_Product(ae->cacheEntry);
+}
+
+// Shares ae's computed product through the path cache.
+static void _AlgebraicExpression_ShareProduct(AlgebraicExpression *ae) {
+    char key[256];
+    if(!ae->pathCache || !_AlgebraicExpression_ProductKey(ae, key, sizeof(key))) return;
+
+    // On success cache owns product.
+    ae->cacheEntry = PathCache_Put(ae->pathCache, key, Graph_Version(ae->graph), ae->product);
+}
+
+/* Evaluates and caches the product of ae's operands,
+ * caching is disabled if the product grows larger than
+ * all of the operands combined. */
+static void _AlgebraicExpression_CacheProduct(AlgebraicExpression *ae) {
+    GrB_Index limit = 0;
+    for(size_t i = 0; i < ae->operand_count; i++) {
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, ae->operands[i].operand);
+        limit += nvals;
+    }
+
+    GrB_Index nrows;
+    GrB_Index ncols;
+    GrB_Matrix_nrows(&nrows, ae->operands[0].operand);
+    GrB_Matrix_ncols(&ncols, ae->operands[ae->operand_count-1].operand);
+    if(ae->operands[0].transpose) GrB_Matrix_ncols(&nrows, ae->operands[0].operand);
+    if(ae->operands[ae->operand_count-1].transpose) {
+        GrB_Matrix_nrows(&ncols, ae->operands[ae->operand_count-1].operand);
+    }
+
+    /* Product is retained only once it is known to fit the limit,
+     * a product exceeding it is freed right away. */
+    GrB_Index nvals = 0;
+    GrB_Matrix product;
+    GrB_Matrix_new(&product, GrB_BOOL, nrows, ncols);
+    bool evaluated = _AlgebraicExpression_Evaluate(ae, product, limit);
+    if(evaluated) GrB_Matrix_nvals(&nvals, product);
+    if(!evaluated || nvals > limit) {
+        GrB_Matrix_free(&product);
+        ae->cacheDisabled = true;
+        return;
+    }
+
+    ae->product = product;
+    _AlgebraicExpression_ShareProduct(ae);
+}
+
+void AlgebraicExpression_SetPathCache(AlgebraicExpression *ae, const Graph *g, PathCache *cache) {
+    assert(ae && g);
+    ae->graph = g;
+    ae->pathCache = cache;
+}
+
+void AlgebraicExpression_MultiplyRight(AlgebraicExpression *ae, GrB_Matrix m, GrB_Matrix res) {
+    assert(ae && m && res);
+
+    /* Evaluating right to left only touches entries reachable from m,
+     * while the product covers the entire graph, as such the product
+     * is only computed once the expression has been reused a few times,
+     * unless a previous query has already computed it. */
+    if(!ae->product && !ae->cacheDisabled && ae->operand_count > 1) {
+        if(ae->executions == 0) _AlgebraicExpression_LookupProduct(ae);
+        else if(ae->executions >= AE_CACHE_MIN_EXECUTIONS) _AlgebraicExpression_CacheProduct(ae);
+    }
+    ae->executions++;
+
+    if(ae->product) {
+        _AlgebraicExpression_Execute_MUL(res, ae->product, m, NULL);
+        return;
+    }
+
+    AlgebraicExpression_AppendTerm(ae, m, false, false);
+    AlgebraicExpression_Execute(ae, res);
+    AlgebraicExpression_RemoveTerm(ae, ae->operand_count-1, NULL);
 }
 
 void AlgebraicExpression_RemoveTerm(AlgebraicExpression *ae, int idx, AlgebraicExpressionOperand *operand) {
@@ -466,6 +692,34 @@ void AlgebraicExpression_Transpose(AlgebraicExpression *ae) {
         ae->operands[i].transpose = !ae->operands[i].transpose;
 }
 
+void AlgebraicExpression_AttachTransposed(AlgebraicExpression *ae, const Graph *g) {
+    assert(ae && g);
+    for(int i = 0; i < ae->operand_count; i++) {
+        AlgebraicExpressionOperand *op = ae->operands + i;
+        // Operands owned by the expression aren't maintained by the graph.
+        if(op->free) continue;
+        op->transposed = Graph_GetTransposedMatrix(g, op->operand);
+    }
+}
+
+AlgebraicExpression *AlgebraicExpression_Clone(const AlgebraicExpression *ae) {
+    AlgebraicExpression *clone = _AE_MUL(ae->operand_cap);
+    clone->op = ae->op;
+    clone->operand_count = ae->operand_count;
+    memcpy(clone->operands, ae->operands, sizeof(AlgebraicExpressionOperand) * ae->operand_count);
+    for(int i = 0; i < clone->operand_count; i++) {
+        if(clone->operands[i].free) GrB_Matrix_dup(&clone->operands[i].operand, ae->operands[i].operand);
+    }
+
+    clone->src_node = ae->src_node;
+    clone->dest_node = ae->dest_node;
+    clone->edge = ae->edge;
+    clone->edgeLength = ae->edgeLength;
+    clone->graph = ae->graph;
+    clone->pathCache = ae->pathCache;
+    return clone;
+}
+
 void AlgebraicExpression_Free(AlgebraicExpression* ae) {
     for(int i = 0; i < ae->operand_count; i++) {
         if(ae->operands[i].free) {
@@ -473,7 +727,12 @@ void AlgebraicExpression_Free(AlgebraicExpression* ae) {
         }
     }
 
-    free(ae->operands);
+    Arena_Release(Arena_GetCurrent(), ae->operands, sizeof(AlgebraicExpressionOperand) * ae->operand_cap);
+    if(ae->desc) GrB_Descriptor_free(&ae->desc);
+    if(ae->rowMask) rm_free(ae->rowMask);
+    // Shared products are owned by the path cache.
+    if(ae->cacheEntry) PathCache_Release(ae->pathCache, ae->cacheEntry);
+    else if(ae->product) GrB_Matrix_free(&ae->product);
     free(ae);
 }
 
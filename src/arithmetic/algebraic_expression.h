@@ -10,6 +10,7 @@
 
 #include "../graph/query_graph.h"
 #include "../graph/graph.h"
+#include "../graph/path_cache.h"
 #include "../parser/ast.h"
 
 // Matrix, vector operations.
@@ -55,7 +56,9 @@ void AlgebraicExpressionNode_Free(AlgebraicExpressionNode *root);
 typedef struct  {
     bool transpose;         // Should the matrix be transposed.
     bool free;              // Should the matrix be freed?
+    bool diagonal;          // Is the matrix a diagonal label matrix.
     GrB_Matrix operand;
+    GrB_Matrix transposed;  // Maintained transpose of operand, NULL if unavailable.
 } AlgebraicExpressionOperand;
 
 // Algebraic expression e.g. A*B*C
@@ -68,14 +71,35 @@ typedef struct {
     Node *dest_node;                        // Nodes represented by the last operand rows.
     Edge *edge;                             // Edge represented by sole operand.
     AST_LinkLength *edgeLength;             // Repeatable edge length.
+    GrB_Descriptor desc;                    // Multiplication descriptor, reused across executions.
+    uint64_t *rowMask;                      // Bitmap of rows in leading label operand.
+    GrB_Index rowMaskRows;                  // Number of rows covered by rowMask.
+    uint64_t rowMaskVersion;                // Graph version rowMask was built at.
+    GrB_Matrix product;                     // Cached product of all operands, NULL if not computed.
+    uint executions;                        // Number of times expression was multiplied by an operand.
+    bool cacheDisabled;                     // Product is too large to be cached.
+    const Graph *graph;                     // Graph maintaining operands, set along with pathCache.
+    PathCache *pathCache;                   // Products shared across queries, NULL if unused.
+    PathCacheEntry *cacheEntry;             // Shared cache entry holding product.
 } AlgebraicExpression;
 
 /* Construct an algebraic expression from a query. */
 AlgebraicExpression **AlgebraicExpression_From_Query(const AST *ast, Vector *matchPattern, const QueryGraph *q, size_t *exp_count);
 
-/* Executes given expression. */
+/* Executes given expression.
+ * A leading diagonal label operand is not multiplied in,
+ * instead it masks the rows of the final product. */
 void AlgebraicExpression_Execute(AlgebraicExpression *ae, GrB_Matrix res);
 
+/* Computes res = ae * m, ae's operands must remain unchanged
+ * between calls, as once ae is reused its product is cached
+ * and only the multiplication by m is performed. */
+void AlgebraicExpression_MultiplyRight(AlgebraicExpression *ae, GrB_Matrix m, GrB_Matrix res);
+
+/* Shares ae's product with other queries through cache,
+ * products are keyed by the identity of ae's operands within g. */
+void AlgebraicExpression_SetPathCache(AlgebraicExpression *ae, const Graph *g, PathCache *cache);
+
 /* Appends m as the last term in the expression ae. */
 void AlgebraicExpression_AppendTerm(AlgebraicExpression *ae, GrB_Matrix m, bool transposeOp, bool freeOp);
 
@@ -89,6 +113,15 @@ void AlgebraicExpression_RemoveTerm(AlgebraicExpression *ae, int idx, AlgebraicE
  * directly accessing expression transpose flag is forbidden. */
 void AlgebraicExpression_Transpose(AlgebraicExpression *ae);
 
+/* Associates each operand with its transposed matrix maintained by g,
+ * such that transposed operands are read directly rather than
+ * being transposed during evaluation. */
+void AlgebraicExpression_AttachTransposed(AlgebraicExpression *ae, const Graph *g);
+
+/* Clones ae, matrices owned by ae are duplicated,
+ * cached products and evaluation state are not carried over. */
+AlgebraicExpression *AlgebraicExpression_Clone(const AlgebraicExpression *ae);
+
 void AlgebraicExpression_Free(AlgebraicExpression* ae);
 
 #endif
@@ -96,6 +96,20 @@ AR_ExpNode* AR_EXP_BuildFromAST(const AST *ast, const AST_ArithmeticExpressionNo
     return root;
 }
 
+AR_ExpNode* AR_EXP_NewOpNode(char *func_name, int child_count) {
+    return _AR_EXP_NewOpNode(func_name, child_count);
+}
+
+AR_ExpNode* AR_EXP_NewRecordEntryNode(int idx) {
+    AR_ExpNode *node = calloc(1, sizeof(AR_ExpNode));
+    node->type = AR_EXP_OPERAND;
+    node->operand.type = AR_EXP_VARIADIC;
+    node->operand.variadic.entity_alias = NULL;
+    node->operand.variadic.entity_alias_idx = idx;
+    node->operand.variadic.entity_prop = NULL;
+    return node;
+}
+
 int AR_EXP_GetOperandType(AR_ExpNode *exp) {
     if (exp->type == AR_EXP_OPERAND) return exp->operand.type;
     return -1;
@@ -193,6 +207,20 @@ void AR_EXP_Reduce(const AR_ExpNode *root) {
     }
 }
 
+void AR_EXP_Combine(const AR_ExpNode *root, const AR_ExpNode *other) {
+    if(root->type != AR_EXP_OP) return;
+    assert(other->type == AR_EXP_OP && root->op.child_count == other->op.child_count);
+
+    if(root->op.type == AR_OP_AGGREGATE) {
+        Agg_Combine(root->op.agg_func, other->op.agg_func);
+    } else {
+        /* Keep searching for aggregation nodes. */
+        for(int i = 0; i < root->op.child_count; i++) {
+            AR_EXP_Combine(root->op.children[i], other->op.children[i]);
+        }
+    }
+}
+
 void AR_EXP_CollectAliases(AR_ExpNode *root, TrieMap *aliases) {
     if (root->type == AR_EXP_OP) {
         for (int i = 0; i < root->op.child_count; i ++) {
@@ -321,10 +349,26 @@ void AR_EXP_Free(AR_ExpNode *root) {
 
 /* Mathematical functions - numeric */
 
+/* Returns numeric argument as a double. */
+static inline double _AR_ToDouble(SIValue v) {
+    double d = 0;
+    SIValue_ToDouble(&v, &d);
+    return d;
+}
+
+/* 64 bit integer operands yield an integer result,
+ * any other numeric operand promotes the result to a double. */
+static inline bool _AR_IntegerOp(SIValue *result, const SIValue *arg) {
+    if(SI_TYPE(*result) == T_INT64 && SI_TYPE(*arg) == T_INT64) return true;
+    SIValue_ConvertToDouble(result);
+    return false;
+}
+
 SIValue AR_ADD(SIValue *argv, int argc) {
     SIValue result = argv[0];
-    if(SI_TYPE(result) & SI_NUMERIC) {
-        /* If the result is numeric, ensure that it is represented as a double. */
+    if(SI_TYPE(result) & SI_NUMERIC && SI_TYPE(result) != T_INT64) {
+        /* If the result is numeric, ensure that it is represented as
+         * either a 64 bit integer or a double. */
         SIValue_ConvertToDouble(&result);
     }
     char buffer[512];
@@ -337,8 +381,12 @@ SIValue AR_ADD(SIValue *argv, int argc) {
         /* Perform numeric addition only if both result and current argument
          * are numeric. */
         if(SI_TYPE(result) & SI_NUMERIC && SI_TYPE(argv[i]) & SI_NUMERIC) {
-            SIValue_ToDouble(&argv[i], &numeric_arg);
             /* Numeric addition. */
+            if(_AR_IntegerOp(&result, &argv[i])) {
+                result.longval += argv[i].longval;
+                continue;
+            }
+            SIValue_ToDouble(&argv[i], &numeric_arg);
             result.doubleval += numeric_arg;
         } else {
             /* String concatenation.
@@ -381,7 +429,8 @@ SIValue AR_SUB(SIValue *argv, int argc) {
     result = argv[0];
     for(int i = 1; i < argc; i++) {
         if(SIValue_IsNull(argv[i])) return SI_NullVal();
-        result.doubleval -= argv[i].doubleval;
+        if(_AR_IntegerOp(&result, &argv[i])) result.longval -= argv[i].longval;
+        else result.doubleval -= _AR_ToDouble(argv[i]);
     }
     return result;
 }
@@ -391,8 +440,8 @@ SIValue AR_MUL(SIValue *argv, int argc) {
     result = argv[0];
     for(int i = 1; i < argc; i++) {
         if(SIValue_IsNull(argv[i])) return SI_NullVal();
-        /* Assuming every argv is of type double. */
-        result.doubleval *= argv[i].doubleval;
+        if(_AR_IntegerOp(&result, &argv[i])) result.longval *= argv[i].longval;
+        else result.doubleval *= _AR_ToDouble(argv[i]);
     }
     return result;
 }
@@ -402,15 +451,26 @@ SIValue AR_DIV(SIValue *argv, int argc) {
     result = argv[0];
     for(int i = 1; i < argc; i++) {
         if(SIValue_IsNull(argv[i])) return SI_NullVal();
-        /* Assuming every argv is of type double. */
+        /* Integer division, unless divisor is zero. */
+        if(SI_TYPE(argv[i]) == T_INT64 && argv[i].longval != 0 &&
+           _AR_IntegerOp(&result, &argv[i])) {
+            result.longval /= argv[i].longval;
+            continue;
+        }
         /* TODO: division by zero. */
-        result.doubleval /= argv[i].doubleval;
+        SIValue_ConvertToDouble(&result);
+        result.doubleval /= _AR_ToDouble(argv[i]);
     }
     return result;
 }
 
 SIValue AR_ABS(SIValue *argv, int argc) {
     SIValue result = argv[0];
+    if(SI_TYPE(result) == T_INT64) {
+        if(result.longval < 0) result.longval *= -1;
+        return result;
+    }
+    SIValue_ConvertToDouble(&result);
     if(result.doubleval < 0) {
         result.doubleval *= -1;
     }
@@ -419,12 +479,16 @@ SIValue AR_ABS(SIValue *argv, int argc) {
 
 SIValue AR_CEIL(SIValue *argv, int argc) {
     SIValue result = argv[0];
+    if(SI_TYPE(result) == T_INT64) return result;
+    SIValue_ConvertToDouble(&result);
     result.doubleval = ceil(result.doubleval);
     return result;
 }
 
 SIValue AR_FLOOR(SIValue *argv, int argc) {
     SIValue result = argv[0];
+    if(SI_TYPE(result) == T_INT64) return result;
+    SIValue_ConvertToDouble(&result);
     result.doubleval = floor(result.doubleval);
     return result;
 }
@@ -436,6 +500,8 @@ SIValue AR_RAND(SIValue *argv, int argc) {
 
 SIValue AR_ROUND(SIValue *argv, int argc) {
     SIValue result = argv[0];
+    if(SI_TYPE(result) == T_INT64) return result;
+    SIValue_ConvertToDouble(&result);
     result.doubleval = round(result.doubleval);
     return result;
 }
@@ -444,9 +510,10 @@ SIValue AR_SIGN(SIValue *argv, int argc) {
     assert(argc == 1);
     if(SIValue_IsNull(argv[0])) return SI_NullVal();
 
-    if(argv[0].doubleval == 0) {
+    double d = _AR_ToDouble(argv[0]);
+    if(d == 0) {
         return SI_DoubleVal(0);
-    } else if(argv[0].doubleval < 0) {
+    } else if(d < 0) {
         return SI_DoubleVal(-1);
     } else {
         return SI_DoubleVal(1);
@@ -460,9 +527,9 @@ SIValue AR_LEFT(SIValue *argv, int argc) {
     if(SIValue_IsNull(argv[0])) return SI_NullVal();
 
     assert(SI_TYPE(argv[0]) & SI_STRING);
-    assert(SI_TYPE(argv[1]) == T_DOUBLE);
+    assert(SI_TYPE(argv[1]) & SI_NUMERIC);
 
-    size_t newlen = (size_t)argv[1].doubleval;
+    size_t newlen = (size_t)_AR_ToDouble(argv[1]);
     if (strlen(argv[0].stringval) <= newlen) {
       // No need to truncate this string based on the requested length
       return SI_DuplicateStringVal(argv[0].stringval);
@@ -491,9 +558,9 @@ SIValue AR_RIGHT(SIValue *argv, int argc) {
     assert(argc == 2);
     if(SIValue_IsNull(argv[0])) return SI_NullVal();
     assert(SI_TYPE(argv[0]) & SI_STRING);
-    assert(SI_TYPE(argv[1]) == T_DOUBLE);
+    assert(SI_TYPE(argv[1]) & SI_NUMERIC);
 
-    int newlen = (int)argv[1].doubleval;
+    int newlen = (int)_AR_ToDouble(argv[1]);
     int start = strlen(argv[0].stringval) - newlen;
 
     if (start <= 0) {
@@ -550,7 +617,7 @@ SIValue AR_SUBSTRING(SIValue *argv, int argc) {
     if(SIValue_IsNull(argv[0])) return SI_NullVal();
     char *original = argv[0].stringval;
     size_t original_len = strlen(original);
-    int start = (int)argv[1].doubleval;
+    int start = (int)_AR_ToDouble(argv[1]);
     size_t length;
 
     /* Make sure start doesn't overreach. */
@@ -559,8 +626,8 @@ SIValue AR_SUBSTRING(SIValue *argv, int argc) {
     if(argc == 2) {
         length = original_len - start;
     } else {
-        assert(argv[2].doubleval >= 0);
-        length = (size_t)argv[2].doubleval;
+        assert(_AR_ToDouble(argv[2]) >= 0);
+        length = (size_t)_AR_ToDouble(argv[2]);
         
         /* Make sure length does not overreach. */
         if(start + length > original_len) {
@@ -128,6 +128,9 @@ int AR_EXP_GetOperandType(AR_ExpNode *exp);
 SIValue AR_EXP_Evaluate(const AR_ExpNode *root, const Record r);
 void AR_EXP_Aggregate(const AR_ExpNode *root, const Record r);
 void AR_EXP_Reduce(const AR_ExpNode *root);
+/* Merges partial aggregations of other into root,
+ * both trees must have been built from the same expression. */
+void AR_EXP_Combine(const AR_ExpNode *root, const AR_ExpNode *other);
 
 /* Utility functions */
 /* Traverse an expression tree and add all graph entity aliases
@@ -145,6 +148,12 @@ void AR_EXP_ToString(const AR_ExpNode *root, char **str);
 /* Construct an arithmetic expression tree from ast arithmetic expression node. */
 AR_ExpNode* AR_EXP_BuildFromAST(const AST *ast, const AST_ArithmeticExpressionNode *exp);
 
+/* Creates a function or aggregation node, children are set by the caller. */
+AR_ExpNode* AR_EXP_NewOpNode(char *func_name, int child_count);
+
+/* Creates an operand node evaluating to the record entry at idx. */
+AR_ExpNode* AR_EXP_NewRecordEntryNode(int idx);
+
 /* Free arithmetic expression tree. */
 void AR_EXP_Free(AR_ExpNode *root);
 
@@ -17,7 +17,8 @@ typedef enum {
     BI_NULL,
     BI_BOOL,
     BI_NUMERIC,
-    BI_STRING
+    BI_STRING,
+    BI_LONG
 } TYPE;
 
 // Read the header of a data stream to parse its property keys and update schemas.
@@ -63,6 +64,7 @@ static inline SIValue _BulkInsert_ReadProperty(const char *data, size_t *data_id
      * - 1-byte true/false if type is boolean
      * - 8-byte double if type is numeric
      * - Null-terminated C string if type is string
+     * - 8-byte integer if type is long
      */
     SIValue v;
     TYPE t = data[*data_idx];
@@ -84,6 +86,10 @@ static inline SIValue _BulkInsert_ReadProperty(const char *data, size_t *data_id
         *data_idx += strlen(s) + 1;
         // Ownership of the string will be passed to the GraphEntity properties
         v = SI_TransferStringVal(s);
+    } else if (t == BI_LONG) {
+        int64_t l = *(int64_t*)&data[*data_idx];
+        *data_idx += sizeof(int64_t);
+        v = SI_LongVal(l);
     } else {
         assert(0);
     }
@@ -102,6 +108,7 @@ int _BulkInsert_ProcessNodeFile(RedisModuleCtx *ctx, GraphContext *gc, const cha
         Graph_CreateNode(gc->g, label_id, &n);
         for (unsigned int i = 0; i < prop_count; i++) {
             SIValue value = _BulkInsert_ReadProperty(data, &data_idx);
+            GraphContext_InternValue(gc, SCHEMA_NODE, prop_indicies[i], &value);
             GraphEntity_AddProperty((GraphEntity*)&n, prop_indicies[i], value);
         }
     }
@@ -136,6 +143,7 @@ int _BulkInsert_ProcessRelationFile(RedisModuleCtx *ctx, GraphContext *gc, const
         // Process and add relation properties
         for (unsigned int i = 0; i < prop_count; i ++) {
             SIValue value = _BulkInsert_ReadProperty(data, &data_idx);
+            GraphContext_InternValue(gc, SCHEMA_EDGE, prop_indicies[i], &value);
             GraphEntity_AddProperty((GraphEntity*)&e, prop_indicies[i], value);
         }
     }
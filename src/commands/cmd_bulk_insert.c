@@ -118,7 +118,12 @@ void _MGraph_BulkInsert(void *args) {
     RedisModule_ReplyWithStringBuffer(ctx, reply, len);
 
 cleanup:
-    if (gc) Graph_ReleaseLock(gc->g);
+    if (gc) {
+        // Revert to default synchronization behavior,
+        // pending changes are flushed as the lock is released.
+        Graph_SetMatrixPolicy(gc->g, SYNC_AND_MINIMIZE_SPACE);
+        Graph_ReleaseLock(gc->g);
+    }
     RedisModule_ThreadSafeContextUnlock(ctx);
     RedisModule_FreeThreadSafeContext(ctx);
     RedisModule_UnblockClient(context->bc, NULL);
@@ -0,0 +1,102 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "cmd_memory.h"
+#include <stdio.h>
+#include <string.h>
+#include "../graph/graphcontext.h"
+
+/* Reply with a single matrix report:
+ * name, format, number of entries, allocated bytes. */
+static void _ReplyWithMatrix(RedisModuleCtx *ctx, const char *name, GrB_Matrix M, size_t *total) {
+    bool hypersparse = false;
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, M);
+    size_t size = Graph_MatrixMemoryUsage(M, &hypersparse);
+    *total += size;
+
+    RedisModule_ReplyWithArray(ctx, 4);
+    RedisModule_ReplyWithStringBuffer(ctx, name, strlen(name));
+    RedisModule_ReplyWithSimpleString(ctx, hypersparse ? "hypersparse" : "sparse");
+    RedisModule_ReplyWithLongLong(ctx, nvals);
+    RedisModule_ReplyWithLongLong(ctx, size);
+}
+
+/* Reports memory allocated by each of the graph's matrices
+ * Args:
+ * argv[1] graph name */
+int MGraph_Memory(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    if (argc != 2) return RedisModule_WrongArity(ctx);
+
+    const char *graphname = RedisModule_StringPtrLen(argv[1], NULL);
+    GraphContext *gc = GraphContext_Retrieve(ctx, graphname);
+    if(!gc) {
+        RedisModule_ReplyWithError(ctx, "key doesn't contains a graph object.");
+        return REDISMODULE_OK;
+    }
+
+    char name[512];
+    size_t total = 0;
+    Graph *g = gc->g;
+    Graph_AcquireReadLock(g);
+
+    int labelCount = Graph_LabelTypeCount(g);
+    int relationCount = Graph_RelationTypeCount(g);
+    // Header, adjacency matrix and its transpose, labels,
+    // relation matrices, their transposes and mappings, path cache,
+    // total, path cache hits and misses.
+    RedisModule_ReplyWithArray(ctx, 1 + 2 + labelCount + relationCount * 3 + 1 + 1 + 2);
+
+    RedisModule_ReplyWithArray(ctx, 4);
+    RedisModule_ReplyWithSimpleString(ctx, "matrix");
+    RedisModule_ReplyWithSimpleString(ctx, "format");
+    RedisModule_ReplyWithSimpleString(ctx, "entries");
+    RedisModule_ReplyWithSimpleString(ctx, "bytes");
+
+    _ReplyWithMatrix(ctx, "adjacency", Graph_GetAdjacencyMatrix(g), &total);
+    _ReplyWithMatrix(ctx, "adjacency transposed", Graph_GetTransposedAdjacencyMatrix(g), &total);
+
+    for(int i = 0; i < labelCount; i++) {
+        snprintf(name, sizeof(name), "label %s", gc->node_schemas[i]->name);
+        _ReplyWithMatrix(ctx, name, Graph_GetLabel(g, i), &total);
+    }
+
+    for(int i = 0; i < relationCount; i++) {
+        const char *relation = gc->relation_schemas[i]->name;
+        snprintf(name, sizeof(name), "relation %s", relation);
+        _ReplyWithMatrix(ctx, name, Graph_GetRelationMatrix(g, i), &total);
+        snprintf(name, sizeof(name), "relation %s transposed", relation);
+        _ReplyWithMatrix(ctx, name, Graph_GetTransposedRelationMatrix(g, i), &total);
+        snprintf(name, sizeof(name), "relation %s mapping", relation);
+        _ReplyWithMatrix(ctx, name, g->_relations_map[i], &total);
+    }
+
+    // Products cached across queries.
+    PathCacheStats stats;
+    PathCache_GetStats(gc->path_cache, &stats);
+    total += stats.bytes;
+    RedisModule_ReplyWithArray(ctx, 4);
+    RedisModule_ReplyWithSimpleString(ctx, "path cache");
+    RedisModule_ReplyWithSimpleString(ctx, "products");
+    RedisModule_ReplyWithLongLong(ctx, stats.entries);
+    RedisModule_ReplyWithLongLong(ctx, stats.bytes);
+
+    RedisModule_ReplyWithArray(ctx, 2);
+    RedisModule_ReplyWithSimpleString(ctx, "total bytes");
+    RedisModule_ReplyWithLongLong(ctx, total);
+
+    RedisModule_ReplyWithArray(ctx, 2);
+    RedisModule_ReplyWithSimpleString(ctx, "path cache hits");
+    RedisModule_ReplyWithLongLong(ctx, stats.hits);
+
+    RedisModule_ReplyWithArray(ctx, 2);
+    RedisModule_ReplyWithSimpleString(ctx, "path cache misses");
+    RedisModule_ReplyWithLongLong(ctx, stats.misses);
+
+    Graph_ReleaseLock(g);
+    return REDISMODULE_OK;
+}
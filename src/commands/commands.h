@@ -13,3 +13,4 @@
 #include "cmd_delete.h"
 #include "cmd_explain.h"
 #include "cmd_bulk_insert.h"
+#include "cmd_memory.h"
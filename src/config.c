@@ -9,6 +9,7 @@
 #include <unistd.h>
 #include <string.h>
 #include <assert.h>
+#include <stdbool.h>
 
 long long Config_GetThreadCount(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     // Default.    
@@ -39,3 +40,81 @@ long long Config_GetThreadCount(RedisModuleCtx *ctx, RedisModuleString **argv, i
 
     return threadCount;
 }
+
+bool Config_GetColumnarProperties(RedisModuleString **argv, int argc) {
+    // Default, properties are held by entities.
+    bool columnar = false;
+
+    // Expecting configuration to be in the form of key value pairs.
+    if(argc%2 == 0) {
+        for(int i = 0; i < argc; i+=2) {
+            const char *param = RedisModule_StringPtrLen(argv[i], NULL);
+            if(strcasecmp(param, COLUMNAR_PROPERTIES) == 0) {
+                const char *val = RedisModule_StringPtrLen(argv[i+1], NULL);
+                columnar = (strcasecmp(val, "yes") == 0);
+                break;
+            }
+        }
+    }
+
+    return columnar;
+}
+
+bool Config_GetHypersparseMatrices(RedisModuleString **argv, int argc) {
+    // Default, matrices are never hypersparse.
+    bool hypersparse = false;
+
+    // Expecting configuration to be in the form of key value pairs.
+    if(argc%2 == 0) {
+        for(int i = 0; i < argc; i+=2) {
+            const char *param = RedisModule_StringPtrLen(argv[i], NULL);
+            if(strcasecmp(param, HYPERSPARSE_MATRICES) == 0) {
+                const char *val = RedisModule_StringPtrLen(argv[i+1], NULL);
+                hypersparse = (strcasecmp(val, "yes") == 0);
+                break;
+            }
+        }
+    }
+
+    return hypersparse;
+}
+
+long long Config_GetPathCacheSize(RedisModuleString **argv, int argc) {
+    // Default.
+    long long size = PATH_CACHE_DEFAULT_SIZE;
+
+    // Expecting configuration to be in the form of key value pairs.
+    if(argc%2 == 0) {
+        for(int i = 0; i < argc; i+=2) {
+            const char *param = RedisModule_StringPtrLen(argv[i], NULL);
+            if(strcasecmp(param, PATH_CACHE_SIZE) == 0) {
+                RedisModule_StringToLongLong(argv[i+1], &size);
+                break;
+            }
+        }
+    }
+
+    // Sanity.
+    assert(size >= 0);
+    return size;
+}
+
+long long Config_GetParallelThreshold(RedisModuleString **argv, int argc) {
+    // Default.
+    long long threshold = PARALLEL_DEFAULT_THRESHOLD;
+
+    // Expecting configuration to be in the form of key value pairs.
+    if(argc%2 == 0) {
+        for(int i = 0; i < argc; i+=2) {
+            const char *param = RedisModule_StringPtrLen(argv[i], NULL);
+            if(strcasecmp(param, PARALLEL_THRESHOLD) == 0) {
+                RedisModule_StringToLongLong(argv[i+1], &threshold);
+                break;
+            }
+        }
+    }
+
+    // Sanity.
+    assert(threshold >= 0);
+    return threshold;
+}
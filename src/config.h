@@ -8,9 +8,16 @@
 #ifndef _REDISGRAPH_CONFIG_
 #define _REDISGRAPH_CONFIG_
 
+#include <stdbool.h>
 #include "redismodule.h"
 
 #define THREAD_COUNT "THREAD_COUNT" // Config param, number of threads in thread pool
+#define COLUMNAR_PROPERTIES "COLUMNAR_PROPERTIES" // Config param, yes/no store properties in columns
+#define HYPERSPARSE_MATRICES "HYPERSPARSE_MATRICES" // Config param, yes/no allow hypersparse matrices
+#define PATH_CACHE_SIZE "PATH_CACHE_SIZE" // Config param, memory cap in bytes of each graph's path cache
+#define PATH_CACHE_DEFAULT_SIZE (64 * 1024 * 1024) // Default path cache memory cap.
+#define PARALLEL_THRESHOLD "PARALLEL_THRESHOLD" // Config param, number of scanned nodes above which queries run in parallel
+#define PARALLEL_DEFAULT_THRESHOLD 100000 // Default parallel execution threshold.
 
 // Tries to fetch number of threads from
 // command line arguments if specified
@@ -22,4 +29,40 @@ long long Config_GetThreadCount (
     int argc
 );
 
+// Tries to fetch property layout from
+// command line arguments if specified
+// returns true if columnar property storage is requested,
+// false otherwise.
+bool Config_GetColumnarProperties (
+    RedisModuleString **argv,
+    int argc
+);
+
+// Tries to fetch matrix format from
+// command line arguments if specified
+// returns true if label and relation matrices may be hypersparse,
+// false otherwise.
+bool Config_GetHypersparseMatrices (
+    RedisModuleString **argv,
+    int argc
+);
+
+// Tries to fetch path cache memory cap from
+// command line arguments if specified
+// otherwise returns PATH_CACHE_DEFAULT_SIZE,
+// a cap of 0 disables the cache.
+long long Config_GetPathCacheSize (
+    RedisModuleString **argv,
+    int argc
+);
+
+// Tries to fetch parallel execution threshold from
+// command line arguments if specified
+// otherwise returns PARALLEL_DEFAULT_THRESHOLD,
+// a threshold of 0 disables parallel execution.
+long long Config_GetParallelThreshold (
+    RedisModuleString **argv,
+    int argc
+);
+
 #endif
@@ -187,6 +187,10 @@ void ExecutionPlan_AddOp(OpBase *parent, OpBase *newOp) {
     _OpBase_AddChild(parent, newOp);
 }
 
+void ExecutionPlan_PushBelow(OpBase *a, OpBase *b) {
+    _OpBase_PushBelow(a, b);
+}
+
 void ExecutionPlan_ReplaceOp(OpBase *a, OpBase *b) {
     // Insert the new operation between the original and its parent.
     _OpBase_PushBelow(a, b);
@@ -214,6 +218,30 @@ OpBase* ExecutionPlan_Locate_References(OpBase *root, Vector *references) {
     return op;
 }
 
+/* Removes label matrix of scanned node n from expression,
+ * expression is expected to begin at n. */
+static void _StripScannedLabel(AlgebraicExpression *exp, const Node *n) {
+    if(exp->operand_count == 0 || !n->mat) return;
+    if(exp->operands[exp->operand_count-1].operand == n->mat) {
+        AlgebraicExpression_RemoveTerm(exp, exp->operand_count-1, NULL);
+    }
+}
+
+// Adds a traversal operation resolving exp.
+static void _PushTraversal(Vector *traversals, AlgebraicExpression *exp, Graph *g) {
+    if(exp->operand_count == 0) return;
+    OpBase *op;
+    if(exp->edgeLength) {
+        op = NewCondVarLenTraverseOp(exp,
+                                     exp->edgeLength->minHops,
+                                     exp->edgeLength->maxHops,
+                                     g);
+    } else {
+        op = NewCondTraverseOp(g, exp);
+    }
+    Vector_Push(traversals, op);
+}
+
 ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx,
                                 GraphContext *gc,
                                 AST *ast,
@@ -223,6 +251,10 @@ ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx,
     ExecutionPlan *execution_plan = (ExecutionPlan*)calloc(1, sizeof(ExecutionPlan));    
     execution_plan->result_set = (explain) ? NULL: NewResultSet(ast, ctx);
     execution_plan->filter_tree = NULL;
+    /* Allocations made while building and executing the plan
+     * are served from the plan's arena. */
+    execution_plan->arena = Arena_New();
+    Arena_SetCurrent(execution_plan->arena);
     Vector *ops = NewVector(OpBase*, 1);
     OpBase *op;
 
@@ -238,6 +270,7 @@ ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx,
     FT_FilterNode *filter_tree = NULL;
     if(ast->whereNode != NULL) {
         filter_tree = BuildFiltersTree(ast, ast->whereNode->filters);
+        FilterTree_InternStrings(filter_tree, gc->string_dict);
         execution_plan->filter_tree = filter_tree;
     }
 
@@ -267,64 +300,38 @@ ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx,
                 size_t expCount = 0;
                 AlgebraicExpression **exps = AlgebraicExpression_From_Query(ast, pattern, q, &expCount);
 
-                TRAVERSE_ORDER order = determineTraverseOrder(filter_tree, exps, expCount);
-                if(order == TRAVERSE_ORDER_FIRST) {
-                    AlgebraicExpression *exp = exps[0];
-                    selectEntryPoint(exp, filter_tree);
-
-                    // Create SCAN operation.
-                    if(exp->src_node->label) {
-                        /* There's no longer need for the last matrix operand
-                         * as it's been replaced by label scan. */
-                        AlgebraicExpression_RemoveTerm(exp, exp->operand_count-1, NULL);
-                        op = NewNodeByLabelScanOp(gc, exp->src_node);
-                        Vector_Push(traversals, op);
-                    } else {
-                        op = NewAllNodeScanOp(g, exp->src_node);
-                        Vector_Push(traversals, op);
-                    }
-                    for(int i = 0; i < expCount; i++) {
-                        if(exps[i]->operand_count == 0) continue;
-                        if(exps[i]->edgeLength) {
-                            op = NewCondVarLenTraverseOp(exps[i],
-                                                         exps[i]->edgeLength->minHops,
-                                                         exps[i]->edgeLength->maxHops,
-                                                         g);
-                        }
-                        else {
-                            op = NewCondTraverseOp(g, exps[i]);
-                        }
-                        Vector_Push(traversals, op);
-                    }
+                size_t entry = determineTraverseOrder(gc, filter_tree, exps, expCount);
+                AlgebraicExpression *exp = exps[entry];
+                Node *src = exp->src_node;
+                selectEntryPoint(gc, exp, filter_tree);
+                bool transposed = (exp->src_node != src);
+
+                // Create SCAN operation.
+                if(exp->src_node->label) {
+                    /* There's no longer need for the label matrix operand
+                     * as it's been replaced by label scan. */
+                    _StripScannedLabel(exp, exp->src_node);
+                    op = NewNodeByLabelScanOp(gc, exp->src_node);
                 } else {
-                    AlgebraicExpression *exp = exps[expCount-1];
-                    selectEntryPoint(exp, filter_tree);
-                    // Create SCAN operation.
-                    if(exp->dest_node->label) {
-                        /* There's no longer need for the last matrix operand
-                         * as it's been replaced by label scan. */
-                        AlgebraicExpression_RemoveTerm(exp, exp->operand_count-1, NULL);
-                        op = NewNodeByLabelScanOp(gc, exp->dest_node);
-                        Vector_Push(traversals, op);
-                    } else {
-                        op = NewAllNodeScanOp(g, exp->dest_node);
-                        Vector_Push(traversals, op);
-                    }
+                    op = NewAllNodeScanOp(g, exp->src_node);
+                }
+                Vector_Push(traversals, op);
+                _PushTraversal(traversals, exp, g);
 
-                    for(int i = expCount-1; i >= 0; i--) {
-                        if(exps[i]->operand_count == 0) continue;
-                        AlgebraicExpression_Transpose(exps[i]);
-                        if(exps[i]->edgeLength) {
-                            op = NewCondVarLenTraverseOp(exps[i],
-                                                         exps[i]->edgeLength->minHops,
-                                                         exps[i]->edgeLength->maxHops,
-                                                         g);
-                        }
-                        else {
-                            op = NewCondTraverseOp(g, exps[i]);
-                        }
-                        Vector_Push(traversals, op);
+                /* Once entry expression is resolved both its ends are known,
+                 * traverse forward towards the last expression and backwards,
+                 * using transposed expressions, towards the first expression. */
+                for(int j = entry + 1; j < expCount; j++) {
+                    _PushTraversal(traversals, exps[j], g);
+                }
+                for(int j = entry - 1; j >= 0; j--) {
+                    AlgebraicExpression_Transpose(exps[j]);
+                    /* Scanned node is the source of the preceding expression,
+                     * its label matrix is redundant. */
+                    if(j == entry - 1 && !transposed && exp->src_node->label) {
+                        _StripScannedLabel(exps[j], exp->src_node);
                     }
+                    _PushTraversal(traversals, exps[j], g);
                 }
             } else {
                 /* Node scan. */
@@ -456,7 +463,11 @@ ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx,
 
 void _ExecutionPlanPrint(const OpBase *op, char **strPlan, int ident) {
     char strOp[512] = {0};
-    sprintf(strOp, "%*s%s\n", ident, "", op->name);
+    if(op->estimate >= 0) {
+        sprintf(strOp, "%*s%s | Estimated rows: %.0f\n", ident, "", op->name, op->estimate);
+    } else {
+        sprintf(strOp, "%*s%s\n", ident, "", op->name);
+    }
     
     if(*strPlan == NULL) {
         *strPlan = calloc(strlen(strOp) + 1, sizeof(char));
@@ -476,10 +487,41 @@ char* ExecutionPlanPrint(const ExecutionPlan *plan) {
     return strPlan;
 }
 
+/* Batch execution pulls up to RECORD_BATCH_CAP records at a time
+ * from operations which do not support batching, as such it is avoided
+ * whenever an operation modifies the graph. */
+static bool _ExecutionPlan_SupportsBatching(const OpBase *op) {
+    switch(op->type) {
+        case OPType_CREATE:
+        case OPType_UPDATE:
+        case OPType_DELETE:
+        case OPType_MERGE:
+            return false;
+        default:
+            break;
+    }
+
+    for(int i = 0; i < op->childCount; i++) {
+        if(!_ExecutionPlan_SupportsBatching(op->children[i])) return false;
+    }
+    return true;
+}
+
 ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan) {
     OpBase *op = plan->root;
-    Record r;
-    while((r = op->consume(op)) != NULL) Record_Free(r);
+    Arena_SetCurrent(plan->arena);
+
+    if(op->consume_batch && _ExecutionPlan_SupportsBatching(op)) {
+        // Batches are owned and recycled by the producing operations.
+        while(OpBase_ConsumeBatch(op) != NULL);
+    } else {
+        Record r;
+        while((r = op->consume(op)) != NULL) Record_Free(r);
+    }
+
+    if(plan->result_set) {
+        plan->result_set->stats.allocated_bytes = Arena_AllocatedBytes(plan->arena);
+    }
     return plan->result_set;
 }
 
@@ -493,8 +535,12 @@ void _ExecutionPlanFreeRecursive(OpBase* op) {
 void ExecutionPlanFree(ExecutionPlan *plan) {
     if (plan == NULL) return;
 
+    // Release arena allocations while the plan's arena is current.
+    Arena_SetCurrent(plan->arena);
     _ExecutionPlanFreeRecursive(plan->root);
     if(plan->filter_tree) FilterTree_Free(plan->filter_tree);
     if(plan->query_graph) QueryGraph_Free(plan->query_graph);
+    Arena_SetCurrent(NULL);
+    Arena_Free(plan->arena);
     free(plan);
 }
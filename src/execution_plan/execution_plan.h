@@ -13,6 +13,7 @@
 #include "../graph/graph.h"
 #include "../resultset/resultset.h"
 #include "../filter_tree/filter_tree.h"
+#include "../util/arena.h"
 
 
 /* StreamState
@@ -28,6 +29,7 @@ typedef struct {
     QueryGraph *query_graph;
     FT_FilterNode *filter_tree;
     ResultSet *result_set;
+    Arena *arena;           // Backs records and intermediate buffers.
 } ExecutionPlan;
 
 /* Creates a new execution plan from AST */
@@ -47,9 +49,17 @@ void ExecutionPlan_RemoveOp(OpBase *op);
 /* Adds operation to execution plan as a child of parent. */
 void ExecutionPlan_AddOp(OpBase *parent, OpBase *newOp);
 
+/* Introduce new operation b as a's parent,
+ * in between a and its former parent. */
+void ExecutionPlan_PushBelow(OpBase *a, OpBase *b);
+
 /* Replace a with b. */
 void ExecutionPlan_ReplaceOp(OpBase *a, OpBase *b);
 
+/* Locates the earliest operation within root's subtree
+ * by which every alias in references is resolved, NULL if there's none. */
+OpBase* ExecutionPlan_Locate_References(OpBase *root, Vector *references);
+
 /* Executes plan */
 ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan);
 
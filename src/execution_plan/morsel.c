@@ -0,0 +1,25 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./morsel.h"
+#include <assert.h>
+
+void MorselSource_Init(MorselSource *src, uint64_t end, uint64_t size) {
+    assert(src && size > 0);
+    src->next = 0;
+    src->end = end;
+    src->size = size;
+}
+
+bool MorselSource_Next(MorselSource *src, uint64_t *start, uint64_t *end) {
+    uint64_t s = __atomic_fetch_add(&src->next, src->size, __ATOMIC_RELAXED);
+    if(s >= src->end) return false;
+
+    *start = s;
+    *end = (s + src->size < src->end) ? s + src->size : src->end;
+    return true;
+}
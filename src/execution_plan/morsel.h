@@ -0,0 +1,31 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __MORSEL_H_
+#define __MORSEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MORSEL_SIZE 4096    // Default number of entity IDs in a morsel.
+
+/* MorselSource, splits a range of entity IDs into fixed size morsels
+ * handed out to scans running in parallel, each morsel is handed out
+ * exactly once, the source may be shared by multiple threads. */
+typedef struct {
+    uint64_t next;  // First ID of the next morsel, advanced atomically.
+    uint64_t end;   // End of scanned range.
+    uint64_t size;  // Number of IDs within a morsel.
+} MorselSource;
+
+// Initialize source to split [0, end) into morsels of size IDs.
+void MorselSource_Init(MorselSource *src, uint64_t end, uint64_t size);
+
+// Claims the next morsel [start, end), returns false once range is exhausted.
+bool MorselSource_Next(MorselSource *src, uint64_t *start, uint64_t *end);
+
+#endif
@@ -13,6 +13,10 @@ void OpBase_Init(OpBase *op) {
     op->childCount = 0;
     op->children = NULL;
     op->parent = NULL;
+    op->consume_batch = NULL;
+    op->clone = NULL;
+    op->batch = NULL;
+    op->estimate = -1;
 }
 
 void OpBase_Reset(OpBase *op) {
@@ -25,5 +29,21 @@ void OpBase_Free(OpBase *op) {
     op->free(op);
     if(op->children) free(op->children);
     if(op->modifies) Vector_Free(op->modifies);
+    if(op->batch) RecordBatch_Free(op->batch);
     free(op);
 }
+
+RecordBatch *OpBase_ConsumeBatch(OpBase *op) {
+    if(op->consume_batch) return op->consume_batch(op);
+
+    // Operation doesn't support batching, gather its records.
+    if(!op->batch) op->batch = RecordBatch_New(RECORD_BATCH_CAP);
+    RecordBatch *batch = op->batch;
+    for(batch->len = 0; batch->len < batch->cap; batch->len++) {
+        Record r = op->consume(op);
+        if(!r) break;
+        RecordBatch_Set(batch, batch->len, r);
+    }
+
+    return (batch->len) ? batch : NULL;
+}
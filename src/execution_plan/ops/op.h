@@ -9,6 +9,7 @@
 #define __OP_H__
 
 #include "../record.h"
+#include "../record_batch.h"
 #include "../../redismodule.h"
 #include "../../graph/query_graph.h"
 #include "../../graph/entities/node.h"
@@ -36,6 +37,11 @@ OPType_MERGE,
 OPType_UNWIND,
 OPType_SORT,
 OPType_PROJECT,
+OPType_ENTITY_COUNT,
+OPType_EXPAND_COUNT,
+OPType_GATHER,
+OPType_HASH_JOIN,
+OPType_EXPAND_INTO,
 } OPType;
 
 typedef enum {
@@ -49,19 +55,25 @@ struct OpBase;
 
 // typedef OpResult (*fpConsume)(struct OpBase*, Record r);
 typedef Record (*fpConsume)(struct OpBase*);
+typedef RecordBatch* (*fpConsumeBatch)(struct OpBase*);
 typedef OpResult (*fpReset)(struct OpBase*);
 typedef void (*fpFree)(struct OpBase*);
+typedef struct OpBase* (*fpClone)(struct OpBase*);
 
 struct OpBase {
     OPType type;                // Type of operation
     fpConsume consume;          // Produce next record.
+    fpConsumeBatch consume_batch;   // [optional] Produce next batch of records.
     fpReset reset;              // Reset operation state.
     fpFree free;                // Free operation.
+    fpClone clone;              // [optional] Duplicate operation, excluding its children.
     char *name;                 // Operation name.
     Vector *modifies;           // List of aliases, this op modifies.
     struct OpBase **children;   // Child operations.
     int childCount;             // Number of children.
     struct OpBase *parent;      // Parent operations.
+    RecordBatch *batch;         // Records produced by the last batch call.
+    double estimate;            // Estimated number of records produced, negative if unknown.
 };
 typedef struct OpBase OpBase;
 
@@ -69,4 +81,10 @@ void OpBase_Init(OpBase *op);
 void OpBase_Reset(OpBase *op);
 void OpBase_Free(OpBase *op);
 
+/* Produce next batch of records, returns NULL once op is depleted.
+ * Operations lacking consume_batch have their records gathered
+ * one at a time into op's batch. An operation is either consumed
+ * one record at a time or in batches, never both. */
+RecordBatch *OpBase_ConsumeBatch(OpBase *op);
+
 #endif
@@ -6,6 +6,7 @@
 */
 
 #include "op_aggregate.h"
+#include "op_gather.h"
 #include "../../util/arr.h"
 #include "../../util/rmalloc.h"
 #include "../../grouping/group.h"
@@ -54,15 +55,34 @@ static AR_ExpNode** _build_aggregated_expressions(Aggregate *op) {
 
     for(uint i = 0; i < exp_count; i++) {
         if(!op->expression_classification[i]) continue;
-        AST_ReturnElementNode *returnElement = return_node->returnElements[i];
-        AR_ExpNode *exp = AR_EXP_BuildFromAST(op->ast, returnElement->exp);
+        AR_ExpNode *exp;
+        if(op->weightRecIdx >= 0) {
+            // Weighted count, sum weights.
+            exp = AR_EXP_NewOpNode("sum", 1);
+            exp->op.children[0] = AR_EXP_NewRecordEntryNode(op->weightRecIdx);
+        } else {
+            AST_ReturnElementNode *returnElement = return_node->returnElements[i];
+            exp = AR_EXP_BuildFromAST(op->ast, returnElement->exp);
+        }
         agg_exps = array_append(agg_exps, exp);
     }
 
     return agg_exps;
 }
 
-static Group* _CreateGroup(Aggregate *op, Record r) {
+static void _AggregateGroups_Init(Aggregate *op, AggregateGroups *groups) {
+    uint32_t keyCount = array_len(op->none_aggregated_expressions);
+    groups->groups = CacheGroupNew();
+    groups->group = NULL;
+    groups->group_keys = (keyCount) ? rm_malloc(sizeof(SIValue) * keyCount) : NULL;
+}
+
+static void _AggregateGroups_Free(AggregateGroups *groups) {
+    FreeGroupCache(groups->groups);
+    if(groups->group_keys) rm_free(groups->group_keys);
+}
+
+static Group* _CreateGroup(Aggregate *op, AggregateGroups *groups, Record r) {
     /* Create a new group
      * Get a fresh copy of aggregation functions. */
     AR_ExpNode **agg_exps = _build_aggregated_expressions(op);
@@ -70,71 +90,49 @@ static Group* _CreateGroup(Aggregate *op, Record r) {
     /* Clone group keys. */
     size_t key_count = array_len(op->none_aggregated_expressions);
     SIValue *group_keys = rm_malloc(sizeof(SIValue) * key_count);
-    for(int i = 0; i < key_count; i++) group_keys[i] = op->group_keys[i];
+    for(int i = 0; i < key_count; i++) group_keys[i] = groups->group_keys[i];
 
     // There's no need to keep a reference to record
     // if we're not performing aggregations.
     if(!op->ast->orderNode) r = NULL;
-    op->group = NewGroup(key_count, group_keys, agg_exps, r);
+    groups->group = NewGroup(key_count, group_keys, agg_exps, r);
+    CacheGroupAdd(groups->groups, groups->group);
 
-    return op->group;
+    return groups->group;
 }
 
 /* Retrieves group under which given record belongs to,
  * creates group if one doesn't exists. */
-static Group* _GetGroup(Aggregate *op, Record r) {
+static Group* _GetGroup(Aggregate *op, AggregateGroups *groups, Record r) {
     // GroupBy without none-aggregated fields.
-    if(!op->group_keys) {
-        if(!op->group) {
-            op->group = _CreateGroup(op, r);
-            CacheGroupAdd(op->groups, "SINGLE_GROUP", op->group);
-        }
-        return op->group;
+    uint32_t expCount = array_len(op->none_aggregated_expressions);
+    if(!expCount) {
+        if(!groups->group) _CreateGroup(op, groups, r);
+        return groups->group;
     }
 
     // GroupBy with none-aggregated fields.
     // Evaluate none-aggregated fields, see if they match
     // the last accessed group.
-    bool reuseLastAccessedGroup = true;
-    uint32_t expCount = array_len(op->none_aggregated_expressions);
     for(int i = 0; i < expCount; i++) {
         AR_ExpNode *exp = op->none_aggregated_expressions[i];
-        op->group_keys[i] = AR_EXP_Evaluate(exp, r);
-        if( reuseLastAccessedGroup &&
-            op->group &&
-            SIValue_Compare(op->group->keys[i], op->group_keys[i]) == 0 ) {
-            reuseLastAccessedGroup = true;
-        } else {
-            reuseLastAccessedGroup = false;
-        }
+        groups->group_keys[i] = AR_EXP_Evaluate(exp, r);
     }
 
     // See if we can reuse last accessed group.
-    if(reuseLastAccessedGroup) return op->group;
-
-    // Can't reuse last accessed group, lookup group by
-    // its identifier key.
-    char *group_key;
-
-    // Determine required size for group key string representation.
-    size_t group_len_key = SIValue_StringConcatLen(op->group_keys, expCount);
-    // TODO: should be fine, due to JMalloc memory pools
-    // maybe we should have a reusable buffer.
-    group_key = rm_malloc(sizeof(char) * group_len_key);
-    SIValue_StringConcat(op->group_keys, expCount, group_key, group_len_key);
-
-    op->group = CacheGroupGet(op->groups, group_key);
-    if(!op->group) {
-        op->group = _CreateGroup(op, r);
-        CacheGroupAdd(op->groups, group_key, op->group);
+    if(groups->group && CacheGroupKeysMatch(groups->group->keys, groups->group_keys, expCount)) {
+        return groups->group;
     }
-    rm_free(group_key);
-    return op->group;
+
+    // Can't reuse last accessed group, lookup group by its keys.
+    groups->group = CacheGroupGet(groups->groups, groups->group_keys, expCount);
+    if(!groups->group) _CreateGroup(op, groups, r);
+    return groups->group;
 }
 
-static void _aggregateRecord(Aggregate *op, Record r) {
+static void _aggregateRecord(Aggregate *op, AggregateGroups *groups, Record r) {
     /* Get group */
-    Group* group = _GetGroup(op, r);
+    Group* group = _GetGroup(op, groups, r);
     assert(group);
 
     // Aggregate group expressions.
@@ -145,12 +143,67 @@ static void _aggregateRecord(Aggregate *op, Record r) {
     }
 }
 
+// Partial aggregation performed by a single Gather worker.
+typedef struct {
+    Aggregate *op;
+    AggregateGroups groups;
+} AggregatePartial;
+
+static void _aggregatePartial(OpBase *pipeline, void *ctx) {
+    AggregatePartial *partial = (AggregatePartial*)ctx;
+    Record r;
+    while((r = pipeline->consume(pipeline))) {
+        _aggregateRecord(partial->op, &partial->groups, r);
+        Record_Free(r);
+    }
+}
+
+/* Merges groups aggregated by a worker into op's groups,
+ * groups missing from op are moved as is. */
+static void _mergeGroups(Aggregate *op, AggregateGroups *partial) {
+    Group *group;
+    while((group = CacheGroupPop(partial->groups))) {
+        Group *merged = CacheGroupGet(op->groups.groups, group->keys, group->key_count);
+        if(!merged) {
+            CacheGroupAdd(op->groups.groups, group);
+            continue;
+        }
+
+        uint32_t aggFuncCount = array_len(merged->aggregationFunctions);
+        for(int i = 0; i < aggFuncCount; i++) {
+            AR_EXP_Combine(merged->aggregationFunctions[i], group->aggregationFunctions[i]);
+        }
+        FreeGroup(group);
+    }
+}
+
+/* Each of gather's workers aggregates the records it produces
+ * into groups of its own, which are then merged. */
+static void _aggregateParallel(Aggregate *op, OpBase *gather) {
+    int workerCount = ((Gather*)gather)->workerCount;
+    AggregatePartial *partials = rm_malloc(sizeof(AggregatePartial) * workerCount);
+    void **ctxs = rm_malloc(sizeof(void*) * workerCount);
+    for(int i = 0; i < workerCount; i++) {
+        partials[i].op = op;
+        _AggregateGroups_Init(op, &partials[i].groups);
+        ctxs[i] = partials + i;
+    }
+
+    Gather_Run(gather, _aggregatePartial, ctxs);
+
+    for(int i = 0; i < workerCount; i++) {
+        _mergeGroups(op, &partials[i].groups);
+        _AggregateGroups_Free(&partials[i].groups);
+    }
+    rm_free(ctxs);
+    rm_free(partials);
+}
+
 /* Returns a record populated with group data. */
 static Record _handoff(Aggregate *op) {
-    char *key;
     Group *group;
     if(!op->groupIter) return NULL;
-    if(!CacheGroupIterNext(op->groupIter, &key, &group)) return NULL;
+    if(!CacheGroupIterNext(op->groupIter, &group)) return NULL;
 
     // New record with len |return elements|
     int returnElemCount = array_len(op->ast->returnNode->returnElements);
@@ -206,10 +259,11 @@ OpBase* NewAggregateOp(ResultSet *resultset) {
     aggregate->none_aggregated_expressions = NULL;
     aggregate->expression_classification = NULL;
     aggregate->order_expressions = NULL;
-    aggregate->group_keys = NULL;
-    aggregate->groups = CacheGroupNew();
+    aggregate->groups.groups = NULL;
+    aggregate->groups.group = NULL;
+    aggregate->groups.group_keys = NULL;
     aggregate->groupIter = NULL;
-    aggregate->group = NULL;
+    aggregate->weightRecIdx = -1;
 
     OpBase_Init(&aggregate->op);
     aggregate->op.name = "Aggregate";
@@ -221,27 +275,34 @@ OpBase* NewAggregateOp(ResultSet *resultset) {
     return (OpBase*)aggregate;
 }
 
+void AggregateSetWeight(OpBase *opBase, int idx) {
+    Aggregate *op = (Aggregate*)opBase;
+    op->weightRecIdx = idx;
+}
+
 Record AggregateConsume(OpBase *opBase) {
     Aggregate *op = (Aggregate*)opBase;
     OpBase *child = op->op.children[0];
 
     if(!op->init) {
         _build_expressions(op);
-        /* Allocate memory for group keys. */
-        uint32_t noneAggExpCount = array_len(op->none_aggregated_expressions);
-        if(noneAggExpCount) op->group_keys = rm_malloc(sizeof(SIValue) * noneAggExpCount);
+        _AggregateGroups_Init(op, &op->groups);
         op->init = 1;
     }
 
     if(op->groupIter) return _handoff(op);
 
-    Record r;
-    while((r = child->consume(child))) {
-        _aggregateRecord(op, r);
-        Record_Free(r);
+    if(child->type == OPType_GATHER) {
+        _aggregateParallel(op, child);
+    } else {
+        Record r;
+        while((r = child->consume(child))) {
+            _aggregateRecord(op, &op->groups, r);
+            Record_Free(r);
+        }
     }
 
-    op->groupIter = CacheGroupIter(op->groups);
+    op->groupIter = CacheGroupIter(op->groups.groups);
 
     return _handoff(op);
 }
@@ -249,8 +310,11 @@ Record AggregateConsume(OpBase *opBase) {
 OpResult AggregateReset(OpBase *opBase) {
     Aggregate *op = (Aggregate*)opBase;
 
-    FreeGroupCache(op->groups);
-    op->groups = CacheGroupNew();
+    if(op->init) {
+        FreeGroupCache(op->groups.groups);
+        op->groups.groups = CacheGroupNew();
+        op->groups.group = NULL;
+    }
 
     if(op->groupIter) {
         CacheGroupIterator_Free(op->groupIter);
@@ -264,7 +328,6 @@ void AggregateFree(OpBase *opBase) {
     Aggregate *op = (Aggregate*)opBase;
     if(!op) return;
 
-    if(op->group_keys) rm_free(op->group_keys);
     if(op->groupIter) CacheGroupIterator_Free(op->groupIter);
     if(op->expression_classification) rm_free(op->expression_classification);
 
@@ -280,5 +343,5 @@ void AggregateFree(OpBase *opBase) {
         rm_free(op->order_expressions);
     }
 
-    FreeGroupCache(op->groups);
+    if(op->init) _AggregateGroups_Free(&op->groups);
 }
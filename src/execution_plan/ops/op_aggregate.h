@@ -16,9 +16,18 @@
 #include "../../grouping/group_cache.h"
 #include "../../arithmetic/arithmetic_expression.h"
 
+/* Groups aggregated by a single thread. */
+typedef struct {
+    CacheGroup *groups;
+    Group *group;                               /* Last accessed group. */
+    SIValue *group_keys;                        /* Array of values composing an aggregated group. */
+} AggregateGroups;
+
 /* Aggregate
  * aggregates graph according to  
- * return clause */
+ * return clause. When consuming a Gather operation
+ * each worker aggregates into groups of its own,
+ * which are merged once all workers are done. */
  typedef struct {
     OpBase op;
     AST *ast;
@@ -26,14 +35,18 @@
     AR_ExpNode **none_aggregated_expressions;   /* Array of arithmetic expression. */
     AR_ExpNode **order_expressions;             /* Array of arithmetic expression. */
     int *expression_classification;             /* 1 if RETURN_CLAUSE[i] is aggregated, 0 otherwise.  */
-    SIValue *group_keys;                        /* Array of values composing an aggregated group. */
-    TrieMap *groups;
+    AggregateGroups groups;                     /* Groups aggregated by the calling thread. */
     CacheGroupIterator *groupIter;
-    Group *group;                               /* Last accessed group. */
+    int weightRecIdx;                           /* Record position holding the number of records each consumed record accounts for, -1 if unweighted. */
     int init;
  } Aggregate;
 
 OpBase* NewAggregateOp(ResultSet *resultset);
+
+/* Consumed records are weighted by the count at record position idx,
+ * every aggregated return element must be a count, which is
+ * computed as the sum of weights. */
+void AggregateSetWeight(OpBase *opBase, int idx);
 Record AggregateConsume(OpBase *opBase);
 OpResult AggregateReset(OpBase *opBase);
 void AggregateFree(OpBase *opBase);
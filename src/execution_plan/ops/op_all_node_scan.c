@@ -10,7 +10,10 @@
 
 OpBase* NewAllNodeScanOp(const Graph *g, Node *n) {
     AllNodeScan *allNodeScan = malloc(sizeof(AllNodeScan));
+    allNodeScan->g = g;
+    allNodeScan->node = n;
     allNodeScan->iter = Graph_ScanNodes(g);
+    allNodeScan->morsels = NULL;
 
     AST *ast = AST_GetFromLTS();
     allNodeScan->nodeRecIdx = AST_GetAliasID(ast, n->alias);
@@ -21,8 +24,10 @@ OpBase* NewAllNodeScanOp(const Graph *g, Node *n) {
     allNodeScan->op.name = "All Node Scan";
     allNodeScan->op.type = OPType_ALL_NODE_SCAN;
     allNodeScan->op.consume = AllNodeScanConsume;
+    allNodeScan->op.consume_batch = AllNodeScanConsumeBatch;
     allNodeScan->op.reset = AllNodeScanReset;
     allNodeScan->op.free = AllNodeScanFree;
+    allNodeScan->op.clone = AllNodeScanClone;
     allNodeScan->op.modifies = NewVector(char*, 1);
 
     Vector_Push(allNodeScan->op.modifies, n->alias);
@@ -30,10 +35,36 @@ OpBase* NewAllNodeScanOp(const Graph *g, Node *n) {
     return (OpBase*)allNodeScan;
 }
 
+OpBase* AllNodeScanClone(OpBase *opBase) {
+    AllNodeScan *op = (AllNodeScan*)opBase;
+    return NewAllNodeScanOp(op->g, op->node);
+}
+
+void AllNodeScanSetMorsels(OpBase *opBase, MorselSource *morsels) {
+    AllNodeScan *op = (AllNodeScan*)opBase;
+    op->morsels = morsels;
+    // Nothing is scanned until the first morsel is claimed.
+    DataBlockIterator_Free(op->iter);
+    op->iter = Graph_ScanNodesRange(op->g, 0, 0);
+}
+
+// Returns next scanned entity, moving on to the next morsel if required.
+static Entity *_AllNodeScan_Next(AllNodeScan *op) {
+    Entity *en;
+    uint64_t start;
+    uint64_t end;
+    while((en = (Entity*)DataBlockIterator_Next(op->iter)) == NULL) {
+        if(!op->morsels || !MorselSource_Next(op->morsels, &start, &end)) break;
+        DataBlockIterator_Free(op->iter);
+        op->iter = Graph_ScanNodesRange(op->g, start, end);
+    }
+    return en;
+}
+
 Record AllNodeScanConsume(OpBase *opBase) {
     AllNodeScan *op = (AllNodeScan*)opBase;
 
-    Entity *en = (Entity*)DataBlockIterator_Next(op->iter);
+    Entity *en = _AllNodeScan_Next(op);
     if(en == NULL) return NULL;
     
     Record r = Record_New(op->recLength);
@@ -43,6 +74,23 @@ Record AllNodeScanConsume(OpBase *opBase) {
     return r;
 }
 
+RecordBatch *AllNodeScanConsumeBatch(OpBase *opBase) {
+    AllNodeScan *op = (AllNodeScan*)opBase;
+    if(!op->op.batch) op->op.batch = RecordBatch_New(RECORD_BATCH_CAP);
+    RecordBatch *batch = op->op.batch;
+
+    for(batch->len = 0; batch->len < batch->cap; batch->len++) {
+        Entity *en = _AllNodeScan_Next(op);
+        if(en == NULL) break;
+
+        Record r = RecordBatch_Slot(batch, batch->len, op->recLength);
+        Node *n = Record_GetNode(r, op->nodeRecIdx);
+        n->entity = en;
+    }
+
+    return (batch->len) ? batch : NULL;
+}
+
 OpResult AllNodeScanReset(OpBase *op) {
     AllNodeScan *allNodeScan = (AllNodeScan*)op;
     DataBlockIterator_Reset(allNodeScan->iter);
@@ -12,19 +12,26 @@
 #include "../../graph/graph.h"
 #include "../../graph/query_graph.h"
 #include "../../graph/entities/node.h"
+#include "../morsel.h"
 #include "../../util/datablock/datablock_iterator.h"
 
 /* AllNodesScan
  * Scans entire graph */
  typedef struct {
     OpBase op;
+    const Graph *g;
+    Node *node;                 // Node being scanned.
     DataBlockIterator *iter;
+    MorselSource *morsels;      // Shared ID ranges when scanning in parallel, NULL otherwise.
     uint nodeRecIdx;
     uint recLength;  // Number of entries in a record.
  } AllNodeScan;
 
 OpBase* NewAllNodeScanOp(const Graph *g, Node *n);
+OpBase* AllNodeScanClone(OpBase *opBase);
+void AllNodeScanSetMorsels(OpBase *opBase, MorselSource *morsels);
 Record AllNodeScanConsume(OpBase *opBase);
+RecordBatch *AllNodeScanConsumeBatch(OpBase *opBase);
 OpResult AllNodeScanReset(OpBase *op);
 void AllNodeScanFree(OpBase *ctx);
 
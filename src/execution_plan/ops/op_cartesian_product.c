@@ -7,6 +7,7 @@
 
 #include "op_cartesian_product.h"
 #include "../../parser/ast.h"
+#include "../../util/arr.h"
 
 OpBase* NewCartesianProductOp() {
     CartesianProduct *cp = malloc(sizeof(CartesianProduct));
@@ -14,6 +15,8 @@ OpBase* NewCartesianProductOp() {
 
     AST *ast = AST_GetFromLTS();
     cp->r = Record_New(AST_AliasCount(ast));
+    cp->streams = NULL;
+    cp->bufferCap = CARTESIAN_PRODUCT_BUFFER_CAP;
 
     // Set our Op operations
     OpBase_Init(&cp->op);
@@ -26,33 +29,83 @@ OpBase* NewCartesianProductOp() {
     return (OpBase*)cp;
 }
 
-static void _ResetStreams(CartesianProduct *cp, int streamIdx) {
-    // Reset each child stream, Reset propagates upwards.
-    for(int i = 0; i < streamIdx; i++) OpBase_Reset(cp->op.children[i]);    
+static void _InitStreams(CartesianProduct *op) {
+    op->streams = malloc(sizeof(CartesianProductStream) * op->op.childCount);
+    for(int i = 0; i < op->op.childCount; i++) {
+        op->streams[i].records = array_new(Record, 0);
+        op->streams[i].pos = 0;
+        // Last stream is never reset, as such it's not buffered.
+        op->streams[i].buffer = (i < op->op.childCount - 1);
+        op->streams[i].buffered = false;
+    }
+}
+
+static void _DiscardBuffer(CartesianProductStream *stream) {
+    for(uint i = 0; i < array_len(stream->records); i++) Record_Free(stream->records[i]);
+    array_clear(stream->records);
+}
+
+static void _FreeStreams(CartesianProduct *op) {
+    if(!op->streams) return;
+    for(int i = 0; i < op->op.childCount; i++) {
+        _DiscardBuffer(op->streams + i);
+        array_free(op->streams[i].records);
+    }
+    free(op->streams);
+    op->streams = NULL;
+}
+
+/* Merges next record of stream into op's record,
+ * returns false once stream is depleted. */
+static bool _PullFromStream(CartesianProduct *op, int streamIdx) {
+    CartesianProductStream *stream = op->streams + streamIdx;
+    if(stream->buffered) {
+        if(stream->pos == array_len(stream->records)) return false;
+        Record_Merge(op->r, stream->records[stream->pos++]);
+        return true;
+    }
+
+    OpBase *child = op->op.children[streamIdx];
+    Record childRecord = child->consume(child);
+    if(!childRecord) {
+        // Stream depleted, replay its records from now on.
+        stream->buffered = stream->buffer;
+        return false;
+    }
+
+    Record_Merge(op->r, childRecord);
+    if(stream->buffer) {
+        if(array_len(stream->records) < op->bufferCap) {
+            stream->records = array_append(stream->records, childRecord);
+            return true;
+        }
+        // Too many records, fall back to re-executing stream.
+        _DiscardBuffer(stream);
+        stream->buffer = false;
+    }
+    Record_Free(childRecord);
+    return true;
+}
+
+static void _ResetStreams(CartesianProduct *op, int streamIdx) {
+    for(int i = 0; i < streamIdx; i++) {
+        CartesianProductStream *stream = op->streams + i;
+        // Reset each child stream, Reset propagates upwards.
+        if(stream->buffered) stream->pos = 0;
+        else OpBase_Reset(op->op.children[i]);
+    }
 }
 
 static int _PullFromStreams(CartesianProduct *op) {
     for(int i = 1; i < op->op.childCount; i++) {
-        OpBase *child = op->op.children[i];
-        Record childRecord = child->consume(child);
-
-        if(childRecord) {
-            Record_Merge(op->r, childRecord);
-            Record_Free(childRecord);
+        if(_PullFromStream(op, i)) {
             /* Managed to get new data
              * Reset streams [0-i] */
             _ResetStreams(op, i);
 
             // Pull from resetted streams.
             for(int j = 0; j < i; j++) {
-                child = op->op.children[j];
-                childRecord = child->consume(child);
-                if(childRecord) {
-                    Record_Merge(op->r, childRecord);
-                    Record_Free(childRecord);                    
-                } else {
-                    return 0;
-                }
+                if(!_PullFromStream(op, j)) return 0;
             }
             // Ready to continue.
             return 1;
@@ -66,36 +119,20 @@ static int _PullFromStreams(CartesianProduct *op) {
 
 Record CartesianProductConsume(OpBase *opBase) {
     CartesianProduct *op = (CartesianProduct*)opBase;
-    OpResult res;
-    OpBase *child;
-    Record childRecord;
 
     if(op->init) {
         op->init = false;
+        if(!op->streams) _InitStreams(op);
 
         for(int i = 0; i < op->op.childCount; i++) {
-            child = op->op.children[i];
-            childRecord = child->consume(child);
-            if(!childRecord) return NULL;
-            Record_Merge(op->r, childRecord);
-            Record_Free(childRecord);
+            if(!_PullFromStream(op, i)) return NULL;
         }
         return Record_Clone(op->r);
     }
 
-    // Pull from first stream.
-    child = op->op.children[0];
-    childRecord = child->consume(child);
-        
-    if(childRecord) {
-        // Managed to get data from first stream.
-        Record_Merge(op->r, childRecord);
-        Record_Free(childRecord);
-    } else {
-        // Failed to get data from first stream,
-        // try pulling other streams for data.
-        if(!_PullFromStreams(op)) return NULL;
-    }
+    // Pull from first stream, failing that
+    // try pulling other streams for data.
+    if(!_PullFromStream(op, 0) && !_PullFromStreams(op)) return NULL;
 
     // Pass down a clone of record.
     return Record_Clone(op->r);
@@ -104,10 +141,14 @@ Record CartesianProductConsume(OpBase *opBase) {
 OpResult CartesianProductReset(OpBase *opBase) {
     CartesianProduct *op = (CartesianProduct*)opBase;
     op->init = true;
+
+    // Child streams are reset as well, buffering restarts.
+    _FreeStreams(op);
     return OP_OK;
 }
 
 void CartesianProductFree(OpBase *opBase) {
     CartesianProduct *op = (CartesianProduct*)opBase;
     Record_Free(op->r);
+    _FreeStreams(op);
 }
@@ -10,14 +10,27 @@
 
 #include "op.h"
 
-/* Cartesian product AKA Join. 
- * Currently this operation is a NOP 
- * once execution plan refactoring will take place 
- * we'll implement its logic. */
+#define CARTESIAN_PRODUCT_BUFFER_CAP 65536    // Maximum number of records buffered per stream.
+
+// Child stream of cartesian product.
+typedef struct {
+    Record *records;    // array_t of records consumed from stream.
+    uint pos;           // Position of next buffered record to replay.
+    bool buffer;        // Records are buffered for replay.
+    bool buffered;      // Stream depleted, replay buffered records.
+} CartesianProductStream;
+
+/* Cartesian product AKA Join.
+ * Every stream but the last is consumed repeatedly, once per combination
+ * of records from the following streams. Each such stream is executed once,
+ * its records buffered and replayed thereafter, streams producing
+ * more than bufferCap records are re-executed instead. */
  typedef struct {
      OpBase op;
      bool init;
      Record r;
+     CartesianProductStream *streams;   // Child streams, created once execution starts.
+     uint bufferCap;                    // Maximum number of records buffered per stream.
  } CartesianProduct;
 
 OpBase* NewCartesianProductOp();
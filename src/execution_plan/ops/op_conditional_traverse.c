@@ -9,6 +9,10 @@
 #include "../../util/arr.h"
 #include "../../GraphBLASExt/GxB_Delete.h"
 
+#define TRAVERSE_MIN_RECORDS 16             // Initial number of records traversed at once.
+#define TRAVERSE_MAX_RECORDS 4096           // Maximum number of records traversed at once.
+#define TRAVERSE_RESULT_BUDGET (1 << 20)    // Number of entries in M above which batch shrinks.
+
 static void _setupTraversedRelations(CondTraverse *op) {
     AST *ast = AST_GetFromLTS();
     GraphContext *gc = GraphContext_GetFromLTS();
@@ -41,64 +45,109 @@ static int _CondTraverse_SetEdge(CondTraverse *op, Record r) {
     return 1;
 }
 
+// Sets number of records traversed at once,
+// growing record and filter tuple buffers as required.
+static void _CondTraverse_SetRecordsCap(CondTraverse *op, int cap) {
+    int prevCap = op->recordsCap;
+    op->recordsCap = cap;
+    if(cap <= prevCap) return;
+
+    op->records = rm_realloc(op->records, sizeof(Record) * cap);
+    op->filterRows = rm_realloc(op->filterRows, sizeof(GrB_Index) * cap);
+    op->filterCols = rm_realloc(op->filterCols, sizeof(GrB_Index) * cap);
+    op->filterVals = rm_realloc(op->filterVals, sizeof(bool) * cap);
+    for(int i = prevCap; i < cap; i++) {
+        op->records[i] = NULL;
+        op->filterCols[i] = i;
+        op->filterVals[i] = true;
+    }
+}
+
+/* Adapt number of records traversed at once:
+ * grow while child operation fills entire batches,
+ * shrink once the result matrix exceeds its budget. */
+static void _CondTraverse_AdaptRecordsCap(CondTraverse *op, int consumed) {
+    GrB_Index nvals = 0;
+    GrB_Matrix_nvals(&nvals, op->M);
+
+    if(nvals > TRAVERSE_RESULT_BUDGET) {
+        op->recordsCap = MAX(TRAVERSE_MIN_RECORDS, op->recordsCap / 2);
+    } else if(consumed == op->recordsCap && op->recordsCap < op->recordsMax) {
+        _CondTraverse_SetRecordsCap(op, MIN(op->recordsMax, op->recordsCap * 2));
+    }
+}
+
 /* Evaluate algebraic expression:
- * appends filter matrix as the right most operand 
- * perform multiplications 
+ * builds filter matrix from collected tuples
+ * multiplies expression by filter matrix
  * set iterator over result matrix
- * removed filter matrix from original expression
  * clears filter matrix. */
-void _traverse(CondTraverse *op) {
-    // Append matrix to algebraic expression, as the right most operand.
-    AlgebraicExpression_AppendTerm(op->algebraic_expression, op->F, false, false);
+void _traverse(CondTraverse *op, int recordCount) {
+    // F[srcId, i] = true for each of the collected records.
+    GrB_Matrix_build_BOOL(op->F, op->filterRows, op->filterCols, op->filterVals, recordCount, GrB_LOR);
 
-    // Evaluate expression.
-    AlgebraicExpression_Execute(op->algebraic_expression, op->M);
-    
-    // Remove operand.
-    AlgebraicExpression_RemoveTerm(op->algebraic_expression, op->algebraic_expression->operand_count-1, NULL);
+    // Evaluate expression, multiplying by F from the right,
+    // the expression's product is cached across batches.
+    AlgebraicExpression_MultiplyRight(op->algebraic_expression, op->F, op->M);
 
     if(op->iter == NULL) GxB_MatrixTupleIter_new(&op->iter, op->M);
     else GxB_MatrixTupleIter_reuse(op->iter, op->M);
 
     // Clear filter matrix.
     GrB_Matrix_clear(op->F);
+
+    _CondTraverse_AdaptRecordsCap(op, recordCount);
 }
 
 // Determin the maximum number of records
 // which will be considered when evaluating an algebraic expression.
 static int _determinRecordCap(const AST *ast) {
-    int recordsCap = 16;    // Default.
+    int recordsCap = TRAVERSE_MAX_RECORDS;
     if(ast->limitNode) recordsCap = MIN(recordsCap, ast->limitNode->limit);
-    return recordsCap;
+    return MAX(recordsCap, 1);
 }
 
 OpBase* NewCondTraverseOp(Graph *g, AlgebraicExpression *algebraic_expression) {
     CondTraverse *traverse = calloc(1, sizeof(CondTraverse));
     traverse->graph = g;
     traverse->algebraic_expression = algebraic_expression;
+    AlgebraicExpression_AttachTransposed(algebraic_expression, g);
+    GraphContext *gc = GraphContext_GetFromLTS();
+    AlgebraicExpression_SetPathCache(algebraic_expression, g, gc->path_cache);
     traverse->edgeRelationTypes = NULL;
     traverse->F = NULL;    
     traverse->iter = NULL;
     traverse->edges = NULL;
     traverse->r = NULL;    
+    traverse->input = NULL;
+    traverse->inputOffset = 0;
+    traverse->inputLen = 0;
 
     AST *ast = AST_GetFromLTS();
     traverse->srcNodeRecIdx = AST_GetAliasID(ast, algebraic_expression->src_node->alias);
     traverse->destNodeRecIdx = AST_GetAliasID(ast, algebraic_expression->dest_node->alias);
     
     traverse->recordsLen = 0;
-    traverse->recordsCap = _determinRecordCap(ast);
-    traverse->records = rm_calloc(traverse->recordsCap, sizeof(Record));
-    GrB_Matrix_new(&traverse->M, GrB_BOOL, Graph_RequiredMatrixDim(g), traverse->recordsCap);
-    GrB_Matrix_new(&traverse->F, GrB_BOOL, Graph_RequiredMatrixDim(g), traverse->recordsCap);
+    traverse->recordsCap = 0;
+    traverse->records = NULL;
+    traverse->filterRows = NULL;
+    traverse->filterCols = NULL;
+    traverse->filterVals = NULL;
+    traverse->recordsMax = _determinRecordCap(ast);
+    _CondTraverse_SetRecordsCap(traverse, MIN(TRAVERSE_MIN_RECORDS, traverse->recordsMax));
+    // F and M are sized for the widest batch, narrower batches leave columns empty.
+    GrB_Matrix_new(&traverse->M, GrB_BOOL, Graph_RequiredMatrixDim(g), traverse->recordsMax);
+    GrB_Matrix_new(&traverse->F, GrB_BOOL, Graph_RequiredMatrixDim(g), traverse->recordsMax);
 
     // Set our Op operations
     OpBase_Init(&traverse->op);
     traverse->op.name = "Conditional Traverse";
     traverse->op.type = OPType_CONDITIONAL_TRAVERSE;
     traverse->op.consume = CondTraverseConsume;
+    traverse->op.consume_batch = CondTraverseConsumeBatch;
     traverse->op.reset = CondTraverseReset;
     traverse->op.free = CondTraverseFree;
+    traverse->op.clone = CondTraverseClone;
     traverse->op.modifies = NewVector(char*, 1);
 
     char *modified = NULL;    
@@ -116,6 +165,35 @@ OpBase* NewCondTraverseOp(Graph *g, AlgebraicExpression *algebraic_expression) {
     return (OpBase*)traverse;
 }
 
+OpBase* CondTraverseClone(OpBase *opBase) {
+    CondTraverse *op = (CondTraverse*)opBase;
+    AlgebraicExpression *ae = AlgebraicExpression_Clone(op->algebraic_expression);
+    return NewCondTraverseOp(op->graph, ae);
+}
+
+// Resolves edges connecting current record's source and destination nodes.
+static void _CondTraverse_CollectEdges(CondTraverse *op) {
+    Node *srcNode;
+    Node *destNode;
+    size_t operandCount = op->algebraic_expression->operand_count - 1;
+
+    if(op->algebraic_expression->operands[operandCount].transpose) {
+        srcNode = Record_GetNode(op->r, op->destNodeRecIdx);
+        destNode = Record_GetNode(op->r, op->srcNodeRecIdx);
+    } else {
+        srcNode = Record_GetNode(op->r, op->srcNodeRecIdx);
+        destNode = Record_GetNode(op->r, op->destNodeRecIdx);
+    }
+
+    for(int i = 0; i < op->edgeRelationCount; i++) {
+        Graph_GetEdgesConnectingNodes(op->graph,
+                                    ENTITY_GET_ID(srcNode),
+                                    ENTITY_GET_ID(destNode),
+                                    op->edgeRelationTypes[i],
+                                    &op->edges);
+    }
+}
+
 /* CondTraverseConsume next operation 
  * each call will update the graph
  * returns OP_DEPLETED when no additional updates are available */
@@ -152,19 +230,16 @@ Record CondTraverseConsume(OpBase *opBase) {
             Record childRecord = child->consume(child);
             if(!childRecord) break;
 
-            // Store received record.
+            // Store received record and its source node ID.
             op->records[op->recordsLen] = childRecord;
-            /* Update filter matrix F, set column i at position srcId
-             * F[srcId, i] = true. */
             Node *n = Record_GetNode(childRecord, op->srcNodeRecIdx);
-            NodeID srcId = ENTITY_GET_ID(n);
-            GrB_Matrix_setElement_BOOL(op->F, true, srcId, op->recordsLen);
+            op->filterRows[op->recordsLen] = ENTITY_GET_ID(n);
         }
 
         // No data.
         if(op->recordsLen == 0) return NULL;
 
-        _traverse(op);
+        _traverse(op, op->recordsLen);
     }
 
     /* Get node from current column. */
@@ -174,44 +249,85 @@ Record CondTraverseConsume(OpBase *opBase) {
 
     if(op->algebraic_expression->edge != NULL) {
         // We're guarantee to have at least one edge.
-        Node *srcNode;
-        Node *destNode;
-        size_t operandCount = op->algebraic_expression->operand_count - 1;
-
-        if(op->algebraic_expression->operands[operandCount].transpose) {
-            srcNode = Record_GetNode(op->r, op->destNodeRecIdx);
-            destNode = Record_GetNode(op->r, op->srcNodeRecIdx);
-        } else {
-            srcNode = Record_GetNode(op->r, op->srcNodeRecIdx);
-            destNode = Record_GetNode(op->r, op->destNodeRecIdx);
+        _CondTraverse_CollectEdges(op);
+        _CondTraverse_SetEdge(op, op->r);
+    }
+
+    return Record_Clone(op->r);
+}
+
+// Appends a copy of current record to batch.
+static void _CondTraverse_Emit(CondTraverse *op, RecordBatch *batch) {
+    Record r = RecordBatch_Slot(batch, batch->len, Record_length(op->r));
+    Record_Copy(r, op->r);
+    batch->len++;
+}
+
+RecordBatch *CondTraverseConsumeBatch(OpBase *opBase) {
+    CondTraverse *op = (CondTraverse*)opBase;
+    OpBase *child = op->op.children[0];
+    if(!op->op.batch) op->op.batch = RecordBatch_New(RECORD_BATCH_CAP);
+    RecordBatch *batch = op->op.batch;
+    bool withEdge = (op->algebraic_expression->edge != NULL);
+
+    batch->len = 0;
+    while(batch->len < batch->cap) {
+        // Emit a record for each edge connecting current nodes.
+        if(withEdge && op->r && _CondTraverse_SetEdge(op, op->r)) {
+            _CondTraverse_Emit(op, batch);
+            continue;
         }
 
-        for(int i = 0; i < op->edgeRelationCount; i++) {
-            Graph_GetEdgesConnectingNodes(op->graph,
-                                        ENTITY_GET_ID(srcNode),
-                                        ENTITY_GET_ID(destNode),
-                                        op->edgeRelationTypes[i],
-                                        &op->edges);
+        bool depleted = true;
+        NodeID src_id = INVALID_ENTITY_ID;
+        NodeID dest_id = INVALID_ENTITY_ID;
+        if(op->iter) GxB_MatrixTupleIter_next(op->iter, &dest_id, &src_id, &depleted);
+
+        if(depleted) {
+            // Move on to the next chunk of input records.
+            op->r = NULL;
+            op->inputOffset += op->inputLen;
+            if(!op->input || op->inputOffset >= op->input->len) {
+                op->input = OpBase_ConsumeBatch(child);
+                op->inputOffset = 0;
+                if(!op->input) break;
+            }
+
+            op->inputLen = MIN(op->recordsCap, op->input->len - op->inputOffset);
+            for(uint i = 0; i < op->inputLen; i++) {
+                Record childRecord = op->input->records[op->inputOffset + i];
+                Node *n = Record_GetNode(childRecord, op->srcNodeRecIdx);
+                op->filterRows[i] = ENTITY_GET_ID(n);
+            }
+            _traverse(op, op->inputLen);
+            continue;
         }
 
-        _CondTraverse_SetEdge(op, op->r);
+        op->r = op->input->records[op->inputOffset + src_id];
+        Node *destNode = Record_GetNode(op->r, op->destNodeRecIdx);
+        Graph_GetNode(op->graph, dest_id, destNode);
+
+        if(withEdge) _CondTraverse_CollectEdges(op);
+        else _CondTraverse_Emit(op, batch);
     }
 
-    return Record_Clone(op->r);
+    return (batch->len) ? batch : NULL;
 }
 
 OpResult CondTraverseReset(OpBase *ctx) {
     CondTraverse *op = (CondTraverse*)ctx;
-    if(op->r) Record_Free(op->r);
+    // In batch mode current record is owned by child's batch.
+    if(op->r && !op->input) Record_Free(op->r);
+    op->r = NULL;
+    op->input = NULL;
+    op->inputOffset = 0;
+    op->inputLen = 0;
     if(op->edges) array_clear(op->edges);
     if(op->iter) {
         GxB_MatrixTupleIter_free(op->iter);
         op->iter = NULL;
     }
-    if(op->F) {
-        GrB_Matrix_free(&op->F);
-        op->F = NULL;
-    }
+    // Filter matrix is cleared after every traversal and reused.
     return OP_OK;
 }
 
@@ -228,4 +344,7 @@ void CondTraverseFree(OpBase *ctx) {
         for(int i = 0; i < op->recordsLen; i++) Record_Free(op->records[i]);
         rm_free(op->records);
     }
+    if(op->filterRows) rm_free(op->filterRows);
+    if(op->filterCols) rm_free(op->filterCols);
+    if(op->filterVals) rm_free(op->filterVals);
 }
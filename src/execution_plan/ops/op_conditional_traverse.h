@@ -20,6 +20,9 @@ typedef struct {
     Graph *graph;
     AlgebraicExpression *algebraic_expression;
     GrB_Matrix F;               // Filter matrix.
+    GrB_Index *filterRows;      // Row of each filter matrix entry, source node ID.
+    GrB_Index *filterCols;      // Column of each filter matrix entry, record index.
+    bool *filterVals;           // Filter matrix values, all true.
     GrB_Matrix M;               // Algebraic expression result.
     int *edgeRelationTypes;     // One or more relation types.
     int edgeRelationCount;      // length of edgeRelationTypes.
@@ -28,20 +31,31 @@ typedef struct {
     int srcNodeRecIdx;          // Index into record.
     int destNodeRecIdx;         // Index into record.
     int edgeRecIdx;             // Index into record.
-    int recordsCap;             // Max number of records to process.
+    int recordsCap;             // Max number of records to process, adapts to throughput.
+    int recordsMax;             // Upper bound on recordsCap, number of columns in F and M.
     int recordsLen;             // Number of records to process.
     Record *records;            // Array of records.
     Record r;                   // Current selected record.
+    RecordBatch *input;         // Child batch being traversed, batch mode only.
+    uint inputOffset;           // Position of first input record set in F.
+    uint inputLen;              // Number of input records set in F.
 } CondTraverse;
 
 /* Creates a new Traverse operation */
 OpBase* NewCondTraverseOp(Graph *g, AlgebraicExpression *algebraic_expression);
 
+/* Clones traversal, along with its algebraic expression. */
+OpBase* CondTraverseClone(OpBase *opBase);
+
 /* TraverseConsume next operation 
  * each call will update the graph
  * returns NULL when no additional updates are available */
 Record CondTraverseConsume(OpBase *opBase);
 
+/* CondTraverseConsumeBatch next batch of traversed records,
+ * child's batch is traversed recordsCap records at a time. */
+RecordBatch *CondTraverseConsumeBatch(OpBase *opBase);
+
 /* Restart iterator */
 OpResult CondTraverseReset(OpBase *ctx);
 
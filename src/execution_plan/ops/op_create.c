@@ -174,7 +174,9 @@ static void _CommitNodes(OpCreate *op) {
                     Vector_Get(entity->properties, prop_idx+1, &value);
 
                     Attribute_ID prop_id = Schema_AddAttribute(schema, SCHEMA_NODE, key->stringval);
-                    GraphEntity_AddProperty((GraphEntity*)n, prop_id, *value);
+                    SIValue v = *value;
+                    if(GraphContext_InternValue(op->gc, SCHEMA_NODE, prop_id, &v)) op->result_set->stats.string_dict_hits++;
+                    GraphEntity_AddProperty((GraphEntity*)n, prop_id, v);
                 }
                 // Introduce node to schema indices.
                 if(n->label) GraphContext_AddNodeToIndices(op->gc, schema, n);
@@ -231,7 +233,9 @@ static void _CommitEdges(OpCreate *op) {
                     Vector_Get(entity->properties, prop_idx+1, &value);
 
                     Attribute_ID prop_id = Schema_AddAttribute(schema, SCHEMA_EDGE, key->stringval);
-                    GraphEntity_AddProperty((GraphEntity*)e, prop_id, *value);
+                    SIValue v = *value;
+                    if(GraphContext_InternValue(op->gc, SCHEMA_EDGE, prop_id, &v)) op->result_set->stats.string_dict_hits++;
+                    GraphEntity_AddProperty((GraphEntity*)e, prop_id, v);
                 }
                 op->result_set->stats.properties_set += propCount/2;
             }
@@ -32,20 +32,22 @@ void _DeleteEntities(OpDelete *op) {
     /* Lock everything. */
     Graph_AcquireWriteLock(op->gc->g);
 
-    /* We must start with edge deletion as node deletion moves nodes around. */
-    size_t deletedEdgeCount = array_len(op->deleted_edges);
-    for(int i = 0; i < deletedEdgeCount; i++) {
-        Edge *e = op->deleted_edges + i;
-        if(Graph_DeleteEdge(op->gc->g, e))
-            if(op->result_set) op->result_set->stats.relationships_deleted++;
-    }
-
     size_t deletedNodeCount = array_len(op->deleted_nodes);
     for(int i = 0; i < deletedNodeCount; i++) {
         Node *n = op->deleted_nodes + i;
         GraphContext_DeleteNodeFromIndices(op->gc, n);
-        Graph_DeleteNode(op->gc->g, n);
-        if(op->result_set) op->result_set->stats.nodes_deleted++;
+    }
+
+    /* Remove all entities at once. */
+    uint nodesDeleted = 0;
+    uint relationshipsDeleted = 0;
+    Graph_BulkDelete(op->gc->g, op->deleted_nodes, deletedNodeCount,
+                     op->deleted_edges, array_len(op->deleted_edges),
+                     &nodesDeleted, &relationshipsDeleted);
+
+    if(op->result_set) {
+        op->result_set->stats.nodes_deleted += nodesDeleted;
+        op->result_set->stats.relationships_deleted += relationshipsDeleted;
     }
 
     /* Release lock. */
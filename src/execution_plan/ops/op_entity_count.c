@@ -0,0 +1,88 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "op_entity_count.h"
+#include <assert.h>
+#include "../../util/arr.h"
+#include "../../query_executor.h"
+
+OpBase* NewEntityCountOp(Graph *g, EntityCountType type, int id, ResultSet *resultset) {
+    EntityCount *entityCount = malloc(sizeof(EntityCount));
+    entityCount->g = g;
+    entityCount->type = type;
+    entityCount->id = id;
+    entityCount->resultset = resultset;
+    entityCount->ast = AST_GetFromLTS();
+    entityCount->init = false;
+    entityCount->depleted = false;
+
+    // Set our Op operations
+    OpBase_Init(&entityCount->op);
+    entityCount->op.name = "Entity Count";
+    entityCount->op.type = OPType_ENTITY_COUNT;
+    entityCount->op.consume = EntityCountConsume;
+    entityCount->op.reset = EntityCountReset;
+    entityCount->op.free = EntityCountFree;
+
+    return (OpBase*)entityCount;
+}
+
+// Number of entries in matrix.
+static uint64_t _MatrixEntries(GrB_Matrix M) {
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, M);
+    return nvals;
+}
+
+static uint64_t _Count(const EntityCount *op) {
+    switch(op->type) {
+        case ENTITY_COUNT_NODES:
+            return Graph_NodeCount(op->g);
+        case ENTITY_COUNT_LABEL:
+            if(op->id < 0) return 0;
+            return _MatrixEntries(Graph_GetLabel(op->g, op->id));
+        case ENTITY_COUNT_EDGES:
+            return Graph_EdgeCount(op->g);
+        case ENTITY_COUNT_RELATION:
+            if(op->id < 0) return 0;
+            return _MatrixEntries(Graph_GetRelationMatrix(op->g, op->id));
+        case ENTITY_COUNT_CONNECTIONS:
+            return _MatrixEntries(Graph_GetAdjacencyMatrix(op->g));
+        default:
+            assert(false);
+            return 0;
+    }
+}
+
+Record EntityCountConsume(OpBase *opBase) {
+    EntityCount *op = (EntityCount*)opBase;
+    if(op->depleted) return NULL;
+    op->depleted = true;
+
+    if(!op->init) {
+        ExpandCollapsedNodes(op->ast);
+        ResultSet_CreateHeader(op->resultset);
+        op->init = true;
+    }
+
+    // Count aggregates to a double, same as count().
+    SIValue count = SI_DoubleVal(_Count(op));
+    uint returnElemCount = array_len(op->ast->returnNode->returnElements);
+    Record r = Record_New(returnElemCount);
+    for(uint i = 0; i < returnElemCount; i++) Record_AddScalar(r, i, count);
+
+    return r;
+}
+
+OpResult EntityCountReset(OpBase *ctx) {
+    EntityCount *op = (EntityCount*)ctx;
+    op->depleted = false;
+    return OP_OK;
+}
+
+void EntityCountFree(OpBase *ctx) {
+}
@@ -0,0 +1,52 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __OP_ENTITY_COUNT_H
+#define __OP_ENTITY_COUNT_H
+
+#include "op.h"
+#include "../../parser/ast.h"
+#include "../../graph/graph.h"
+#include "../../resultset/resultset.h"
+
+/* Entities counted by EntityCount. */
+typedef enum {
+    ENTITY_COUNT_NODES,         // All nodes.
+    ENTITY_COUNT_LABEL,         // Nodes of a label, label matrix entries.
+    ENTITY_COUNT_EDGES,         // All edges.
+    ENTITY_COUNT_RELATION,      // Edges of a relation type, relation matrix entries.
+    ENTITY_COUNT_CONNECTIONS,   // Connected pairs of nodes, adjacency matrix entries.
+} EntityCountType;
+
+/* EntityCount
+ * produces a single record holding the number of entities
+ * of a given type, read directly off the graph in constant time,
+ * every return element is set to this count. */
+typedef struct {
+    OpBase op;
+    Graph *g;
+    EntityCountType type;   // Type of entities counted.
+    int id;                 // Label or relation id, negative if it doesn't exist.
+    ResultSet *resultset;
+    AST *ast;
+    bool init;              // Result-set header was created.
+    bool depleted;          // Count was produced.
+} EntityCount;
+
+/* Creates a new EntityCount operation */
+OpBase* NewEntityCountOp(Graph *g, EntityCountType type, int id, ResultSet *resultset);
+
+/* EntityCountConsume next operation */
+Record EntityCountConsume(OpBase *opBase);
+
+/* Restart */
+OpResult EntityCountReset(OpBase *ctx);
+
+/* Frees EntityCount */
+void EntityCountFree(OpBase *ctx);
+
+#endif
@@ -0,0 +1,104 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "op_expand_count.h"
+#include "../../parser/ast.h"
+
+OpBase* NewExpandCountOp(Graph *g, AlgebraicExpression *ae, bool countEdges) {
+    AST *ast = AST_GetFromLTS();
+    ExpandCount *expandCount = malloc(sizeof(ExpandCount));
+    expandCount->graph = g;
+    expandCount->ae = ae;
+    expandCount->countEdges = countEdges;
+    expandCount->degrees = NULL;
+    expandCount->srcNodeRecIdx = AST_GetAliasID(ast, ae->src_node->alias);
+    expandCount->countRecIdx = AST_GetAliasID(ast, ae->dest_node->alias);
+
+    // Set our Op operations
+    OpBase_Init(&expandCount->op);
+    expandCount->op.name = "Expand Count";
+    expandCount->op.type = OPType_EXPAND_COUNT;
+    expandCount->op.consume = ExpandCountConsume;
+    expandCount->op.reset = ExpandCountReset;
+    expandCount->op.free = ExpandCountFree;
+
+    return (OpBase*)expandCount;
+}
+
+/* Reduces traversal expression M[dest, src] into
+ * degrees[src], the number of entries in each column. */
+static void _ExpandCount_ComputeDegrees(ExpandCount *op) {
+    AlgebraicExpression *ae = op->ae;
+    GrB_Index n = Graph_RequiredMatrixDim(op->graph);
+    GrB_Vector_new(&op->degrees, GrB_UINT64, n);
+
+    GrB_Matrix M = NULL;
+    GrB_Matrix A;
+    bool transpose;
+    GrB_Descriptor desc;
+    GrB_Descriptor_new(&desc);
+
+    if(ae->operand_count > 1) {
+        GrB_Matrix_new(&M, GrB_BOOL, n, n);
+        AlgebraicExpression_Execute(ae, M);
+        A = M;
+        transpose = true;
+    } else {
+        // Columns of A are rows of A transposed.
+        A = ae->operands[0].operand;
+        transpose = !ae->operands[0].transpose;
+
+        /* Adjacency entries hold the number of connecting edges,
+         * typecast to boolean when counting connected pairs. */
+        if(!op->countEdges) {
+            GrB_Matrix_new(&M, GrB_BOOL, n, n);
+            if(transpose) GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
+            GrB_Matrix_apply(M, NULL, NULL, GrB_IDENTITY_BOOL, A, desc);
+            GrB_Descriptor_set(desc, GrB_INP0, GxB_DEFAULT);
+            A = M;
+            transpose = false;
+        }
+    }
+
+    // Reduce each row of A', true entries are counted as 1.
+    if(transpose) GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
+    GrB_Matrix_reduce_Monoid(op->degrees, NULL, NULL, GxB_PLUS_UINT64_MONOID, A, desc);
+
+    GrB_Descriptor_free(&desc);
+    if(M) GrB_Matrix_free(&M);
+}
+
+Record ExpandCountConsume(OpBase *opBase) {
+    ExpandCount *op = (ExpandCount*)opBase;
+    OpBase *child = op->op.children[0];
+
+    if(!op->degrees) _ExpandCount_ComputeDegrees(op);
+
+    Record r;
+    while((r = child->consume(child))) {
+        Node *n = Record_GetNode(r, op->srcNodeRecIdx);
+        uint64_t degree;
+        if(GrB_Vector_extractElement_UINT64(&degree, op->degrees, ENTITY_GET_ID(n)) == GrB_SUCCESS) {
+            Record_AddScalar(r, op->countRecIdx, SI_LongVal(degree));
+            return r;
+        }
+        // Source node doesn't expand to any record.
+        Record_Free(r);
+    }
+
+    return NULL;
+}
+
+OpResult ExpandCountReset(OpBase *ctx) {
+    return OP_OK;
+}
+
+void ExpandCountFree(OpBase *ctx) {
+    ExpandCount *op = (ExpandCount*)ctx;
+    if(op->degrees) GrB_Vector_free(&op->degrees);
+    if(op->ae) AlgebraicExpression_Free(op->ae);
+}
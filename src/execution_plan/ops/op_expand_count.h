@@ -0,0 +1,44 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __OP_EXPAND_COUNT_H
+#define __OP_EXPAND_COUNT_H
+
+#include "op.h"
+#include "../../graph/graph.h"
+#include "../../arithmetic/algebraic_expression.h"
+#include "../../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+/* ExpandCount
+ * computes the number of records a single hop traversal would produce
+ * for each of its source nodes, by reducing the traversal expression
+ * into a degree vector. Source records are passed on along with their degree,
+ * set at the destination node's position, sources without any destination
+ * are dropped. */
+typedef struct {
+    OpBase op;
+    Graph *graph;
+    AlgebraicExpression *ae;    // Traversal expression.
+    bool countEdges;            // Sum adjacency entries, counting edges rather than connected pairs.
+    GrB_Vector degrees;         // Degree of each source node, NULL until computed.
+    int srcNodeRecIdx;          // Source node position within record.
+    int countRecIdx;            // Degree position within record.
+} ExpandCount;
+
+/* Creates a new ExpandCount operation, takes ownership of ae. */
+OpBase* NewExpandCountOp(Graph *g, AlgebraicExpression *ae, bool countEdges);
+
+/* ExpandCountConsume next operation */
+Record ExpandCountConsume(OpBase *opBase);
+
+/* Restart */
+OpResult ExpandCountReset(OpBase *ctx);
+
+/* Frees ExpandCount */
+void ExpandCountFree(OpBase *ctx);
+
+#endif
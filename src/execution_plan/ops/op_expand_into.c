@@ -0,0 +1,171 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "op_expand_into.h"
+#include "../../parser/ast.h"
+#include "../../util/arr.h"
+#include "../../graph/graphcontext.h"
+
+// Position of sole relation operand, -1 if there's none or several.
+static int _relationOperand(const AlgebraicExpression *ae) {
+    int relationIdx = -1;
+    for(int i = 0; i < ae->operand_count; i++) {
+        if(ae->operands[i].diagonal) continue;
+        if(relationIdx != -1) return -1;
+        relationIdx = i;
+    }
+    return relationIdx;
+}
+
+static void _setupTraversedRelations(ExpandInto *op) {
+    AST *ast = AST_GetFromLTS();
+    GraphContext *gc = GraphContext_GetFromLTS();
+    AST_LinkEntity *e = (AST_LinkEntity*)MatchClause_GetEntity(ast->matchNode, op->ae->edge->alias);
+    int relationCount = AST_LinkEntity_LabelCount(e);
+
+    op->edgeRelationTypes = array_new(int, 1);
+    if(relationCount == 0) {
+        op->edgeRelationTypes = array_append(op->edgeRelationTypes, GRAPH_NO_RELATION);
+        return;
+    }
+    for(int i = 0; i < relationCount; i++) {
+        Schema *s = GraphContext_GetSchema(gc, e->labels[i], SCHEMA_EDGE);
+        if(!s) continue;
+        op->edgeRelationTypes = array_append(op->edgeRelationTypes, s->id);
+    }
+}
+
+bool ExpandInto_Applicable(const AlgebraicExpression *ae) {
+    return !ae->edgeLength && _relationOperand(ae) != -1;
+}
+
+OpBase* NewExpandIntoOp(Graph *g, AlgebraicExpression *ae) {
+    assert(ExpandInto_Applicable(ae));
+    AST *ast = AST_GetFromLTS();
+    ExpandInto *expandInto = malloc(sizeof(ExpandInto));
+    expandInto->graph = g;
+    expandInto->ae = ae;
+    expandInto->relationIdx = _relationOperand(ae);
+    expandInto->edgeRelationTypes = NULL;
+    expandInto->edges = NULL;
+    expandInto->r = NULL;
+    expandInto->srcNodeRecIdx = AST_GetAliasID(ast, ae->src_node->alias);
+    expandInto->destNodeRecIdx = AST_GetAliasID(ast, ae->dest_node->alias);
+
+    // Set our Op operations
+    OpBase_Init(&expandInto->op);
+    expandInto->op.name = "Expand Into";
+    expandInto->op.type = OPType_EXPAND_INTO;
+    expandInto->op.consume = ExpandIntoConsume;
+    expandInto->op.reset = ExpandIntoReset;
+    expandInto->op.free = ExpandIntoFree;
+    expandInto->op.clone = ExpandIntoClone;
+
+    // Both nodes are bound, only the edge is resolved.
+    if(ae->edge) {
+        _setupTraversedRelations(expandInto);
+        expandInto->edges = array_new(Edge, 1);
+        expandInto->edgeRecIdx = AST_GetAliasID(ast, ae->edge->alias);
+        expandInto->op.modifies = NewVector(char*, 1);
+        Vector_Push(expandInto->op.modifies, ae->edge->alias);
+    }
+
+    return (OpBase*)expandInto;
+}
+
+OpBase* ExpandIntoClone(OpBase *opBase) {
+    ExpandInto *op = (ExpandInto*)opBase;
+    return NewExpandIntoOp(op->graph, AlgebraicExpression_Clone(op->ae));
+}
+
+/* Checks expression entry [dest, src], label operands preceding
+ * the relation operand filter destination node, following ones the source. */
+static bool _ExpandInto_Connected(ExpandInto *op, NodeID src, NodeID dest) {
+    bool x;
+    for(int i = 0; i < op->ae->operand_count; i++) {
+        AlgebraicExpressionOperand *operand = op->ae->operands + i;
+        GrB_Index row = dest;
+        GrB_Index col = src;
+        if(operand->diagonal) {
+            row = col = (i < op->relationIdx) ? dest : src;
+        } else if(operand->transpose) {
+            row = src;
+            col = dest;
+        }
+        if(GrB_Matrix_extractElement_BOOL(&x, operand->operand, row, col) != GrB_SUCCESS) return false;
+    }
+    return true;
+}
+
+// Resolves edges connecting current record's nodes.
+static void _ExpandInto_CollectEdges(ExpandInto *op, NodeID src, NodeID dest) {
+    // Transposed relation operand traverses edges from destination to source.
+    if(op->ae->operands[op->relationIdx].transpose) {
+        NodeID tmp = src;
+        src = dest;
+        dest = tmp;
+    }
+
+    for(int i = 0; i < array_len(op->edgeRelationTypes); i++) {
+        Graph_GetEdgesConnectingNodes(op->graph, src, dest, op->edgeRelationTypes[i], &op->edges);
+    }
+}
+
+// Sets next edge connecting current record's nodes.
+static int _ExpandInto_SetEdge(ExpandInto *op) {
+    if(!array_len(op->edges)) return 0;
+
+    Edge *e = op->edges + (array_len(op->edges)-1);
+    Record_AddEdge(op->r, op->edgeRecIdx, *e);
+    array_pop(op->edges);
+    return 1;
+}
+
+Record ExpandIntoConsume(OpBase *opBase) {
+    ExpandInto *op = (ExpandInto*)opBase;
+    OpBase *child = op->op.children[0];
+
+    // Pass on current record once per connecting edge.
+    if(op->r) {
+        if(_ExpandInto_SetEdge(op)) return Record_Clone(op->r);
+        Record_Free(op->r);
+        op->r = NULL;
+    }
+
+    Record r;
+    while((r = child->consume(child))) {
+        NodeID src = ENTITY_GET_ID(Record_GetNode(r, op->srcNodeRecIdx));
+        NodeID dest = ENTITY_GET_ID(Record_GetNode(r, op->destNodeRecIdx));
+        if(_ExpandInto_Connected(op, src, dest)) {
+            if(!op->ae->edge) return r;
+
+            op->r = r;
+            _ExpandInto_CollectEdges(op, src, dest);
+            if(_ExpandInto_SetEdge(op)) return Record_Clone(op->r);
+            op->r = NULL;
+        }
+        Record_Free(r);
+    }
+
+    return NULL;
+}
+
+OpResult ExpandIntoReset(OpBase *ctx) {
+    ExpandInto *op = (ExpandInto*)ctx;
+    if(op->r) Record_Free(op->r);
+    op->r = NULL;
+    if(op->edges) array_clear(op->edges);
+    return OP_OK;
+}
+
+void ExpandIntoFree(OpBase *ctx) {
+    ExpandInto *op = (ExpandInto*)ctx;
+    if(op->r) Record_Free(op->r);
+    if(op->edges) array_free(op->edges);
+    if(op->edgeRelationTypes) array_free(op->edgeRelationTypes);
+    if(op->ae) AlgebraicExpression_Free(op->ae);
+}
@@ -0,0 +1,55 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __OP_EXPAND_INTO_H
+#define __OP_EXPAND_INTO_H
+
+#include "op.h"
+#include "../../graph/graph.h"
+#include "../../arithmetic/algebraic_expression.h"
+
+/* ExpandInto
+ * resolves a single hop traversal whose source and destination nodes
+ * are both bound by preceding operations, e.g. the closing edge of a cycle
+ * (a)-[:R]->(b)-[:R]->(c)-[:R]->(a)
+ * rather than multiplying the traversal expression, connectivity
+ * of each record's nodes is checked by point lookups on the expression's
+ * relation and label matrices. Records of disconnected nodes are dropped,
+ * when the edge is referenced a record is passed on per connecting edge. */
+typedef struct {
+    OpBase op;
+    Graph *graph;
+    AlgebraicExpression *ae;    // Traversal expression.
+    int relationIdx;            // Position of relation operand within expression.
+    int *edgeRelationTypes;     // Relation types of referenced edge.
+    Edge *edges;                // Edges connecting current nodes.
+    Record r;                   // Current record, passed on once per edge.
+    int srcNodeRecIdx;          // Source node position within record.
+    int destNodeRecIdx;         // Destination node position within record.
+    int edgeRecIdx;             // Edge position within record.
+} ExpandInto;
+
+/* Checks if expression can be resolved by point lookups,
+ * it must hold a single relation operand, other operands being label matrices. */
+bool ExpandInto_Applicable(const AlgebraicExpression *ae);
+
+/* Creates a new ExpandInto operation, takes ownership of ae. */
+OpBase* NewExpandIntoOp(Graph *g, AlgebraicExpression *ae);
+
+/* Clones ExpandInto, along with its algebraic expression. */
+OpBase* ExpandIntoClone(OpBase *opBase);
+
+/* ExpandIntoConsume next record connecting its bound nodes. */
+Record ExpandIntoConsume(OpBase *opBase);
+
+/* Restart */
+OpResult ExpandIntoReset(OpBase *ctx);
+
+/* Frees ExpandInto */
+void ExpandIntoFree(OpBase *ctx);
+
+#endif
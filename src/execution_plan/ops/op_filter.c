@@ -16,12 +16,19 @@ OpBase* NewFilterOp(FT_FilterNode *filterTree) {
     filter->op.name = "Filter";
     filter->op.type = OPType_FILTER;
     filter->op.consume = FilterConsume;
+    filter->op.consume_batch = FilterConsumeBatch;
     filter->op.reset = FilterReset;
     filter->op.free = FilterFree;
+    filter->op.clone = FilterClone;
 
     return (OpBase*)filter;
 }
 
+OpBase* FilterClone(OpBase *opBase) {
+    Filter *filter = (Filter*)opBase;
+    return NewFilterOp(filter->filterTree);
+}
+
 /* FilterConsume next operation 
  * returns OP_OK when graph passes filter tree. */
 Record FilterConsume(OpBase *opBase) {
@@ -41,6 +48,29 @@ Record FilterConsume(OpBase *opBase) {
     return r;
 }
 
+/* FilterConsumeBatch, compacts passing records to the front
+ * of child's batch, which is handed over to the caller. */
+RecordBatch *FilterConsumeBatch(OpBase *opBase) {
+    Filter *filter = (Filter*)opBase;
+    OpBase *child = filter->op.children[0];
+
+    RecordBatch *batch;
+    while((batch = OpBase_ConsumeBatch(child))) {
+        uint passed = 0;
+        for(uint i = 0; i < batch->len; i++) {
+            if(FilterTree_applyFilters(filter->filterTree, batch->records[i]) == FILTER_PASS) {
+                RecordBatch_Swap(batch, passed, i);
+                passed++;
+            }
+        }
+
+        batch->len = passed;
+        if(passed) break;
+    }
+
+    return batch;
+}
+
 /* Restart iterator */
 OpResult FilterReset(OpBase *ctx) {
     return OP_OK;
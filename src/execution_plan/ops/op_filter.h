@@ -21,10 +21,17 @@ typedef struct {
 /* Creates a new Filter operation */
 OpBase* NewFilterOp(FT_FilterNode *filterTree);
 
+/* Clones filter, filter tree is shared. */
+OpBase* FilterClone(OpBase *opBase);
+
 /* FilterConsume next operation 
  * returns NULL when depleted. */
 Record FilterConsume(OpBase *opBase);
 
+/* FilterConsumeBatch next batch of records passing filters,
+ * returns NULL when depleted. */
+RecordBatch *FilterConsumeBatch(OpBase *opBase);
+
 /* Restart iterator */
 OpResult FilterReset(OpBase *ctx);
 
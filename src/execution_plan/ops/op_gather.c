@@ -0,0 +1,310 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "op_gather.h"
+#include "op_all_node_scan.h"
+#include "op_node_by_label_scan.h"
+#include "../../util/arena.h"
+#include "../../util/rmalloc.h"
+#include <assert.h>
+
+extern pthread_key_t _tlsGCKey;     // Thread local storage graph context key.
+extern pthread_key_t _tlsASTKey;    // Thread local storage AST key.
+extern int _parallelWorkers;        // Number of threads executing parallel queries.
+
+static int _runningWorkers = 0;     // Number of worker threads running across all queries.
+
+/* Takes up to count workers off the module-wide budget,
+ * returns the number of workers taken, possibly none. */
+static int _Gather_AcquireWorkers(int count) {
+    int running = __atomic_load_n(&_runningWorkers, __ATOMIC_RELAXED);
+    int taken;
+    do {
+        taken = _parallelWorkers - running;
+        if(taken > count) taken = count;
+        if(taken <= 0) return 0;
+    } while(!__atomic_compare_exchange_n(&_runningWorkers, &running, running + taken,
+                                         false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    return taken;
+}
+
+static void _Gather_ReleaseWorkers(int count) {
+    __atomic_fetch_sub(&_runningWorkers, count, __ATOMIC_RELAXED);
+}
+
+OpBase* NewGatherOp(GraphContext *gc, int workerCount) {
+    assert(workerCount > 0);
+    Gather *gather = malloc(sizeof(Gather));
+    gather->gc = gc;
+    gather->ast = AST_GetFromLTS();
+    gather->workerCount = workerCount;
+    gather->threadCount = 0;
+    gather->workers = NULL;
+    gather->queue = rm_malloc(sizeof(Record) * GATHER_QUEUE_CAP);
+    gather->queueHead = 0;
+    gather->queueLen = 0;
+    gather->active = 0;
+    gather->stop = false;
+    gather->buffer = rm_malloc(sizeof(Record) * GATHER_QUEUE_CAP);
+    gather->bufferLen = 0;
+    gather->bufferPos = 0;
+    pthread_mutex_init(&gather->lock, NULL);
+    pthread_cond_init(&gather->produced, NULL);
+    pthread_cond_init(&gather->consumed, NULL);
+
+    // Set our Op operations
+    OpBase_Init(&gather->op);
+    gather->op.name = "Gather";
+    gather->op.type = OPType_GATHER;
+    gather->op.consume = GatherConsume;
+    gather->op.reset = GatherReset;
+    gather->op.free = GatherFree;
+
+    return (OpBase*)gather;
+}
+
+bool Gather_Parallelizable(const OpBase *op) {
+    if(!op->clone) return false;
+    switch(op->type) {
+        case OPType_ALL_NODE_SCAN:
+        case OPType_NODE_BY_LABEL_SCAN:
+            return op->childCount == 0;
+        case OPType_FILTER:
+        case OPType_CONDITIONAL_TRAVERSE:
+        case OPType_EXPAND_INTO:
+        case OPType_PROJECT:
+            return op->childCount == 1;
+        default:
+            return false;
+    }
+}
+
+// Clones pipeline rooted at op, its scan claims morsels from gather.
+static OpBase *_Gather_ClonePipeline(Gather *gather, OpBase *op) {
+    assert(Gather_Parallelizable(op));
+    OpBase *clone = op->clone(op);
+
+    if(op->childCount) {
+        OpBase *child = _Gather_ClonePipeline(gather, op->children[0]);
+        clone->children = malloc(sizeof(OpBase*));
+        clone->children[0] = child;
+        clone->childCount = 1;
+        child->parent = clone;
+    } else if(op->type == OPType_ALL_NODE_SCAN) {
+        AllNodeScanSetMorsels(clone, &gather->morsels);
+    } else {
+        NodeByLabelScanSetMorsels(clone, &gather->morsels);
+    }
+
+    return clone;
+}
+
+static void _Gather_FreePipeline(OpBase *op) {
+    for(int i = 0; i < op->childCount; i++) _Gather_FreePipeline(op->children[i]);
+    OpBase_Free(op);
+}
+
+/* Queues count records, waiting for space if required,
+ * returns false and frees records if workers should stop. */
+static bool _Gather_Push(Gather *op, Record *records, uint count) {
+    pthread_mutex_lock(&op->lock);
+    while(!op->stop && op->queueLen + count > GATHER_QUEUE_CAP) {
+        pthread_cond_wait(&op->consumed, &op->lock);
+    }
+
+    bool stop = op->stop;
+    if(!stop) {
+        for(uint i = 0; i < count; i++) {
+            op->queue[(op->queueHead + op->queueLen) % GATHER_QUEUE_CAP] = records[i];
+            op->queueLen++;
+        }
+        pthread_cond_signal(&op->produced);
+    }
+    pthread_mutex_unlock(&op->lock);
+
+    if(stop) {
+        for(uint i = 0; i < count; i++) Record_Free(records[i]);
+    }
+    return !stop;
+}
+
+// Default work, queues records produced by pipeline.
+static void _Gather_Produce(OpBase *pipeline, void *ctx) {
+    Gather *op = (Gather*)ctx;
+    Record records[GATHER_WORKER_BATCH];
+    uint count = 0;
+    bool produce = true;
+    Record r;
+    while(produce && (r = pipeline->consume(pipeline))) {
+        records[count++] = r;
+        if(count == GATHER_WORKER_BATCH) {
+            produce = _Gather_Push(op, records, count);
+            count = 0;
+        }
+    }
+    if(produce && count) _Gather_Push(op, records, count);
+}
+
+static void *_Gather_Work(void *arg) {
+    GatherWorker *worker = (GatherWorker*)arg;
+    Gather *op = worker->gather;
+
+    pthread_setspecific(_tlsGCKey, op->gc);
+    pthread_setspecific(_tlsASTKey, op->ast);
+    // Pipeline clones allocate from the global allocator, see _Gather_Start.
+    Arena_SetCurrent(NULL);
+
+    worker->work(worker->pipeline, worker->ctx);
+
+    pthread_mutex_lock(&op->lock);
+    op->active--;
+    pthread_cond_signal(&op->produced);
+    pthread_mutex_unlock(&op->lock);
+    return NULL;
+}
+
+/* Runs the sole worker on the calling thread,
+ * allocating as worker threads do, see _Gather_Start. */
+static void _Gather_RunInline(Gather *op) {
+    Arena *arena = Arena_GetCurrent();
+    Arena_SetCurrent(NULL);
+    op->workers[0].work(op->workers[0].pipeline, op->workers[0].ctx);
+    Arena_SetCurrent(arena);
+}
+
+// Pulls next record out of the sole worker's pipeline on the calling thread.
+static Record _Gather_ConsumeInline(Gather *op) {
+    OpBase *pipeline = op->workers[0].pipeline;
+    Arena *arena = Arena_GetCurrent();
+    Arena_SetCurrent(NULL);
+    Record r = pipeline->consume(pipeline);
+    Arena_SetCurrent(arena);
+    return r;
+}
+
+// Number of started workers, a single inline worker if no thread was taken.
+static inline int _Gather_WorkerCount(const Gather *op) {
+    return (op->threadCount > 0) ? op->threadCount : 1;
+}
+
+static void _Gather_Start(Gather *op, GatherWorkFunc work, void **ctxs) {
+    OpBase *child = op->op.children[0];
+    GrB_Index nodeCount = Graph_RequiredMatrixDim(op->gc->g);
+    MorselSource_Init(&op->morsels, nodeCount, MORSEL_SIZE);
+    op->threadCount = _Gather_AcquireWorkers(op->workerCount);
+    int workerCount = _Gather_WorkerCount(op);
+
+    /* Records produced by workers are freed by the consuming thread,
+     * as such workers don't use an arena, pipelines are
+     * cloned and freed without one as well. */
+    Arena *arena = Arena_GetCurrent();
+    Arena_SetCurrent(NULL);
+    op->workers = malloc(sizeof(GatherWorker) * workerCount);
+    for(int i = 0; i < workerCount; i++) {
+        op->workers[i].gather = op;
+        op->workers[i].pipeline = _Gather_ClonePipeline(op, child);
+        op->workers[i].work = work;
+        op->workers[i].ctx = (ctxs) ? ctxs[i] : op;
+    }
+    Arena_SetCurrent(arena);
+
+    op->stop = false;
+    op->active = op->threadCount;
+    for(int i = 0; i < op->threadCount; i++) {
+        int res = pthread_create(&op->workers[i].thread, NULL, _Gather_Work, op->workers + i);
+        assert(res == 0);
+        (void)res;
+    }
+}
+
+// Waits for workers to exit, discarding every record not yet consumed.
+static void _Gather_Join(Gather *op) {
+    for(int i = 0; i < op->threadCount; i++) pthread_join(op->workers[i].thread, NULL);
+    _Gather_ReleaseWorkers(op->threadCount);
+
+    for(uint i = 0; i < op->queueLen; i++) {
+        Record_Free(op->queue[(op->queueHead + i) % GATHER_QUEUE_CAP]);
+    }
+    for(uint i = op->bufferPos; i < op->bufferLen; i++) Record_Free(op->buffer[i]);
+    op->queueHead = 0;
+    op->queueLen = 0;
+    op->bufferLen = 0;
+    op->bufferPos = 0;
+
+    Arena *arena = Arena_GetCurrent();
+    Arena_SetCurrent(NULL);
+    int workerCount = _Gather_WorkerCount(op);
+    for(int i = 0; i < workerCount; i++) _Gather_FreePipeline(op->workers[i].pipeline);
+    Arena_SetCurrent(arena);
+    free(op->workers);
+    op->workers = NULL;
+    op->threadCount = 0;
+}
+
+// Stops workers and discards every record not yet consumed.
+static void _Gather_Stop(Gather *op) {
+    if(!op->workers) return;
+
+    pthread_mutex_lock(&op->lock);
+    op->stop = true;
+    pthread_cond_broadcast(&op->consumed);
+    pthread_mutex_unlock(&op->lock);
+    _Gather_Join(op);
+}
+
+void Gather_Run(OpBase *opBase, GatherWorkFunc work, void **ctxs) {
+    Gather *op = (Gather*)opBase;
+    assert(work && ctxs);
+    _Gather_Stop(op);
+    _Gather_Start(op, work, ctxs);
+    if(op->threadCount == 0) _Gather_RunInline(op);
+    _Gather_Join(op);
+}
+
+Record GatherConsume(OpBase *opBase) {
+    Gather *op = (Gather*)opBase;
+    if(op->bufferPos < op->bufferLen) return op->buffer[op->bufferPos++];
+
+    if(!op->workers) _Gather_Start(op, _Gather_Produce, NULL);
+    if(op->threadCount == 0) return _Gather_ConsumeInline(op);
+
+    // Take every queued record at once, sparing the lock on subsequent calls.
+    pthread_mutex_lock(&op->lock);
+    while(op->queueLen == 0 && op->active > 0) {
+        pthread_cond_wait(&op->produced, &op->lock);
+    }
+
+    op->bufferPos = 0;
+    op->bufferLen = op->queueLen;
+    for(uint i = 0; i < op->queueLen; i++) {
+        op->buffer[i] = op->queue[(op->queueHead + i) % GATHER_QUEUE_CAP];
+    }
+    op->queueHead = (op->queueHead + op->queueLen) % GATHER_QUEUE_CAP;
+    op->queueLen = 0;
+    pthread_cond_broadcast(&op->consumed);
+    pthread_mutex_unlock(&op->lock);
+
+    // Workers are done.
+    if(op->bufferLen == 0) return NULL;
+    return op->buffer[op->bufferPos++];
+}
+
+OpResult GatherReset(OpBase *ctx) {
+    Gather *op = (Gather*)ctx;
+    _Gather_Stop(op);
+    return OP_OK;
+}
+
+void GatherFree(OpBase *ctx) {
+    Gather *op = (Gather*)ctx;
+    _Gather_Stop(op);
+    rm_free(op->queue);
+    rm_free(op->buffer);
+    pthread_mutex_destroy(&op->lock);
+    pthread_cond_destroy(&op->produced);
+    pthread_cond_destroy(&op->consumed);
+}
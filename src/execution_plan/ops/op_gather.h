@@ -0,0 +1,89 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __OP_GATHER_H
+#define __OP_GATHER_H
+
+#include <pthread.h>
+#include "op.h"
+#include "../morsel.h"
+#include "../../parser/ast.h"
+#include "../../graph/graphcontext.h"
+
+#define GATHER_QUEUE_CAP 4096   // Maximum number of records waiting to be consumed.
+#define GATHER_WORKER_BATCH 64  // Number of records a worker queues at once.
+
+struct Gather;
+
+/* Work performed by each worker over its pipeline,
+ * ctx is private to the worker. */
+typedef void (*GatherWorkFunc)(OpBase *pipeline, void *ctx);
+
+// Execution context of a single worker thread.
+typedef struct {
+    struct Gather *gather;
+    OpBase *pipeline;           // Worker's clone of gathered pipeline.
+    GatherWorkFunc work;        // Work performed by worker.
+    void *ctx;                  // Worker's private context passed to work.
+    pthread_t thread;
+} GatherWorker;
+
+/* Gather
+ * executes its child pipeline on multiple threads, each worker runs
+ * a clone of the pipeline whose scan claims ID morsels from a shared source,
+ * records produced by the workers are merged into a single stream through
+ * a bounded exchange queue. The child pipeline is a template for
+ * the workers' clones and is never consumed itself.
+ * Worker threads are taken from a module-wide budget of _parallelWorkers,
+ * once exhausted Gather runs fewer workers, down to a single worker
+ * executed by the calling thread. */
+typedef struct Gather {
+    OpBase op;
+    GraphContext *gc;           // Graph context set for workers.
+    AST *ast;                   // AST set for workers.
+    int workerCount;            // Maximum number of worker threads.
+    int threadCount;            // Number of worker threads taken from budget, 0 if running inline.
+    GatherWorker *workers;      // Running workers, NULL until execution starts.
+    MorselSource morsels;       // Scanned ID ranges, shared by workers.
+    pthread_mutex_t lock;       // Guards queue, active and stop.
+    pthread_cond_t produced;    // Signaled once records are queued or a worker exits.
+    pthread_cond_t consumed;    // Signaled once queue space is freed or workers should stop.
+    Record *queue;              // Ring buffer of records produced by workers.
+    uint queueHead;             // Position of first queued record.
+    uint queueLen;              // Number of queued records.
+    int active;                 // Number of workers still producing.
+    bool stop;                  // Workers should stop producing.
+    Record *buffer;             // Records taken off queue, handed out one at a time.
+    uint bufferLen;             // Number of buffered records.
+    uint bufferPos;             // Position of next buffered record.
+} Gather;
+
+/* Creates a new Gather operation, executing its child pipeline
+ * on workerCount threads. */
+OpBase* NewGatherOp(GraphContext *gc, int workerCount);
+
+/* Runs work on each of the workers rather than gathering their records,
+ * ctxs holds a private context for each of the workerCount possible workers,
+ * contexts of workers left out by the budget remain untouched.
+ * Returns once all workers are done. */
+void Gather_Run(OpBase *opBase, GatherWorkFunc work, void **ctxs);
+
+/* Checks if op can be executed by a Gather worker,
+ * scans are only parallelized at the bottom of a pipeline. */
+bool Gather_Parallelizable(const OpBase *op);
+
+/* GatherConsume next record produced by any of the workers,
+ * workers are started on the first call. */
+Record GatherConsume(OpBase *opBase);
+
+/* Stops workers, execution restarts on next consume. */
+OpResult GatherReset(OpBase *ctx);
+
+/* Frees Gather */
+void GatherFree(OpBase *ctx);
+
+#endif
@@ -0,0 +1,139 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "op_hash_join.h"
+#include "../../util/arr.h"
+#include "../../util/rmalloc.h"
+
+// Entries are keyed by a single value, matching keys compare as equal.
+static int _HashJoin_KeysDiffer(const void *a, const void *b, size_t len) {
+    return SIValue_Compare(*(const SIValue*)a, *(const SIValue*)b) != 0;
+}
+
+#define uthash_malloc(sz) rm_malloc(sz)
+#define uthash_free(ptr,sz) rm_free(ptr)
+#define uthash_memcmp(a,b,n) _HashJoin_KeysDiffer(a,b,n)
+#include "../../util/uthash.h"
+
+struct HashJoinEntry {
+    UT_hash_handle hh;      // Makes entry hashable.
+    SIValue key;            // Join key.
+    Record *records;        // array_t of build records sharing key.
+};
+
+/* Only strings, numerics and booleans are comparable for equality,
+ * other keys, e.g. nulls, can't join any record. */
+static inline bool _HashJoin_Joinable(SIValue key) {
+    return (key.type & (SI_STRING | SI_NUMERIC | T_BOOL)) != 0;
+}
+
+static HashJoinEntry *_HashJoin_Lookup(HashJoin *op, SIValue key) {
+    HashJoinEntry *entry;
+    unsigned hash = (unsigned)SIValue_HashCode(key);
+    HASH_FIND_BYHASHVALUE(hh, op->table, &key, sizeof(SIValue), hash, entry);
+    return entry;
+}
+
+// Consumes build stream into hash table.
+static void _HashJoin_Build(HashJoin *op) {
+    OpBase *build = op->op.children[0];
+    Record r;
+    while((r = build->consume(build))) {
+        SIValue key = AR_EXP_Evaluate(op->buildExp, r);
+        if(!_HashJoin_Joinable(key)) {
+            SIValue_Free(&key);
+            Record_Free(r);
+            continue;
+        }
+
+        HashJoinEntry *entry = _HashJoin_Lookup(op, key);
+        if(entry) {
+            SIValue_Free(&key);
+        } else {
+            // Entry owns its key.
+            entry = rm_malloc(sizeof(HashJoinEntry));
+            entry->key = key;
+            entry->records = array_new(Record, 1);
+            unsigned hash = (unsigned)SIValue_HashCode(key);
+            HASH_ADD_KEYPTR_BYHASHVALUE(hh, op->table, &entry->key, sizeof(SIValue), hash, entry);
+        }
+        entry->records = array_append(entry->records, r);
+    }
+    op->built = true;
+}
+
+OpBase* NewHashJoinOp(AR_ExpNode *buildExp, AR_ExpNode *probeExp) {
+    HashJoin *hashJoin = malloc(sizeof(HashJoin));
+    hashJoin->buildExp = buildExp;
+    hashJoin->probeExp = probeExp;
+    hashJoin->table = NULL;
+    hashJoin->built = false;
+    hashJoin->probed = NULL;
+    hashJoin->match = NULL;
+    hashJoin->matchIdx = 0;
+
+    // Set our Op operations
+    OpBase_Init(&hashJoin->op);
+    hashJoin->op.name = "Hash Join";
+    hashJoin->op.type = OPType_HASH_JOIN;
+    hashJoin->op.consume = HashJoinConsume;
+    hashJoin->op.reset = HashJoinReset;
+    hashJoin->op.free = HashJoinFree;
+
+    return (OpBase*)hashJoin;
+}
+
+Record HashJoinConsume(OpBase *opBase) {
+    HashJoin *op = (HashJoin*)opBase;
+    OpBase *probe = op->op.children[1];
+
+    if(!op->built) _HashJoin_Build(op);
+    // Nothing to join with.
+    if(!op->table) return NULL;
+
+    // Advance probe stream until a record joins build records.
+    while(!op->match || op->matchIdx == array_len(op->match->records)) {
+        if(op->probed) Record_Free(op->probed);
+        op->probed = probe->consume(probe);
+        op->match = NULL;
+        op->matchIdx = 0;
+        if(!op->probed) return NULL;
+
+        SIValue key = AR_EXP_Evaluate(op->probeExp, op->probed);
+        if(_HashJoin_Joinable(key)) op->match = _HashJoin_Lookup(op, key);
+        SIValue_Free(&key);
+    }
+
+    Record r = Record_Clone(op->match->records[op->matchIdx++]);
+    Record_Merge(r, op->probed);
+    return r;
+}
+
+OpResult HashJoinReset(OpBase *ctx) {
+    HashJoin *op = (HashJoin*)ctx;
+    if(op->probed) {
+        Record_Free(op->probed);
+        op->probed = NULL;
+    }
+    op->match = NULL;
+    op->matchIdx = 0;
+    return OP_OK;
+}
+
+void HashJoinFree(OpBase *ctx) {
+    HashJoin *op = (HashJoin*)ctx;
+    if(op->probed) Record_Free(op->probed);
+
+    HashJoinEntry *entry, *tmp;
+    HASH_ITER(hh, op->table, entry, tmp) {
+        HASH_DEL(op->table, entry);
+        for(uint i = 0; i < array_len(entry->records); i++) Record_Free(entry->records[i]);
+        array_free(entry->records);
+        SIValue_Free(&entry->key);
+        rm_free(entry);
+    }
+}
@@ -0,0 +1,46 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __OP_HASH_JOIN_H
+#define __OP_HASH_JOIN_H
+
+#include "op.h"
+#include "../../arithmetic/arithmetic_expression.h"
+
+typedef struct HashJoinEntry HashJoinEntry;
+
+/* HashJoin
+ * joins records of two streams whose join keys compare as equal.
+ * The build stream (first child) is consumed once into a hash table
+ * keyed by buildExp, each record of the probe stream (second child)
+ * is then merged with every build record sharing its probeExp key.
+ * Records whose key is null or incomparable never join. */
+typedef struct {
+    OpBase op;
+    AR_ExpNode *buildExp;       // Join key of build stream records.
+    AR_ExpNode *probeExp;       // Join key of probe stream records.
+    HashJoinEntry *table;       // Build records grouped by join key.
+    bool built;                 // Build stream was consumed.
+    Record probed;              // Current probe record.
+    HashJoinEntry *match;       // Build records joining current probe record.
+    uint matchIdx;              // Position of next build record to join.
+} HashJoin;
+
+/* Creates a new HashJoin operation, join key expressions
+ * are not owned by the operation. */
+OpBase* NewHashJoinOp(AR_ExpNode *buildExp, AR_ExpNode *probeExp);
+
+/* HashJoinConsume next joined record. */
+Record HashJoinConsume(OpBase *opBase);
+
+/* Restarts probing, build records are kept. */
+OpResult HashJoinReset(OpBase *ctx);
+
+/* Frees HashJoin */
+void HashJoinFree(OpBase *ctx);
+
+#endif
@@ -71,7 +71,9 @@ static void _CommitNodes(OpMerge *op, Record r) {
                     Attribute_ID prop_id = ATTRIBUTE_NOTFOUND;
                     if(schema) prop_id = Schema_AddAttribute(schema, SCHEMA_NODE, key->stringval);
                     else prop_id = Schema_AddAttribute(unified_schema, SCHEMA_NODE, key->stringval);
-                    GraphEntity_AddProperty((GraphEntity*)n, prop_id, *value);
+                    SIValue v = *value;
+                    if(GraphContext_InternValue(op->gc, SCHEMA_NODE, prop_id, &v)) op->result_set->stats.string_dict_hits++;
+                    GraphEntity_AddProperty((GraphEntity*)n, prop_id, v);
                 }
                 // Update tracked schema and add node to any matching indices.
                 if(schema) GraphContext_AddNodeToIndices(op->gc, schema, n);
@@ -129,7 +131,9 @@ static void _CommitEdges(OpMerge *op, Record r) {
                     Vector_Get(blueprint->ge.properties, prop_idx*2+1, &value);
 
                     Attribute_ID prop_id = Schema_AddAttribute(schema, SCHEMA_EDGE, key->stringval);
-                    GraphEntity_AddProperty((GraphEntity*)e, prop_id, *value);
+                    SIValue v = *value;
+                    if(GraphContext_InternValue(op->gc, SCHEMA_EDGE, prop_id, &v)) op->result_set->stats.string_dict_hits++;
+                    GraphEntity_AddProperty((GraphEntity*)e, prop_id, v);
                 }
                 op->result_set->stats.properties_set += propCount;
             }
@@ -13,6 +13,7 @@ OpBase *NewNodeByLabelScanOp(GraphContext *gc, Node *node) {
     nodeByLabelScan->g = gc->g;
     nodeByLabelScan->node = node;
     nodeByLabelScan->_zero_matrix = NULL;
+    nodeByLabelScan->morsels = NULL;
 
     AST *ast = AST_GetFromLTS();
     nodeByLabelScan->nodeRecIdx = AST_GetAliasID(ast, node->alias);
@@ -33,8 +34,10 @@ OpBase *NewNodeByLabelScanOp(GraphContext *gc, Node *node) {
     nodeByLabelScan->op.name = "Node By Label Scan";
     nodeByLabelScan->op.type = OPType_NODE_BY_LABEL_SCAN;
     nodeByLabelScan->op.consume = NodeByLabelScanConsume;
+    nodeByLabelScan->op.consume_batch = NodeByLabelScanConsumeBatch;
     nodeByLabelScan->op.reset = NodeByLabelScanReset;
     nodeByLabelScan->op.free = NodeByLabelScanFree;
+    nodeByLabelScan->op.clone = NodeByLabelScanClone;
     
     nodeByLabelScan->op.modifies = NewVector(char*, 1);
     Vector_Push(nodeByLabelScan->op.modifies, node->alias);
@@ -42,13 +45,37 @@ OpBase *NewNodeByLabelScanOp(GraphContext *gc, Node *node) {
     return (OpBase*)nodeByLabelScan;
 }
 
+OpBase *NodeByLabelScanClone(OpBase *opBase) {
+    NodeByLabelScan *op = (NodeByLabelScan*)opBase;
+    return NewNodeByLabelScanOp(GraphContext_GetFromLTS(), op->node);
+}
+
+void NodeByLabelScanSetMorsels(OpBase *opBase, MorselSource *morsels) {
+    NodeByLabelScan *op = (NodeByLabelScan*)opBase;
+    op->morsels = morsels;
+    // Nothing is scanned until the first morsel is claimed.
+    GxB_MatrixTupleIter_iterate_range(op->iter, 0, 0);
+}
+
+/* Sets nodeId to the next scanned node ID, moving on to the next morsel
+ * if required, returns false once depleted. */
+static bool _NodeByLabelScan_Next(NodeByLabelScan *op, GrB_Index *nodeId) {
+    bool depleted = false;
+    uint64_t start;
+    uint64_t end;
+    while(true) {
+        GxB_MatrixTupleIter_next(op->iter, NULL, nodeId, &depleted);
+        if(!depleted) return true;
+        if(!op->morsels || !MorselSource_Next(op->morsels, &start, &end)) return false;
+        GxB_MatrixTupleIter_iterate_range(op->iter, start, end);
+    }
+}
+
 Record NodeByLabelScanConsume(OpBase *opBase) {
     NodeByLabelScan *op = (NodeByLabelScan*)opBase;
     
     GrB_Index nodeId;
-    bool depleted = false;    
-    GxB_MatrixTupleIter_next(op->iter, NULL, &nodeId, &depleted);
-    if(depleted) return NULL;
+    if(!_NodeByLabelScan_Next(op, &nodeId)) return NULL;
     
     Record r = Record_New(op->recLength);
     // Get a pointer to a heap allocated node.
@@ -58,6 +85,23 @@ Record NodeByLabelScanConsume(OpBase *opBase) {
     return r;
 }
 
+RecordBatch *NodeByLabelScanConsumeBatch(OpBase *opBase) {
+    NodeByLabelScan *op = (NodeByLabelScan*)opBase;
+    if(!op->op.batch) op->op.batch = RecordBatch_New(RECORD_BATCH_CAP);
+    RecordBatch *batch = op->op.batch;
+
+    GrB_Index nodeId;
+    for(batch->len = 0; batch->len < batch->cap; batch->len++) {
+        if(!_NodeByLabelScan_Next(op, &nodeId)) break;
+
+        Record r = RecordBatch_Slot(batch, batch->len, op->recLength);
+        Node *n = Record_GetNode(r, op->nodeRecIdx);
+        Graph_GetNode(op->g, nodeId, n);
+    }
+
+    return (batch->len) ? batch : NULL;
+}
+
 OpResult NodeByLabelScanReset(OpBase *ctx) {
     NodeByLabelScan *op = (NodeByLabelScan*)ctx;
     GxB_MatrixTupleIter_reset(op->iter);
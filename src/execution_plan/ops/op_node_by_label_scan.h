@@ -11,6 +11,7 @@
 #include "op.h"
 #include "../../graph/entities/node.h"
 #include "../../graph/graph.h"
+#include "../morsel.h"
 #include "../../../deps/GraphBLAS/Include/GraphBLAS.h"
 
 /* NodeByLabelScan, scans entire label. */
@@ -23,15 +24,23 @@ typedef struct {
     Graph *g;
     GxB_MatrixTupleIter *iter;
     GrB_Matrix _zero_matrix;    /* Fake matrix, in-case label does not exists. */
+    MorselSource *morsels;      /* Shared ID ranges when scanning in parallel, NULL otherwise. */
 } NodeByLabelScan;
 
 /* Creates a new NodeByLabelScan operation */
 OpBase *NewNodeByLabelScanOp(GraphContext *gc, Node *node);
 
+OpBase *NodeByLabelScanClone(OpBase *opBase);
+
+void NodeByLabelScanSetMorsels(OpBase *opBase, MorselSource *morsels);
+
 /* NodeByLabelScan next operation
  * called each time a new ID is required */
 Record NodeByLabelScanConsume(OpBase *opBase);
 
+/* NodeByLabelScan next batch of scanned nodes. */
+RecordBatch *NodeByLabelScanConsumeBatch(OpBase *opBase);
+
 /* Restart iterator */
 OpResult NodeByLabelScanReset(OpBase *ctx);
 
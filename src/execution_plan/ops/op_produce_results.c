@@ -19,6 +19,7 @@ OpBase* NewProduceResultsOp(ResultSet *result_set, QueryGraph* graph) {
     produceResults->op.name = "Produce Results";
     produceResults->op.type = OPType_PRODUCE_RESULTS;
     produceResults->op.consume = ProduceResultsConsume;
+    produceResults->op.consume_batch = ProduceResultsConsumeBatch;
     produceResults->op.reset = ProduceResultsReset;
     produceResults->op.free = ProduceResultsFree;
 
@@ -43,6 +44,30 @@ Record ProduceResultsConsume(OpBase *opBase) {
     return r;
 }
 
+RecordBatch *ProduceResultsConsumeBatch(OpBase *opBase) {
+    ProduceResults *op = (ProduceResults*)opBase;
+    if(ResultSet_Full(op->result_set)) return NULL;
+
+    if(!op->op.childCount) {
+        ProduceResultsConsume(opBase);
+        return NULL;
+    }
+
+    OpBase *child = op->op.children[0];
+    RecordBatch *batch = OpBase_ConsumeBatch(child);
+    if(!batch) return NULL;
+
+    /* Append to final result set, batch is trimmed
+     * to the records accepted by the result set. */
+    uint i = 0;
+    for(; i < batch->len && !ResultSet_Full(op->result_set); i++) {
+        ResultSet_AddRecord(op->result_set, batch->records[i]);
+    }
+    batch->len = i;
+
+    return (batch->len) ? batch : NULL;
+}
+
 /* Restart */
 OpResult ProduceResultsReset(OpBase *op) {
     return OP_OK;
@@ -30,6 +30,10 @@ OpBase* NewProduceResultsOp(ResultSet *result_set, QueryGraph *graph);
  * called each time a new result record is required */
 Record ProduceResultsConsume(OpBase *op);
 
+/* ProduceResults next batch operation
+ * appends an entire batch of records to the result set */
+RecordBatch *ProduceResultsConsumeBatch(OpBase *op);
+
 /* Restart iterator */
 OpResult ProduceResultsReset(OpBase *ctx);
 
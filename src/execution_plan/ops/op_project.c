@@ -6,15 +6,13 @@
 */
 
 #include "op_project.h"
+#include <assert.h>
 #include "../../util/arr.h"
 #include "../../query_executor.h"
 
-static void _buildExpressions(Project *op) {
+static void _buildProjectedExpressions(Project *op) {
     // Compute projected record length:
     // Number of returned expressions + number of order-by expressions.
-    ExpandCollapsedNodes(op->ast);
-    ResultSet_CreateHeader(op->resultset);
-
     const AST *ast = op->ast;
     uint orderByExpCount = 0;
     uint returnExpCount = array_len(ast->returnNode->returnElements);
@@ -37,6 +35,12 @@ static void _buildExpressions(Project *op) {
     }
 }
 
+static void _buildExpressions(Project *op) {
+    ExpandCollapsedNodes(op->ast);
+    ResultSet_CreateHeader(op->resultset);
+    _buildProjectedExpressions(op);
+}
+
 OpBase* NewProjectOp(ResultSet *resultset) {
     Project *project = malloc(sizeof(Project));
     project->ast = AST_GetFromLTS();
@@ -49,34 +53,27 @@ OpBase* NewProjectOp(ResultSet *resultset) {
     project->op.name = "Project";
     project->op.type = OPType_PROJECT;
     project->op.consume = ProjectConsume;
+    project->op.consume_batch = ProjectConsumeBatch;
     project->op.reset = ProjectReset;
     project->op.free = ProjectFree;
+    project->op.clone = ProjectClone;
 
     return (OpBase*)project;
     return NULL;
 }
 
-Record ProjectConsume(OpBase *opBase) {
+OpBase* ProjectClone(OpBase *opBase) {
     Project *op = (Project*)opBase;
-    Record r = NULL;
-
-    if(op->op.childCount) {
-        OpBase *child = op->op.children[0];
-        r = child->consume(child);
-        if(!r) return NULL;
-    } else {
-        // QUERY: RETURN 1+2
-        // Return a single record followed by NULL
-        // on the second call.
-        if(op->singleResponse) return NULL;
-        op->singleResponse = true;
-        r = Record_New(0);  // Fake empty record.
-    }
-
+    // Return clause is expanded and header created exactly once.
     if(!op->expressions) _buildExpressions(op);
 
-    Record projectedRec = Record_New(op->projectedRecordLen);
+    Project *clone = (Project*)NewProjectOp(op->resultset);
+    _buildProjectedExpressions(clone);
+    return (OpBase*)clone;
+}
 
+// Evaluates projected expressions against r, populating projectedRec.
+static void _ProjectRecord(Project *op, Record r, Record projectedRec) {
     uint expIdx = 0;
     uint expCount = array_len(op->expressions);
     uint returnExpCount = array_len(op->ast->returnNode->returnElements);
@@ -98,11 +95,65 @@ Record ProjectConsume(OpBase *opBase) {
         SIValue v = AR_EXP_Evaluate(op->expressions[expIdx], r);
         Record_AddScalar(projectedRec, expIdx, v);
     }
+}
+
+Record ProjectConsume(OpBase *opBase) {
+    Project *op = (Project*)opBase;
+    Record r = NULL;
+
+    if(op->op.childCount) {
+        OpBase *child = op->op.children[0];
+        r = child->consume(child);
+        if(!r) return NULL;
+    } else {
+        // QUERY: RETURN 1+2
+        // Return a single record followed by NULL
+        // on the second call.
+        if(op->singleResponse) return NULL;
+        op->singleResponse = true;
+        r = Record_New(0);  // Fake empty record.
+    }
+
+    if(!op->expressions) _buildExpressions(op);
+
+    Record projectedRec = Record_New(op->projectedRecordLen);
+    _ProjectRecord(op, r, projectedRec);
 
     Record_Free(r);
     return projectedRec;
 }
 
+RecordBatch *ProjectConsumeBatch(OpBase *opBase) {
+    Project *op = (Project*)opBase;
+    if(!op->op.batch) op->op.batch = RecordBatch_New(RECORD_BATCH_CAP);
+    RecordBatch *batch = op->op.batch;
+
+    if(!op->op.childCount) {
+        // QUERY: RETURN 1+2
+        // A batch holding a single record.
+        Record r = ProjectConsume(opBase);
+        if(!r) return NULL;
+        RecordBatch_Set(batch, 0, r);
+        batch->len = 1;
+        return batch;
+    }
+
+    OpBase *child = op->op.children[0];
+    RecordBatch *childBatch = OpBase_ConsumeBatch(child);
+    if(!childBatch) return NULL;
+
+    if(!op->expressions) _buildExpressions(op);
+
+    // Child and projected batches are of the same capacity.
+    assert(childBatch->len <= batch->cap);
+    for(batch->len = 0; batch->len < childBatch->len; batch->len++) {
+        Record projectedRec = RecordBatch_Slot(batch, batch->len, op->projectedRecordLen);
+        _ProjectRecord(op, childBatch->records[batch->len], projectedRec);
+    }
+
+    return batch;
+}
+
 OpResult ProjectReset(OpBase *ctx) {
     return OP_OK;
 }
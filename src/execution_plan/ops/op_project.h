@@ -25,8 +25,13 @@ typedef struct {
 
 OpBase* NewProjectOp(ResultSet *resultset);
 
+/* Clones project, result-set header is created by the original operation. */
+OpBase* ProjectClone(OpBase *opBase);
+
 Record ProjectConsume(OpBase *op);
 
+RecordBatch *ProjectConsumeBatch(OpBase *op);
+
 OpResult ProjectReset(OpBase *ctx);
 
 void ProjectFree(OpBase *ctx);
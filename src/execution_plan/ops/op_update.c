@@ -132,6 +132,16 @@ static void _UpdateIndex(EntityUpdateCtx *ctx, SIValue *old_value, SIValue *new_
 static void _CommitUpdates(OpUpdate *op) {
     EntityUpdateCtx *ctx;
 
+    /* Store a single copy of string values, new values may refer to
+     * properties replaced by earlier updates, as such all of them
+     * are resolved before any property is replaced. */
+    for(int i = 0; i < op->pending_updates_count; i++) {
+        ctx = &op->pending_updates[i];
+        SchemaType t = (ctx->ge->t == N_ENTITY) ? SCHEMA_NODE : SCHEMA_EDGE;
+        if(GraphContext_InternValue(op->gc, t, ctx->attribute_idx, &ctx->new_value) && op->result_set)
+            op->result_set->stats.string_dict_hits++;
+    }
+
     for(int i = 0; i < op->pending_updates_count; i++) {
         ctx = &op->pending_updates[i];
         
@@ -145,7 +155,7 @@ static void _CommitUpdates(OpUpdate *op) {
 
         // Try to get current property value.
         SIValue *old_value = GraphEntity_GetProperty(&graph_entity, ctx->attribute_idx);
-        
+
         // Update index for node entities, edges are not indexed.
         if(ctx->ge->t == N_ENTITY) _UpdateIndex(ctx, old_value, &ctx->new_value);
 
@@ -26,5 +26,10 @@
 #include "op_unwind.h"
 #include "op_sort.h"
 #include "op_project.h"
+#include "op_entity_count.h"
+#include "op_expand_count.h"
+#include "op_gather.h"
+#include "op_hash_join.h"
+#include "op_expand_into.h"
 
 #endif
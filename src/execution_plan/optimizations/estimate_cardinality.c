@@ -0,0 +1,246 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include <math.h>
+#include "./estimate_cardinality.h"
+#include "../ops/ops.h"
+#include "../../util/arr.h"
+#include "../../parser/grammar.h"
+
+#define VAR_LEN_ESTIMATE_HOPS 4     // Maximum number of hops considered by variable length estimates.
+
+// Label ID of node, GRAPH_NO_LABEL if unlabeled or label is unknown.
+static int _nodeLabelID(const GraphContext *gc, const Node *n) {
+    if(!n || !n->label) return GRAPH_NO_LABEL;
+    Schema *s = GraphContext_GetSchema(gc, n->label, SCHEMA_NODE);
+    return (s) ? s->id : GRAPH_NO_LABEL;
+}
+
+// Checks if every alias within exp is the given alias.
+static bool _refersOnly(const AR_ExpNode *exp, const char *alias) {
+    if(exp->type == AR_EXP_OP) {
+        for(int i = 0; i < exp->op.child_count; i++) {
+            if(!_refersOnly(exp->op.children[i], alias)) return false;
+        }
+        return true;
+    }
+
+    if(exp->operand.type != AR_EXP_VARIADIC) return true;
+    const char *entity = exp->operand.variadic.entity_alias;
+    return !entity || strcmp(entity, alias) == 0;
+}
+
+// Estimated fraction of entities passing predicate.
+static double _predicateSelectivity(const GraphContext *gc, const QueryGraph *q,
+                                    const Node *n, const FT_PredicateNode *pred) {
+    AR_ExpNode *property = NULL;
+    int lhsType = AR_EXP_GetOperandType(pred->lhs);
+    int rhsType = AR_EXP_GetOperandType(pred->rhs);
+    if(lhsType == AR_EXP_VARIADIC && rhsType == AR_EXP_CONSTANT) property = pred->lhs;
+    else if(lhsType == AR_EXP_CONSTANT && rhsType == AR_EXP_VARIADIC) property = pred->rhs;
+
+    switch(pred->op) {
+        case EQ:
+            break;
+        case NE:
+            return INEQUALITY_SELECTIVITY;
+        case LT:
+        case LE:
+        case GT:
+        case GE:
+            return RANGE_SELECTIVITY;
+        default:
+            return UNKNOWN_SELECTIVITY;
+    }
+
+    // Property compared for equality against a constant, consult index.
+    if(property && property->operand.variadic.entity_prop) {
+        const char *alias = property->operand.variadic.entity_alias;
+        const Node *entity = n;
+        if(!entity && q) entity = QueryGraph_GetNodeByAlias(q, alias);
+        if(entity && entity->label) {
+            Index *idx = GraphContext_GetIndex(gc, entity->label, property->operand.variadic.entity_prop);
+            if(idx) {
+                uint64_t distinct = Index_DistinctValues(idx);
+                if(distinct > 0) return 1.0 / distinct;
+            }
+        }
+    }
+
+    return EQUALITY_SELECTIVITY;
+}
+
+double estimateFilterSelectivity(const GraphContext *gc, const QueryGraph *q,
+                                 const Node *n, const FT_FilterNode *tree) {
+    if(!tree) return 1;
+
+    if(tree->t == FT_N_COND) {
+        double l = estimateFilterSelectivity(gc, q, n, tree->cond.left);
+        double r = estimateFilterSelectivity(gc, q, n, tree->cond.right);
+        if(tree->cond.op == AND) return l * r;
+        // Predicates which do not refer to n do not filter it.
+        if(n && (l == 1 || r == 1)) return 1;
+        return l + r - l * r;
+    }
+
+    if(n && !(_refersOnly(tree->pred.lhs, n->alias) && _refersOnly(tree->pred.rhs, n->alias))) {
+        return 1;
+    }
+    return _predicateSelectivity(gc, q, n, &tree->pred);
+}
+
+double estimateNodeScan(const GraphContext *gc, const Node *n, const FT_FilterNode *tree) {
+    const Graph *g = gc->g;
+    double rows = Graph_NodeCount(g);
+    if(n->label) {
+        int label = _nodeLabelID(gc, n);
+        rows = (label == GRAPH_NO_LABEL) ? 0 : GraphStatistics_NodeCount(Graph_GetStatistics(g), label);
+    }
+    return rows * estimateFilterSelectivity(gc, NULL, n, tree);
+}
+
+/* Estimated number of nodes reached from a single node by applying expression,
+ * operands are applied right to left, starting at the source node. */
+static double _traverseFanout(const GraphContext *gc, const AlgebraicExpression *ae) {
+    const Graph *g = gc->g;
+    const GraphStatistics *stats = Graph_GetStatistics(g);
+    double nodes = Graph_NodeCount(g);
+    if(nodes == 0) return 0;
+
+    double fanout = 1;
+    int label = _nodeLabelID(gc, ae->src_node);     // Label of current nodes.
+    int relation = GRAPH_NO_RELATION;               // Relation type current nodes were reached by.
+    bool outgoing = true;                           // Direction of last traversed relation.
+    for(int i = ae->operand_count - 1; i >= 0; i--) {
+        const AlgebraicExpressionOperand *operand = ae->operands + i;
+        char type;
+        int id;
+        bool transposed;
+
+        // Expression owned matrix, e.g. multiple relation types.
+        if(!Graph_IdentifyMatrix(g, operand->operand, &type, &id, &transposed)) {
+            fanout *= Graph_EdgeCount(g) / nodes;
+            label = GRAPH_NO_LABEL;
+            relation = GRAPH_NO_RELATION;
+            continue;
+        }
+
+        // Label matrix keeps only nodes of given label.
+        if(type == 'L') {
+            if(relation != GRAPH_NO_RELATION) {
+                // Fraction of traversed edges ending at labeled nodes.
+                uint64_t edges = GraphStatistics_EdgeCount(stats, relation);
+                fanout *= (edges) ? GraphStatistics_LabelEdgeCount(stats, relation, id, !outgoing) / (double)edges : 0;
+            } else if(label != id) {
+                fanout *= GraphStatistics_NodeCount(stats, id) / nodes;
+            }
+            label = id;
+            relation = GRAPH_NO_RELATION;
+            continue;
+        }
+
+        // Relation matrix, average degree of current nodes.
+        outgoing = (operand->transpose == transposed);
+        uint64_t labeled = GraphStatistics_NodeCount(stats, label);
+        if(type == 'R' && label != GRAPH_NO_LABEL && labeled > 0) {
+            fanout *= GraphStatistics_LabelEdgeCount(stats, id, label, outgoing) / (double)labeled;
+        } else if(type == 'R') {
+            fanout *= GraphStatistics_EdgeCount(stats, id) / nodes;
+        } else {
+            fanout *= Graph_EdgeCount(g) / nodes;
+        }
+        label = GRAPH_NO_LABEL;
+        relation = (type == 'R') ? id : GRAPH_NO_RELATION;
+    }
+
+    return fanout;
+}
+
+// Estimated number of nodes reached from a single node by a variable length traversal.
+static double _varLenFanout(const GraphContext *gc, const CondVarLenTraverse *op) {
+    const Graph *g = gc->g;
+    double nodes = Graph_NodeCount(g);
+    if(nodes == 0) return 0;
+
+    double edges = 0;
+    for(int i = 0; i < op->relationIDsCount; i++) {
+        int r = op->relationIDs[i];
+        if(r == GRAPH_NO_RELATION) edges += Graph_EdgeCount(g);
+        else edges += GraphStatistics_EdgeCount(Graph_GetStatistics(g), r);
+    }
+    double degree = edges / nodes;
+    if(op->traverseDir == GRAPH_EDGE_DIR_BOTH) degree *= 2;
+
+    // Sum reachable nodes over hop counts.
+    double fanout = 0;
+    unsigned int maxHops = MIN(op->maxHops, op->minHops + VAR_LEN_ESTIMATE_HOPS);
+    for(unsigned int hops = op->minHops; hops <= maxHops; hops++) fanout += pow(degree, hops);
+    return fanout;
+}
+
+static double _estimate(const GraphContext *gc, const ExecutionPlan *plan, OpBase *op) {
+    double rows = 1;
+    double children = 1;
+    for(int i = 0; i < op->childCount; i++) children *= _estimate(gc, plan, op->children[i]);
+
+    switch(op->type) {
+        case OPType_ALL_NODE_SCAN:
+            rows = children * Graph_NodeCount(gc->g);
+            break;
+        case OPType_NODE_BY_LABEL_SCAN:
+            rows = children * estimateNodeScan(gc, ((NodeByLabelScan*)op)->node, NULL);
+            break;
+        case OPType_INDEX_SCAN:
+            // Estimated once index was selected.
+            rows = children * MAX(op->estimate, 0);
+            break;
+        case OPType_CONDITIONAL_TRAVERSE:
+            rows = children * _traverseFanout(gc, ((CondTraverse*)op)->algebraic_expression);
+            break;
+        case OPType_EXPAND_INTO: {
+            // Fraction of node pairs connected by expression.
+            double nodes = Graph_NodeCount(gc->g);
+            double fanout = _traverseFanout(gc, ((ExpandInto*)op)->ae);
+            rows = (nodes) ? children * MIN(1, fanout / nodes) : 0;
+            break;
+        }
+        case OPType_CONDITIONAL_VAR_LEN_TRAVERSE:
+            rows = children * _varLenFanout(gc, (CondVarLenTraverse*)op);
+            break;
+        case OPType_FILTER:
+            rows = children * estimateFilterSelectivity(gc, plan->query_graph, NULL,
+                                                        ((Filter*)op)->filterTree);
+            break;
+        case OPType_AGGREGATE: {
+            Aggregate *aggregate = (Aggregate*)op;
+            rows = (ReturnClause_AggregatesAll(aggregate->ast->returnNode)) ? 1 : children;
+            break;
+        }
+        case OPType_SORT: {
+            Sort *sort = (Sort*)op;
+            rows = (sort->limit) ? MIN(children, sort->limit) : children;
+            break;
+        }
+        case OPType_HASH_JOIN:
+            // Assume each probed record joins a single build record.
+            rows = MAX(op->children[0]->estimate, op->children[1]->estimate);
+            break;
+        case OPType_UNWIND:
+            rows = children * Vector_Size(((OpUnwind*)op)->unwindClause->expressions);
+            break;
+        default:
+            rows = children;
+            break;
+    }
+
+    op->estimate = rows;
+    return rows;
+}
+
+void estimateCardinality(const GraphContext *gc, ExecutionPlan *plan) {
+    _estimate(gc, plan, plan->root);
+}
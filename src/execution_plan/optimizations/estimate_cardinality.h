@@ -0,0 +1,39 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __ESTIMATE_CARDINALITY_H__
+#define __ESTIMATE_CARDINALITY_H__
+
+#include "../execution_plan.h"
+#include "../../graph/graphcontext.h"
+#include "../../filter_tree/filter_tree.h"
+
+#define EQUALITY_SELECTIVITY 0.1    // Fraction of entities passing an unindexed equality predicate.
+#define RANGE_SELECTIVITY 0.3       // Fraction of entities passing a range predicate.
+#define INEQUALITY_SELECTIVITY 0.9  // Fraction of entities passing an inequality predicate.
+#define UNKNOWN_SELECTIVITY 0.5     // Fraction of entities passing any other predicate.
+
+/* Cardinality estimates are derived from the graph statistics,
+ * node count per label, edge count per relation type, average degree
+ * of labeled nodes and the number of distinct values held by indices.
+ * Predicates are assumed to be independent of one another. */
+
+/* Estimates the fraction of records passing filter tree, when n is specified
+ * only predicates applied solely to n are considered,
+ * aliases are resolved to node labels via q. */
+double estimateFilterSelectivity(const GraphContext *gc, const QueryGraph *q,
+                                 const Node *n, const FT_FilterNode *tree);
+
+/* Estimates the number of nodes produced by scanning n,
+ * after applying predicates within tree which refer to n. */
+double estimateNodeScan(const GraphContext *gc, const Node *n, const FT_FilterNode *tree);
+
+/* Annotates every operation in plan with the
+ * estimated number of records it produces. */
+void estimateCardinality(const GraphContext *gc, ExecutionPlan *plan);
+
+#endif
@@ -0,0 +1,39 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./expand_into.h"
+#include "../ops/ops.h"
+
+// Checks if both ends of traversal are resolved by the operations it consumes.
+static bool _boundEnds(CondTraverse *traverse) {
+    AlgebraicExpression *ae = traverse->algebraic_expression;
+    Vector *references = NewVector(char*, 2);
+    Vector_Push(references, ae->src_node->alias);
+    Vector_Push(references, ae->dest_node->alias);
+    OpBase *op = ExecutionPlan_Locate_References(traverse->op.children[0], references);
+    Vector_Free(references);
+    return op != NULL;
+}
+
+static void _expandInto(OpBase *op) {
+    for(int i = 0; i < op->childCount; i++) _expandInto(op->children[i]);
+    if(op->type != OPType_CONDITIONAL_TRAVERSE || op->childCount != 1) return;
+
+    CondTraverse *traverse = (CondTraverse*)op;
+    if(!ExpandInto_Applicable(traverse->algebraic_expression)) return;
+    if(!_boundEnds(traverse)) return;
+
+    // Expand into takes over traversal expression.
+    OpBase *expandInto = NewExpandIntoOp(traverse->graph, traverse->algebraic_expression);
+    traverse->algebraic_expression = NULL;
+    ExecutionPlan_ReplaceOp(op, expandInto);
+    OpBase_Free(op);
+}
+
+void expandInto(ExecutionPlan *plan) {
+    _expandInto(plan->root);
+}
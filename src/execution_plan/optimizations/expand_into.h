@@ -0,0 +1,21 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __EXPAND_INTO_H__
+#define __EXPAND_INTO_H__
+
+#include "../execution_plan.h"
+
+/* The expand into optimizer looks for single hop traversals
+ * whose destination node is already bound by preceding operations, e.g.
+ * MATCH (a)-[:R]->(b)-[:R]->(c)-[:R]->(a) RETURN a, b, c
+ * where the last hop leads back to a. Such traversals are replaced
+ * by an expand into operation, checking whether each record's nodes
+ * are connected rather than traversing from the source node. */
+void expandInto(ExecutionPlan *plan);
+
+#endif
@@ -0,0 +1,139 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./join_patterns.h"
+#include "./estimate_cardinality.h"
+#include "../ops/ops.h"
+#include "../../util/arr.h"
+#include "../../parser/grammar.h"
+#include "../../util/triemap/triemap.h"
+#include <string.h>
+
+// Collects aliases resolved by operations rooted at op.
+static void _resolvedAliases(const OpBase *op, TrieMap *aliases) {
+    if(op->modifies) {
+        for(int i = 0; i < Vector_Size(op->modifies); i++) {
+            char *alias;
+            Vector_Get(op->modifies, i, &alias);
+            TrieMap_Add(aliases, alias, strlen(alias), NULL, NULL);
+        }
+    }
+    for(int i = 0; i < op->childCount; i++) _resolvedAliases(op->children[i], aliases);
+}
+
+/* Determines the branch resolving every alias referenced by exp,
+ * branch remains -1 if exp doesn't reference any alias.
+ * Returns false if references are spread across branches. */
+static bool _expBranch(AR_ExpNode *exp, TrieMap **branches, int branchCount, int *branch) {
+    if(exp->type == AR_EXP_OP) {
+        for(int i = 0; i < exp->op.child_count; i++) {
+            if(!_expBranch(exp->op.children[i], branches, branchCount, branch)) return false;
+        }
+        return true;
+    }
+
+    if(exp->operand.type != AR_EXP_VARIADIC) return true;
+    char *alias = exp->operand.variadic.entity_alias;
+    for(int i = 0; i < branchCount; i++) {
+        if(TrieMap_Find(branches[i], alias, strlen(alias)) == TRIEMAP_NOTFOUND) continue;
+        if(*branch != -1 && *branch != i) return false;
+        *branch = i;
+        return true;
+    }
+    return false;
+}
+
+/* Replaces cartesian product branches build and probe
+ * with a hash join of the two, returns the join operation. */
+static OpBase *_joinBranches(OpBase *cartesianProduct, int build, int probe,
+                             AR_ExpNode *buildExp, AR_ExpNode *probeExp) {
+    OpBase *buildOp = cartesianProduct->children[build];
+    OpBase *probeOp = cartesianProduct->children[probe];
+    OpBase *join = NewHashJoinOp(buildExp, probeExp);
+    ExecutionPlan_AddOp(join, buildOp);
+    ExecutionPlan_AddOp(join, probeOp);
+    // Assume each probed record joins a single build record.
+    join->estimate = MAX(buildOp->estimate, probeOp->estimate);
+
+    // Join takes the place of build branch, probe branch is removed.
+    cartesianProduct->children[build] = join;
+    join->parent = cartesianProduct;
+    cartesianProduct->childCount--;
+    for(int i = probe; i < cartesianProduct->childCount; i++) {
+        cartesianProduct->children[i] = cartesianProduct->children[i+1];
+    }
+    return join;
+}
+
+/* Replaces a single equality predicate spanning two branches
+ * of cartesian product with a hash join, returns false if there's none. */
+static bool _joinPredicate(OpBase *cartesianProduct) {
+    int branchCount = cartesianProduct->childCount;
+    TrieMap *branches[branchCount];
+    for(int i = 0; i < branchCount; i++) {
+        branches[i] = NewTrieMap();
+        _resolvedAliases(cartesianProduct->children[i], branches[i]);
+    }
+
+    // Filters spanning several branches are placed right above cartesian product.
+    Filter *filter = NULL;
+    int lhs, rhs;
+    for(OpBase *op = cartesianProduct->parent; op && op->type == OPType_FILTER; op = op->parent) {
+        FT_FilterNode *tree = ((Filter*)op)->filterTree;
+        if(tree->t != FT_N_PRED || tree->pred.op != EQ) continue;
+
+        lhs = -1;
+        rhs = -1;
+        if(!_expBranch(tree->pred.lhs, branches, branchCount, &lhs)) continue;
+        if(!_expBranch(tree->pred.rhs, branches, branchCount, &rhs)) continue;
+        if(lhs == -1 || rhs == -1 || lhs == rhs) continue;
+
+        filter = (Filter*)op;
+        break;
+    }
+
+    for(int i = 0; i < branchCount; i++) TrieMap_Free(branches[i], TrieMap_NOP_CB);
+    if(!filter) return false;
+
+    // Hash the branch estimated to produce fewer records.
+    FT_PredicateNode *pred = &filter->filterTree->pred;
+    OpBase **children = cartesianProduct->children;
+    if(children[lhs]->estimate <= children[rhs]->estimate) {
+        _joinBranches(cartesianProduct, lhs, rhs, pred->lhs, pred->rhs);
+    } else {
+        _joinBranches(cartesianProduct, rhs, lhs, pred->rhs, pred->lhs);
+    }
+
+    // Predicate is evaluated by the join.
+    ExecutionPlan_RemoveOp((OpBase*)filter);
+    OpBase_Free((OpBase*)filter);
+    return true;
+}
+
+static void _joinCartesianProducts(OpBase *op) {
+    for(int i = 0; i < op->childCount; i++) _joinCartesianProducts(op->children[i]);
+    if(op->type != OPType_CARTESIAN_PRODUCT) return;
+
+    while(op->childCount > 1 && _joinPredicate(op));
+
+    // All branches were joined, the cartesian product is redundant.
+    if(op->childCount == 1) {
+        OpBase *join = op->children[0];
+        OpBase *parent = op->parent;
+        for(int i = 0; i < parent->childCount; i++) {
+            if(parent->children[i] == op) parent->children[i] = join;
+        }
+        join->parent = parent;
+        OpBase_Free(op);
+    }
+}
+
+void joinPatterns(const GraphContext *gc, ExecutionPlan *plan) {
+    // Branch estimates determine which side of a join is hashed.
+    estimateCardinality(gc, plan);
+    _joinCartesianProducts(plan->root);
+}
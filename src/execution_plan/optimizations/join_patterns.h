@@ -0,0 +1,22 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __JOIN_PATTERNS_H__
+#define __JOIN_PATTERNS_H__
+
+#include "../execution_plan.h"
+#include "../../graph/graphcontext.h"
+
+/* The join patterns optimizer looks for equality predicates
+ * comparing entities of different patterns, e.g.
+ * MATCH (u:User), (o:Order) WHERE u.id = o.user_id RETURN u, o
+ * rather than filtering the cartesian product of both patterns,
+ * the pattern estimated to produce fewer records is hashed by its side
+ * of the predicate and the other pattern probes the hash table. */
+void joinPatterns(const GraphContext *gc, ExecutionPlan *plan);
+
+#endif
@@ -13,5 +13,10 @@
 #include "./utilize_indices.h"
 #include "./select_entry_point.h"
 #include "./reduce_scans.h"
+#include "./reduce_count.h"
+#include "./estimate_cardinality.h"
+#include "./parallelize_scans.h"
+#include "./join_patterns.h"
+#include "./expand_into.h"
 
 #endif
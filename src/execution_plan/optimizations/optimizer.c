@@ -9,13 +9,28 @@
 #include "./optimizations.h"
 
 void optimizePlan(GraphContext *gc, ExecutionPlan *plan) {
+    /* Check connectivity of bound nodes with point lookups. */
+    expandInto(plan);
+
+    /* Answer entity counts directly from the graph matrices. */
+    reduceCount(gc, plan);
+
     /* When possible, replace label scan and filter ops
      * with index scans. */
     utilizeIndices(gc, plan);
 
+    /* Join patterns on equality predicates using hash joins. */
+    joinPatterns(gc, plan);
+
     /* Try to reduce a number of filters into a single filter op. */
     reduceFilters(plan);
 
     /* Remove redundant SCAN operations. */
     // reduceScans(plan);
+
+    /* Annotate operations with estimated number of records. */
+    estimateCardinality(gc, plan);
+
+    /* Execute large read-only scans on multiple threads. */
+    parallelizeScans(gc, plan);
 }
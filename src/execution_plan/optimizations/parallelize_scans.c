@@ -0,0 +1,52 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./parallelize_scans.h"
+#include "../ops/ops.h"
+
+extern int _parallelWorkers;        // Number of threads executing a parallel query.
+extern size_t _parallelThreshold;   // Number of scanned nodes above which queries run in parallel.
+
+// Checks if operations rooted at op only read from the graph.
+static bool _readOnly(const OpBase *op) {
+    switch(op->type) {
+        case OPType_CREATE:
+        case OPType_UPDATE:
+        case OPType_DELETE:
+        case OPType_MERGE:
+            return false;
+        default:
+            break;
+    }
+
+    for(int i = 0; i < op->childCount; i++) {
+        if(!_readOnly(op->children[i])) return false;
+    }
+    return true;
+}
+
+void parallelizeScans(GraphContext *gc, ExecutionPlan *plan) {
+    if(_parallelWorkers < 2 || _parallelThreshold == 0) return;
+    if(!_readOnly(plan->root)) return;
+
+    // Locate scan at the bottom of a single pipeline.
+    OpBase *scan = plan->root;
+    while(scan->childCount == 1) scan = scan->children[0];
+    if(scan->childCount != 0 || !Gather_Parallelizable(scan)) return;
+    if(scan->estimate < (double)_parallelThreshold) return;
+
+    // Extend parallel section upwards, as long as operations can be cloned.
+    OpBase *top = scan;
+    while(top->parent && Gather_Parallelizable(top->parent)) top = top->parent;
+
+    // Scanning alone isn't worth the exchange.
+    if(top == scan || !top->parent) return;
+
+    OpBase *gather = NewGatherOp(gc, _parallelWorkers);
+    gather->estimate = top->estimate;
+    ExecutionPlan_PushBelow(top, gather);
+}
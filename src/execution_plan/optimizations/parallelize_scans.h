@@ -0,0 +1,25 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __PARALLELIZE_SCANS_H__
+#define __PARALLELIZE_SCANS_H__
+
+#include "../execution_plan.h"
+#include "../../graph/graphcontext.h"
+
+/* The parallelize scans optimizer looks for a read-only query
+ * whose leading scan is estimated to produce more nodes than the
+ * configured threshold, e.g.
+ * MATCH (a:User)-[:FOLLOWS]->(b) WHERE b.age > 30 RETURN count(a)
+ * the scan along with the filters, traversals and projection
+ * consuming it are executed by multiple workers, each scanning
+ * a different range of node IDs, a gather operation placed on top
+ * of them merges the workers' records before they're aggregated,
+ * sorted or returned. */
+void parallelizeScans(GraphContext *gc, ExecutionPlan *plan);
+
+#endif
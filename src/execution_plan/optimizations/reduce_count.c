@@ -0,0 +1,208 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./reduce_count.h"
+#include "../ops/ops.h"
+#include "../../util/arr.h"
+#include <string.h>
+#include <strings.h>
+
+/* Checks if return element is count(*) or count(alias),
+ * where alias is an entity of the query graph. Every record produced
+ * by the pattern binds each of its entities, so all of these count records. */
+static bool _countsRecords(const QueryGraph *q, const AST_ReturnElementNode *elem) {
+    const AST_ArithmeticExpressionNode *exp = elem->exp;
+    if(!exp || exp->type != AST_AR_EXP_OP) return false;
+    if(strcasecmp(exp->op.function, "count") != 0) return false;
+    if(Vector_Size(exp->op.args) != 1) return false;
+
+    AST_ArithmeticExpressionNode *arg;
+    Vector_Get(exp->op.args, 0, &arg);
+    if(arg->type != AST_AR_EXP_OPERAND) return false;
+
+    // count(*) counts a non-null constant.
+    if(arg->operand.type == AST_AR_EXP_CONSTANT) return !SIValue_IsNull(arg->operand.constant);
+
+    // count(n), properties might be missing.
+    if(arg->operand.variadic.property) return false;
+    return QueryGraph_GetEntityByAlias(q, arg->operand.variadic.alias) != NULL;
+}
+
+/* Determines which entities are counted by the operations rooted at op,
+ * returns false if op is not a lone scan or a scan followed by a single hop. */
+static bool _countedEntities(GraphContext *gc, OpBase *op, EntityCountType *type, int *id) {
+    if(op->type == OPType_ALL_NODE_SCAN && op->childCount == 0) {
+        *type = ENTITY_COUNT_NODES;
+        *id = GRAPH_NO_LABEL;
+        return true;
+    }
+
+    if(op->type == OPType_NODE_BY_LABEL_SCAN && op->childCount == 0) {
+        Schema *s = GraphContext_GetSchema(gc, ((NodeByLabelScan*)op)->node->label, SCHEMA_NODE);
+        *type = ENTITY_COUNT_LABEL;
+        *id = (s) ? s->id : GRAPH_NO_LABEL;
+        return true;
+    }
+
+    // ()-[]->(), traversal from all nodes using a single graph matrix.
+    if(op->type != OPType_CONDITIONAL_TRAVERSE || op->childCount != 1) return false;
+    OpBase *scan = op->children[0];
+    if(scan->type != OPType_ALL_NODE_SCAN || scan->childCount != 0) return false;
+
+    AlgebraicExpression *ae = ((CondTraverse*)op)->algebraic_expression;
+    if(ae->operand_count != 1) return false;
+
+    char matrixType;
+    bool transposed;
+    if(!Graph_IdentifyMatrix(gc->g, ae->operands[0].operand, &matrixType, id, &transposed)) return false;
+
+    if(matrixType == 'R') {
+        *type = ENTITY_COUNT_RELATION;
+        return true;
+    }
+    if(matrixType == 'A') {
+        /* Referenced edges are resolved per relation type connecting
+         * each pair of nodes, otherwise only connected pairs are produced. */
+        *type = (ae->edge) ? ENTITY_COUNT_EDGES : ENTITY_COUNT_CONNECTIONS;
+        *id = GRAPH_NO_RELATION;
+        return true;
+    }
+    return false;
+}
+
+/* Checks if expression is evaluated solely from alias,
+ * without aggregating. */
+static bool _refersOnly(const AST_ArithmeticExpressionNode *exp, const char *alias) {
+    if(exp->type == AST_AR_EXP_OPERAND) {
+        if(exp->operand.type == AST_AR_EXP_CONSTANT) return true;
+        return strcmp(exp->operand.variadic.alias, alias) == 0;
+    }
+
+    // Aggregation functions are not registered as arithmetic functions.
+    if(!AR_FuncExists(exp->op.function)) return false;
+    for(int i = 0; i < Vector_Size(exp->op.args); i++) {
+        AST_ArithmeticExpressionNode *arg;
+        Vector_Get(exp->op.args, i, &arg);
+        if(!_refersOnly(arg, alias)) return false;
+    }
+    return true;
+}
+
+// Checks if alias is given to one of the return elements.
+static bool _returnedAlias(const AST_ReturnNode *returnNode, const char *alias) {
+    uint returnElemCount = array_len(returnNode->returnElements);
+    for(uint i = 0; i < returnElemCount; i++) {
+        const char *returned = returnNode->returnElements[i]->alias;
+        if(returned && strcmp(returned, alias) == 0) return true;
+    }
+    return false;
+}
+
+/* Checks if the number of records traversal produces for each source node
+ * can be computed by reducing its expression, sets countEdges if
+ * adjacency entries should be summed rather than counted. */
+static bool _reducibleTraversal(const AST *ast, const CondTraverse *traverse, bool *countEdges) {
+    AlgebraicExpression *ae = traverse->algebraic_expression;
+    if(strcmp(ae->src_node->alias, ae->dest_node->alias) == 0) return false;
+
+    *countEdges = false;
+    if(!ae->edge) return true;
+
+    /* Referenced edges produce a record per relation type connecting
+     * source and destination, a single relation type produces a record per entry,
+     * adjacency entries hold the number of connecting edges. */
+    AST_LinkEntity *e = (AST_LinkEntity*)MatchClause_GetEntity(ast->matchNode, ae->edge->alias);
+    int relationCount = AST_LinkEntity_LabelCount(e);
+    if(relationCount == 1) return true;
+    if(relationCount == 0 && ae->operand_count == 1) {
+        *countEdges = true;
+        return true;
+    }
+    return false;
+}
+
+/* Replaces a grouped count over a single hop traversal, e.g.
+ * MATCH (a:User)-[:FOLLOWS]->(b) RETURN a.name, count(b)
+ * with an expand count operation, passing on each source node once
+ * along with its degree, which is summed by the aggregation. */
+static void _reduceGroupedCount(GraphContext *gc, ExecutionPlan *plan, OpBase *aggregate) {
+    OpBase *op = aggregate->children[0];
+    if(op->type != OPType_CONDITIONAL_TRAVERSE || op->childCount != 1) return;
+    OpBase *scan = op->children[0];
+    if(scan->childCount != 0) return;
+    if(scan->type != OPType_ALL_NODE_SCAN && scan->type != OPType_NODE_BY_LABEL_SCAN) return;
+
+    CondTraverse *traverse = (CondTraverse*)op;
+    AlgebraicExpression *ae = traverse->algebraic_expression;
+    const char *src = ae->src_node->alias;
+
+    // Return elements either count records or are evaluated from source node.
+    AST *ast = ((Aggregate*)aggregate)->ast;
+    uint returnElemCount = array_len(ast->returnNode->returnElements);
+    for(uint i = 0; i < returnElemCount; i++) {
+        AST_ReturnElementNode *elem = ast->returnNode->returnElements[i];
+        if(_countsRecords(plan->query_graph, elem)) continue;
+        if(!elem->exp || !_refersOnly(elem->exp, src)) return;
+    }
+
+    /* Order expressions are evaluated against a representative record
+     * of each group, which only binds the source node and returned aliases. */
+    uint orderExpCount = (ast->orderNode) ? array_len(ast->orderNode->expressions) : 0;
+    for(uint i = 0; i < orderExpCount; i++) {
+        AST_ArithmeticExpressionNode *exp = ast->orderNode->expressions[i];
+        if(_refersOnly(exp, src)) continue;
+        if(exp->type != AST_AR_EXP_OPERAND || exp->operand.type != AST_AR_EXP_VARIADIC) return;
+        if(exp->operand.variadic.property) return;
+        if(!_returnedAlias(ast->returnNode, exp->operand.variadic.alias)) return;
+    }
+
+    bool countEdges;
+    if(!_reducibleTraversal(ast, traverse, &countEdges)) return;
+
+    // Expand count takes over traversal expression.
+    OpBase *expandCount = NewExpandCountOp(gc->g, ae, countEdges);
+    traverse->algebraic_expression = NULL;
+    ExecutionPlan_ReplaceOp(op, expandCount);
+    OpBase_Free(op);
+
+    AggregateSetWeight(aggregate, ((ExpandCount*)expandCount)->countRecIdx);
+}
+
+static void _freeOps(OpBase *op) {
+    for(int i = 0; i < op->childCount; i++) _freeOps(op->children[i]);
+    OpBase_Free(op);
+}
+
+void reduceCount(GraphContext *gc, ExecutionPlan *plan) {
+    // Expecting ProduceResults -> [Sort] -> Aggregate -> counted entities.
+    OpBase *root = plan->root;
+    if(root->type != OPType_PRODUCE_RESULTS || root->childCount != 1) return;
+    OpBase *aggregate = root->children[0];
+    if(aggregate->type == OPType_SORT && aggregate->childCount == 1) aggregate = aggregate->children[0];
+    if(aggregate->type != OPType_AGGREGATE || aggregate->childCount != 1) return;
+
+    // Ungrouped count, every return element must count records.
+    AST *ast = ((Aggregate*)aggregate)->ast;
+    uint returnElemCount = array_len(ast->returnNode->returnElements);
+    bool countsOnly = (aggregate->parent == root);
+    for(uint i = 0; i < returnElemCount && countsOnly; i++) {
+        countsOnly = _countsRecords(plan->query_graph, ast->returnNode->returnElements[i]);
+    }
+
+    int id;
+    EntityCountType type;
+    if(!countsOnly || !_countedEntities(gc, aggregate->children[0], &type, &id)) {
+        _reduceGroupedCount(gc, plan, aggregate);
+        return;
+    }
+
+    // Replace aggregation and the operations it consumes.
+    OpBase *count = NewEntityCountOp(gc->g, type, id, plan->result_set);
+    root->children[0] = count;
+    count->parent = root;
+    _freeOps(aggregate);
+}
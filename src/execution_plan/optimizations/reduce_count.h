@@ -0,0 +1,26 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __REDUCE_COUNT_H__
+#define __REDUCE_COUNT_H__
+
+#include "../execution_plan.h"
+#include "../../graph/graphcontext.h"
+
+/* The reduce count optimizer searches for queries counting
+ * all nodes, nodes of a label, all edges or edges of a relation type, e.g.
+ * MATCH (n:Person) RETURN count(n)
+ * MATCH ()-[r:KNOWS]->() RETURN count(r)
+ * in such cases the scan, traversal and aggregation are replaced
+ * by a single operation reading the count off the graph matrices.
+ * Counts grouped by the source of a single hop, e.g.
+ * MATCH (a:Person)-[:KNOWS]->(b) RETURN a.name, count(b)
+ * replace the traversal with an expand count operation, reducing the
+ * traversal expression into per source node degrees. */
+void reduceCount(GraphContext *gc, ExecutionPlan *plan);
+
+#endif
@@ -6,8 +6,22 @@
 */
 
 #include "./select_entry_point.h"
+#include "./estimate_cardinality.h"
+
+void selectEntryPoint(const GraphContext *gc, AlgebraicExpression *ae, const FT_FilterNode *tree) {
+    // Scan whichever end is estimated to produce fewer nodes.
+    if(ae->src_node != ae->dest_node) {
+        double srcRows = estimateNodeScan(gc, ae->src_node, tree);
+        double destRows = estimateNodeScan(gc, ae->dest_node, tree);
+        if(destRows < srcRows) {
+            AlgebraicExpression_Transpose(ae);
+            return;
+        }
+        if(srcRows < destRows) return;
+    }
 
-void selectEntryPoint(AlgebraicExpression *ae, const FT_FilterNode *tree) {
+    /* Estimates are inconclusive, e.g. graph is empty,
+     * fall back to filters and labels. */
     Vector *aliases = FilterTree_CollectAliases(tree);
     char *srcAlias = ae->src_node->alias;
     char *destAlias = ae->dest_node->alias;
@@ -31,11 +45,6 @@ void selectEntryPoint(AlgebraicExpression *ae, const FT_FilterNode *tree) {
 
     /* Prefer filter over label 
      * if no filters are applied prefer labeled entity. */
-     
-    /* TODO: when additional statistics are available 
-     * do not use label scan if for every node N such that 
-     * (N)-[relation]->(T) N is of the same type T, and type of 
-     * either source or destination node is T. */
     if(destFiltered) {
         AlgebraicExpression_Transpose(ae);
     } else if(srcLabeled) {
@@ -8,16 +8,17 @@
 #ifndef __SELECT_ENTRY_POINT_H__
 #define __SELECT_ENTRY_POINT_H__
 
+#include "../../graph/graphcontext.h"
 #include "../../filter_tree/filter_tree.h"
 #include "../../arithmetic/algebraic_expression.h"
 
 /* The select entry point optimizer inspects an algebraic expression E
  * which will be used shortly for traversal and determins if
  * it would be worth to transpose it, we will choose to transpose if
- * the rows of E have a filter applied to them 
- * and the columns of E aren't filtered.
+ * scanning the rows of E is estimated to produce fewer nodes
+ * than scanning its columns.
  * As a result of transposing rows will be come columns
  * and we'll be able to perform filtering much quicker. */
-void selectEntryPoint(AlgebraicExpression *ae, const FT_FilterNode *tree);
+void selectEntryPoint(const GraphContext *gc, AlgebraicExpression *ae, const FT_FilterNode *tree);
 
 #endif
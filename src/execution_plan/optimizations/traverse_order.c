@@ -5,75 +5,67 @@
 * modified with the Commons Clause restriction.
 */
 
+#include <sys/param.h>
 #include "./traverse_order.h"
+#include "./estimate_cardinality.h"
 #include "../../util/vector.h"
 
+// Checks if alias is one of the filtered aliases.
+static bool _aliasFiltered(Vector *aliases, const char *alias) {
+    if(!alias) return false;
+    for(int i = 0; i < Vector_Size(aliases); i++) {
+        char *filtered;
+        Vector_Get(aliases, i, &filtered);
+        if(strcmp(filtered, alias) == 0) return true;
+    }
+    return false;
+}
+
 /* Given a set of algebraic expressions and the entire filter tree,
- * suggest traversal entry point to be either the first expression or the
- * last expression, in the future we'll want to be able to begin traversal from 
- * any expression. */
-TRAVERSE_ORDER determineTraverseOrder(const FT_FilterNode *filterTree,
-                                      AlgebraicExpression **exps,
-                                      size_t expCount) {
+ * suggest traversal entry point, which can be any of the expressions. */
+size_t determineTraverseOrder(const GraphContext *gc,
+                              const FT_FilterNode *filterTree,
+                              AlgebraicExpression **exps,
+                              size_t expCount) {
 
-    if(expCount == 1 || !filterTree) {
-        return TRAVERSE_ORDER_FIRST;
-    }
-    
-    char *destAlias;
-    char *srcAlias;
-    bool firstExpLabeled = false;
-    bool lastExpLabeled = false;
-    AlgebraicExpression *exp;
-    TRAVERSE_ORDER order = TRAVERSE_ORDER_FIRST;
-    
-    Vector *aliases = FilterTree_CollectAliases(filterTree);
-    size_t aliasesCount = Vector_Size(aliases);
+    if(expCount == 1) return 0;
 
-    // See if there's a filter applied to the first expression.
-    exp = exps[0];
-    firstExpLabeled = exp->src_node->label || exp->dest_node->label;
-    destAlias = exp->dest_node->alias;
-    srcAlias = exp->src_node->alias;
+    size_t entry = 0;
+    int entryScore = -1;
+    double entryRows = 0;
+    Vector *aliases = FilterTree_CollectAliases(filterTree);
 
-    for(int i = 0; i < aliasesCount; i++) {
-        char *alias;
-        Vector_Get(aliases, i, &alias);
-        if(strcmp(alias, srcAlias) == 0 || strcmp(alias, destAlias) == 0) {
-            order = TRAVERSE_ORDER_FIRST;
-            goto cleanup;
+    /* Prefer the expression with the lowest estimated scan cardinality.
+     * When estimates tie, e.g. graph is empty, an expression which has
+     * a filter applied to either its source or destination is preferred,
+     * the next-best criteria is to prefer an expression in which the source
+     * or destination has a label, as label scans are significantly faster
+     * than scanning all nodes.
+     * Remaining ties are resolved in favour of the earliest expression. */
+    for(size_t i = 0; i < expCount; i++) {
+        AlgebraicExpression *exp = exps[i];
+        double rows = MIN(estimateNodeScan(gc, exp->src_node, filterTree),
+                          estimateNodeScan(gc, exp->dest_node, filterTree));
+        int score = 0;
+        if(_aliasFiltered(aliases, exp->src_node->alias) ||
+           _aliasFiltered(aliases, exp->dest_node->alias)) {
+            score = 2;
+        } else if(exp->src_node->label || exp->dest_node->label) {
+            score = 1;
         }
-    }
-
-    // See if there's a filter applied to the last expression.
-    exp = exps[expCount-1];
-    lastExpLabeled = exp->src_node->label || exp->dest_node->label;
-    destAlias = exp->dest_node->alias;
-    srcAlias = exp->src_node->alias;
 
-    for(int i = 0; i < aliasesCount; i++) {
-        char *alias;
-        Vector_Get(aliases, i, &alias);
-        if(strcmp(alias, srcAlias) == 0 || strcmp(alias, destAlias) == 0) {
-            order = TRAVERSE_ORDER_LAST;
-            goto cleanup;
+        if(entryScore < 0 || rows < entryRows || (rows == entryRows && score > entryScore)) {
+            entry = i;
+            entryScore = score;
+            entryRows = rows;
         }
     }
 
-    /* If we're here, there are no filters on either the first or the last
-     * expression. The next-best criteria for choosing traversal order is
-     * to prefer an expression in which the source or destination has a label,
-     * as label scans are significantly faster than scanning all nodes.
-     * If both expressions use labels (or neither do), we'll default
-     * to TRAVERSE_ORDER_FIRST. */
-    if(!firstExpLabeled && lastExpLabeled) order = TRAVERSE_ORDER_LAST;
-
-cleanup:
-    for(int i = 0; i < aliasesCount; i++) {
+    for(int i = 0; i < Vector_Size(aliases); i++) {
         char *alias;
         Vector_Get(aliases, i, &alias);
         free(alias);
     }
     Vector_Free(aliases);
-    return order;
+    return entry;
 }
@@ -12,17 +12,15 @@
 #include "../../filter_tree/filter_tree.h"
 #include "../../arithmetic/algebraic_expression.h"
 
-typedef enum {
-    TRAVERSE_ORDER_FIRST,
-    TRAVERSE_ORDER_LAST,
-} TRAVERSE_ORDER;
-
 /* Traverse order tries to determine which of the linear expressions should 
- * be used as the first traverse operation, we will prefer using an expression
- * which has a filter applied to it, as we wish to filter as early as we can,
- * that way we expect the number of entities inspected to be reduced at an early stage. */
-TRAVERSE_ORDER determineTraverseOrder(const FT_FilterNode *filterTree,
-                                      AlgebraicExpression **exps,
-                                      size_t expCount);
+ * be used as the first traverse operation, we will prefer using the expression
+ * whose source or destination is estimated to produce the fewest nodes once scanned,
+ * that way we expect the number of entities inspected to be reduced at an early stage.
+ * Returns the index of the entry expression, traversal proceeds from it
+ * in both directions along the pattern. */
+size_t determineTraverseOrder(const GraphContext *gc,
+                              const FT_FilterNode *filterTree,
+                              AlgebraicExpression **exps,
+                              size_t expCount);
 
 #endif
@@ -1,6 +1,11 @@
 #include "utilize_indices.h"
 #include "../ops/op_index_scan.h"
 #include "../../util/arr.h"
+#include "./estimate_cardinality.h"
+
+/* Index scan is used only when expected to produce at most
+ * this fraction of the nodes produced by a label scan. */
+#define INDEX_SCAN_MAX_SELECTIVITY 0.5
 
 /* Reverse an inequality symbol so that indices can support
  * inequalities with right-hand variables. */
@@ -65,6 +70,9 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
   // Collect all filters on scanned entities
   NodeByLabelScan *scanOp;
   OpBase **filterOps = array_new(OpBase*, 0);
+  OpBase **boundFilters = array_new(OpBase*, 0);  // Filters resolvable by index.
+  SIValue *bounds = array_new(SIValue, 0);        // Constant compared by each bound filter.
+  int *boundOps = array_new(int, 0);              // Comparison of each bound filter.
   FT_FilterNode *ft;
   char *label;
 
@@ -78,7 +86,6 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
   for(int i = 0; i < scanOpCount; i++) {
   // while (Vector_Pop(scanOps, &scanOp)) {
     scanOp = scanOps[i];
-    IndexIter *iter = NULL;
     Index *idx = NULL;
 
     /* Get the label string for the scan target.
@@ -98,6 +105,9 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
      * that property. A later optimization would be to find the index with the
      * most filters, or use some heuristic for trying to select the minimal range. */
 
+    array_clear(boundOps);
+    array_clear(bounds);
+    array_clear(boundFilters);
     int filterOpsCount = array_len(filterOps);
     for (int i = 0; i < filterOpsCount; i ++) {
       OpBase *opFilter = filterOps[i];
@@ -123,6 +133,9 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
         continue;
       }
 
+      // Inequalities can't be translated into bounds.
+      if (op == NE) continue;
+
       // If we've already selected an index on a different property, continue
       if (idx && strcmp(idx->attribute, filterProp)) continue;
 
@@ -130,25 +143,46 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
       if (!idx) {
         idx = GraphContext_GetIndex(gc, label, filterProp);
         if (!idx) continue;
-        iter = IndexIter_Create(idx, SI_TYPE(constVal));
       }
 
+      boundFilters = array_append(boundFilters, opFilter);
+      bounds = array_append(bounds, constVal);
+      boundOps = array_append(boundOps, op);
+    }
+
+    if (!idx) continue;
+
+    /* Prefer label scan when index scan isn't expected to
+     * discard a significant portion of the labeled nodes. */
+    double scanRows = estimateNodeScan(gc, scanOp->node, NULL);
+    double indexRows = scanRows;
+    int boundCount = array_len(boundFilters);
+    for (int i = 0; i < boundCount; i++) {
+      ft = ((Filter *)boundFilters[i])->filterTree;
+      indexRows *= estimateFilterSelectivity(gc, NULL, scanOp->node, ft);
+    }
+    if (indexRows > scanRows * INDEX_SCAN_MAX_SELECTIVITY) continue;
+
+    IndexIter *iter = IndexIter_Create(idx, SI_TYPE(bounds[0]));
+    for (int i = 0; i < boundCount; i++) {
       // Tighten the iterator range if possible
-      if (IndexIter_ApplyBound(iter, &constVal, op)) {
+      if (IndexIter_ApplyBound(iter, bounds + i, boundOps[i])) {
         // Remove filter operations that have been folded into the index scan iterator
-        ExecutionPlan_RemoveOp(opFilter);
-        OpBase_Free(opFilter);
+        ExecutionPlan_RemoveOp(boundFilters[i]);
+        OpBase_Free(boundFilters[i]);
       }
     }
 
-    if (iter != NULL) {
-      OpBase *indexOp = NewIndexScanOp(scanOp->g, scanOp->node, iter);
-      ExecutionPlan_ReplaceOp((OpBase*)scanOp, indexOp);
-    }
+    OpBase *indexOp = NewIndexScanOp(scanOp->g, scanOp->node, iter);
+    indexOp->estimate = indexRows;
+    ExecutionPlan_ReplaceOp((OpBase*)scanOp, indexOp);
   }
 
   // Cleanup
   array_free(filterOps);
+  array_free(boundFilters);
+  array_free(bounds);
+  array_free(boundOps);
   array_free(scanOps);
 }
 
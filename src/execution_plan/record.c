@@ -6,6 +6,7 @@
 */
 
 #include "./record.h"
+#include "../util/arena.h"
 #include "../util/rmalloc.h"
 #include <assert.h>
 
@@ -13,10 +14,11 @@
 #define RECORD_HEADER_ENTRY(r) *(RECORD_HEADER((r)))
 
 Record Record_New(int entries) {
-    Record r = rm_calloc((entries + 1), sizeof(Entry));
+    Arena *arena = Arena_GetCurrent();
+    Record r = Arena_Calloc(arena, (entries + 1), sizeof(Entry));
 
-    // First entry holds records length.
-    r[0].type = REC_TYPE_HEADER;
+    // First entry holds records length and origin.
+    r[0].type = (arena) ? REC_TYPE_ARENA_HEADER : REC_TYPE_HEADER;
     r[0].value.s = SI_UintVal(entries);
 
     // Skip header entry.
@@ -36,6 +38,12 @@ Record Record_Clone(const Record r) {
     return clone;
 }
 
+void Record_Copy(Record dest, const Record src) {
+    int length = Record_length(src);
+    assert(Record_length(dest) == length);
+    memcpy(dest, src, sizeof(Entry) * length);
+}
+
 void Record_Merge(Record a, const Record b) {
     int aLength = Record_length(a);
     int bLength = Record_length(b);
@@ -112,6 +120,16 @@ size_t Record_ToString(const Record r, char **buf, size_t *buf_cap) {
     return SIValue_StringConcat(values, rLen, *buf, *buf_cap);
 }
 
+void Record_Clear(Record r) {
+    int length = Record_length(r);
+    for(int i = 0; i < length; i++) {
+        if(r[i].type == REC_TYPE_SCALAR) {
+            SIValue_Free(&r[i].value.s);
+        }
+    }
+    memset(r, 0, sizeof(Entry) * length);
+}
+
 void Record_Free(Record r) {
     int length = Record_length(r);
     for(int i = 0; i < length; i++) {
@@ -119,5 +137,13 @@ void Record_Free(Record r) {
             SIValue_Free(&r[i].value.s);
         }
     }
-    rm_free((r-1));
+
+    Entry *header = RECORD_HEADER(r);
+    if(header->type == REC_TYPE_ARENA_HEADER) {
+        Arena *arena = Arena_GetCurrent();
+        assert(arena);
+        Arena_Release(arena, header, sizeof(Entry) * (length + 1));
+    } else {
+        rm_free(header);
+    }
 }
@@ -18,6 +18,7 @@ typedef enum  {
     REC_TYPE_NODE,
     REC_TYPE_EDGE,
     REC_TYPE_HEADER,
+    REC_TYPE_ARENA_HEADER,  // Header of a record allocated from the current arena.
 } RecordEntryType;
 
 typedef struct {
@@ -31,12 +32,18 @@ typedef struct {
 
 typedef Entry *Record;
 
-// Create a new record capable of holding N entries.
+// Create a new record capable of holding N entries,
+// record is allocated from the calling thread's current arena if set.
+// Such a record must be freed while the same arena is current.
 Record Record_New(int entries);
 
 // Clones record.
 Record Record_Clone(const Record r);
 
+// Copies src entries into dest, both records must be of the same length.
+// As with Record_Clone, scalars are not duplicated.
+void Record_Copy(Record dest, const Record src);
+
 // Merge record b into a.
 void Record_Merge(Record a, const Record b);
 
@@ -70,6 +77,9 @@ void Record_AddEdge(Record r, int idx, Edge edge);
 // String representation of record.
 size_t Record_ToString(const Record r, char **buf, size_t *buf_cap);
 
+// Free record's scalars and reset all of its entries.
+void Record_Clear(Record r);
+
 // Free record.
 void Record_Free(Record r);
 
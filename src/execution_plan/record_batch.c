@@ -0,0 +1,55 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./record_batch.h"
+#include "../util/rmalloc.h"
+#include <assert.h>
+
+RecordBatch *RecordBatch_New(uint cap) {
+    assert(cap > 0);
+    RecordBatch *batch = rm_malloc(sizeof(RecordBatch));
+    batch->records = rm_calloc(cap, sizeof(Record));
+    batch->len = 0;
+    batch->cap = cap;
+    return batch;
+}
+
+Record RecordBatch_Slot(RecordBatch *batch, uint idx, uint length) {
+    assert(idx < batch->cap);
+    Record r = batch->records[idx];
+
+    if(r && Record_length(r) == length) {
+        Record_Clear(r);
+    } else {
+        if(r) Record_Free(r);
+        r = Record_New(length);
+        batch->records[idx] = r;
+    }
+
+    return r;
+}
+
+void RecordBatch_Set(RecordBatch *batch, uint idx, Record r) {
+    assert(idx < batch->cap);
+    if(batch->records[idx]) Record_Free(batch->records[idx]);
+    batch->records[idx] = r;
+}
+
+void RecordBatch_Swap(RecordBatch *batch, uint i, uint j) {
+    Record r = batch->records[i];
+    batch->records[i] = batch->records[j];
+    batch->records[j] = r;
+}
+
+void RecordBatch_Free(RecordBatch *batch) {
+    if(!batch) return;
+    for(uint i = 0; i < batch->cap; i++) {
+        if(batch->records[i]) Record_Free(batch->records[i]);
+    }
+    rm_free(batch->records);
+    rm_free(batch);
+}
@@ -0,0 +1,42 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __RECORD_BATCH_H_
+#define __RECORD_BATCH_H_
+
+#include "./record.h"
+
+#define RECORD_BATCH_CAP 256    // Default number of records in a batch.
+
+/* RecordBatch, a fixed capacity array of records produced by an
+ * operation in a single call. The batch owns its records, which are
+ * recycled from one call to the next, a consumer may read and update
+ * batched records but must not free them nor hold on to them
+ * once it requests additional data from the producing operation. */
+typedef struct {
+    Record *records;    // Records, the first len are valid.
+    uint len;           // Number of valid records.
+    uint cap;           // Maximum number of records.
+} RecordBatch;
+
+// Create a new, empty batch capable of holding cap records.
+RecordBatch *RecordBatch_New(uint cap);
+
+// Returns an empty record of given length at position idx,
+// the record previously held at idx is reused when possible.
+Record RecordBatch_Slot(RecordBatch *batch, uint idx, uint length);
+
+// Places r at position idx, batch takes ownership of r.
+void RecordBatch_Set(RecordBatch *batch, uint idx, Record r);
+
+// Swaps records at positions i and j.
+void RecordBatch_Swap(RecordBatch *batch, uint i, uint j);
+
+// Free batch and all of its records.
+void RecordBatch_Free(RecordBatch *batch);
+
+#endif
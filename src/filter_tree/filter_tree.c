@@ -30,6 +30,7 @@ FT_FilterNode* _CreatePredicateFilterNode(const AST *ast, const AST_PredicateNod
     FT_FilterNode *filterNode = malloc(sizeof(FT_FilterNode));
     filterNode->t= FT_N_PRED;
     filterNode->pred.op = pn->op;
+    filterNode->pred.interned = false;
     filterNode->pred.lhs = AR_EXP_BuildFromAST(ast, pn->lhs);
     filterNode->pred.rhs = AR_EXP_BuildFromAST(ast, pn->rhs);
     return filterNode;
@@ -135,6 +136,13 @@ int _applyPredicateFilters(const FT_FilterNode* root, const Record r) {
     SIValue lhs = AR_EXP_Evaluate(root->pred.lhs, r);
     SIValue rhs = AR_EXP_Evaluate(root->pred.rhs, r);
 
+    /* Property sharing the interned constant's address holds the same string,
+     * properties of high cardinality attributes may hold plain copies. */
+    if(root->pred.interned && (lhs.type & SI_STRING) && (rhs.type & SI_STRING) &&
+       lhs.stringval == rhs.stringval) {
+        return (root->pred.op == EQ);
+    }
+
     return _applyFilter(&lhs, &rhs, root->pred.op);
 }
 
@@ -160,6 +168,51 @@ int FilterTree_applyFilters(const FT_FilterNode* root, const Record r) {
     return pass;
 }
 
+/* Replace string constant with its interned copy,
+ * returns false if string isn't in dictionary. */
+static bool _InternConstant(AR_ExpNode *exp, const StringDictionary *dict) {
+    SIValue *v = &exp->operand.constant;
+    const char *interned = StringDictionary_Lookup(dict, v->stringval);
+    if(!interned) return false;
+    SIValue_Free(v);
+    *v = SI_ConstStringVal((char*)interned);
+    return true;
+}
+
+static bool _IsStringConstant(const AR_ExpNode *exp) {
+    return (exp->type == AR_EXP_OPERAND &&
+            exp->operand.type == AR_EXP_CONSTANT &&
+            (exp->operand.constant.type & SI_STRING));
+}
+
+static bool _IsProperty(const AR_ExpNode *exp) {
+    return (exp->type == AR_EXP_OPERAND &&
+            exp->operand.type == AR_EXP_VARIADIC &&
+            exp->operand.variadic.entity_prop != NULL);
+}
+
+void FilterTree_InternStrings(FT_FilterNode *root, const StringDictionary *dict) {
+    if(root == NULL) return;
+
+    if(!IsNodePredicate(root)) {
+        FilterTree_InternStrings(LeftChild(root), dict);
+        FilterTree_InternStrings(RightChild(root), dict);
+        return;
+    }
+
+    FT_PredicateNode *pred = &root->pred;
+    if(pred->op != EQ && pred->op != NE) return;
+
+    AR_ExpNode *constant = NULL;
+    if(_IsStringConstant(pred->rhs) && _IsProperty(pred->lhs)) constant = pred->rhs;
+    else if(_IsStringConstant(pred->lhs) && _IsProperty(pred->rhs)) constant = pred->lhs;
+    if(!constant) return;
+
+    /* A constant missing from the dictionary is left as is,
+     * it is compared against properties as a plain string. */
+    pred->interned = _InternConstant(constant, dict);
+}
+
 void _FilterTree_CollectAliases(const FT_FilterNode *root, TrieMap *aliases) {
     if(root == NULL) return;
 
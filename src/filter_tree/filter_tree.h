@@ -12,6 +12,7 @@
 #include "../redismodule.h"
 #include "../arithmetic/arithmetic_expression.h"
 #include "../execution_plan/record.h"
+#include "../util/string_dictionary.h"
 
 #define FILTER_FAIL 0
 #define FILTER_PASS 1
@@ -28,6 +29,7 @@ typedef struct {
 	AR_ExpNode *lhs;
 	AR_ExpNode *rhs;
 	int op;					/* Operation (<, <=, =, =>, >, !). */
+	bool interned;			/* Equality between a property and an interned string constant. */
 } FT_PredicateNode;
 
 typedef struct {
@@ -65,6 +67,11 @@ int FilterTree_applyFilters(const FT_FilterNode* root, const Record r);
  * without duplications. */
 Vector *FilterTree_CollectAliases(const FT_FilterNode *root);
 
+/* Resolves string constants compared for (in)equality against
+ * entity properties to their interned copies within dict,
+ * such predicates match interned properties by comparing string addresses. */
+void FilterTree_InternStrings(FT_FilterNode *root, const StringDictionary *dict);
+
 /* Prints tree. */
 void FilterTree_Print(const FT_FilterNode *root);
 
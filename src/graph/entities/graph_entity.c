@@ -8,12 +8,28 @@
 #include <stdio.h>
 #include <assert.h>
 #include "graph_entity.h"
+#include "property_store.h"
 #include "../../util/rmalloc.h"
 
 SIValue *PROPERTY_NOTFOUND = &(SIValue){.intval = 0, .type = T_NULL};
 
 /* Add a new property to entity */
 SIValue* GraphEntity_AddProperty(GraphEntity *e, Attribute_ID attr_id, SIValue value) {
+	if(e->entity->store) {
+		// Setting an existing attribute replaces its value.
+		SIValue *prop = PropertyStore_Get(e->entity->store, attr_id, e->entity->id);
+		if(prop == PROPERTY_NOTFOUND) e->entity->prop_count++;
+		else SIValue_Free(prop);
+		return PropertyStore_Set(e->entity->store, attr_id, e->entity->id, value);
+	}
+
+	for(int i = 0; i < e->entity->prop_count; i++) {
+		if(e->entity->properties[i].id != attr_id) continue;
+		SIValue_Free(&e->entity->properties[i].value);
+		e->entity->properties[i].value = value;
+		return &(e->entity->properties[i].value);
+	}
+
 	if(e->entity->properties == NULL) {
 		e->entity->properties = rm_malloc(sizeof(EntityProperty));
 	} else {
@@ -30,6 +46,7 @@ SIValue* GraphEntity_AddProperty(GraphEntity *e, Attribute_ID attr_id, SIValue v
 
 SIValue* GraphEntity_GetProperty(const GraphEntity *e, Attribute_ID attr_id) {
 	if(attr_id == ATTRIBUTE_NOTFOUND) return PROPERTY_NOTFOUND;
+	if(e->entity->store) return PropertyStore_Get(e->entity->store, attr_id, e->entity->id);
 
 	for(int i = 0; i < e->entity->prop_count; i++) {
 		if(attr_id == e->entity->properties[i].id) {
@@ -45,11 +62,17 @@ SIValue* GraphEntity_GetProperty(const GraphEntity *e, Attribute_ID attr_id) {
 void GraphEntity_SetProperty(const GraphEntity *e, Attribute_ID attr_id, SIValue value) {
 	SIValue *prop = GraphEntity_GetProperty(e, attr_id);
 	assert(prop != PROPERTY_NOTFOUND);
+	SIValue_Free(prop);
 	*prop = value;
 }
 
 void FreeEntity(Entity *e) {
 	assert(e);
+	if(e->store) {
+		PropertyStore_RemoveEntity(e->store, e->id);
+		e->prop_count = 0;
+	}
+
 	if(e->properties != NULL) {
 		for(int i = 0; i < e->prop_count; i++) SIValue_Free(&e->properties[i].value);
 		rm_free(e->properties);
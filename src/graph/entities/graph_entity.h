@@ -33,12 +33,17 @@ typedef struct {
     SIValue value;
 } EntityProperty;
 
+// Forward declaration of columnar property store.
+struct PropertyStore;
+
 // Essence of a graph entity.
 // TODO: see if pragma pack 0 will cause memory access violation on ARM.
 typedef struct {
     EntityID id;                    // Unique id
     int prop_count;                 // Number of properties.
+    int label;                      // Node label ID, not in use by edges.
     EntityProperty *properties;     // Key value pair of attributes.
+    struct PropertyStore *store;    // Columnar store holding attributes, NULL if held by entity.
 } Entity;
 
 // Common denominator between nodes and edges.
@@ -46,7 +51,9 @@ typedef struct {
     Entity *entity;
 } GraphEntity;
 
-/* Adds property to entity
+/* Adds property to entity, property is written to entity's
+ * columnar store if it has one, otherwise to its own property array,
+ * an attribute already set on entity has its value replaced.
  * returns - reference to newly added property. */
 SIValue* GraphEntity_AddProperty(GraphEntity *e, Attribute_ID attr_id, SIValue value);
 
@@ -55,7 +62,7 @@ SIValue* GraphEntity_AddProperty(GraphEntity *e, Attribute_ID attr_id, SIValue v
  * constant value PROPERTY_NOTFOUND. */
 SIValue* GraphEntity_GetProperty(const GraphEntity *e, Attribute_ID attr_id);
 
-/* Updates existing attribute value. */
+/* Updates existing attribute value, releasing the replaced one. */
 void GraphEntity_SetProperty(const GraphEntity *e, Attribute_ID attr_id, SIValue value);
 
 /* Release all memory allocated by entity */
@@ -0,0 +1,123 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include <string.h>
+#include <assert.h>
+#include "property_store.h"
+#include "../../util/arr.h"
+#include "../../util/rmalloc.h"
+
+// Minimal number of entities a column can hold.
+#define COLUMN_MIN_CAP 1024
+
+// Number of 64 bit words required to hold n bits.
+#define BITMAP_WORDS(n) (((n) + 63) / 64)
+
+static inline bool _Column_HasValue(const PropertyColumn *col, EntityID id) {
+    if(id >= col->cap) return false;
+    return (col->present[id >> 6] >> (id & 63)) & 1;
+}
+
+static PropertyColumn *_Column_New(size_t cap) {
+    PropertyColumn *col = rm_malloc(sizeof(PropertyColumn));
+    col->cap = cap;
+    col->values = rm_malloc(sizeof(SIValue) * cap);
+    col->present = rm_calloc(BITMAP_WORDS(cap), sizeof(uint64_t));
+    return col;
+}
+
+// Make sure column can hold entity with given ID.
+static void _Column_Accommodate(PropertyColumn *col, EntityID id) {
+    if(id < col->cap) return;
+
+    size_t prev_words = BITMAP_WORDS(col->cap);
+    size_t cap = col->cap;
+    while(cap <= id) cap *= 2;
+    size_t words = BITMAP_WORDS(cap);
+
+    col->values = rm_realloc(col->values, sizeof(SIValue) * cap);
+    col->present = rm_realloc(col->present, sizeof(uint64_t) * words);
+    memset(col->present + prev_words, 0, sizeof(uint64_t) * (words - prev_words));
+    col->cap = cap;
+}
+
+static void _Column_Free(PropertyColumn *col) {
+    size_t words = BITMAP_WORDS(col->cap);
+    for(size_t w = 0; w < words; w++) {
+        uint64_t word = col->present[w];
+        while(word) {
+            int bit = __builtin_ctzll(word);
+            SIValue_Free(&col->values[w * 64 + bit]);
+            word &= word - 1;
+        }
+    }
+    rm_free(col->values);
+    rm_free(col->present);
+    rm_free(col);
+}
+
+PropertyStore *PropertyStore_New(void) {
+    PropertyStore *store = rm_malloc(sizeof(PropertyStore));
+    store->columns = array_new(PropertyColumn*, 0);
+    return store;
+}
+
+unsigned short PropertyStore_ColumnCount(const PropertyStore *store) {
+    assert(store);
+    return array_len(store->columns);
+}
+
+SIValue *PropertyStore_Get(const PropertyStore *store, Attribute_ID attr_id, EntityID id) {
+    if(attr_id >= array_len(store->columns)) return PROPERTY_NOTFOUND;
+    PropertyColumn *col = store->columns[attr_id];
+    if(!col || !_Column_HasValue(col, id)) return PROPERTY_NOTFOUND;
+    return &col->values[id];
+}
+
+SIValue *PropertyStore_Set(PropertyStore *store, Attribute_ID attr_id, EntityID id, SIValue value) {
+    assert(store && attr_id != ATTRIBUTE_NOTFOUND);
+
+    // Extend column slots up to attribute ID.
+    while(array_len(store->columns) <= attr_id) {
+        store->columns = array_append(store->columns, NULL);
+    }
+
+    PropertyColumn *col = store->columns[attr_id];
+    if(!col) {
+        size_t cap = COLUMN_MIN_CAP;
+        while(cap <= id) cap *= 2;
+        col = _Column_New(cap);
+        store->columns[attr_id] = col;
+    } else {
+        _Column_Accommodate(col, id);
+    }
+
+    col->values[id] = value;
+    col->present[id >> 6] |= ((uint64_t)1 << (id & 63));
+    return &col->values[id];
+}
+
+void PropertyStore_RemoveEntity(PropertyStore *store, EntityID id) {
+    assert(store);
+    uint32_t column_count = array_len(store->columns);
+    for(uint32_t i = 0; i < column_count; i++) {
+        PropertyColumn *col = store->columns[i];
+        if(!col || !_Column_HasValue(col, id)) continue;
+        SIValue_Free(&col->values[id]);
+        col->present[id >> 6] &= ~((uint64_t)1 << (id & 63));
+    }
+}
+
+void PropertyStore_Free(PropertyStore *store) {
+    if(!store) return;
+    uint32_t column_count = array_len(store->columns);
+    for(uint32_t i = 0; i < column_count; i++) {
+        if(store->columns[i]) _Column_Free(store->columns[i]);
+    }
+    array_free(store->columns);
+    rm_free(store);
+}
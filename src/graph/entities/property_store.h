@@ -0,0 +1,66 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef PROPERTY_STORE_H_
+#define PROPERTY_STORE_H_
+
+#include <stdint.h>
+#include "graph_entity.h"
+
+/* Columnar property store, holds the attributes of every entity
+ * sharing a schema (label / relation type). Each attribute is stored
+ * in a dense column of values indexed by entity ID, accompanied by
+ * a bitmap marking which entities have a value for the attribute. */
+
+typedef struct {
+    SIValue *values;        // Values indexed by entity ID.
+    uint64_t *present;      // Bit per entity, set if entity has a value.
+    size_t cap;             // Number of entities column can hold.
+} PropertyColumn;
+
+typedef struct PropertyStore {
+    PropertyColumn **columns;   // array_t of columns indexed by attribute ID, NULL if attribute never set.
+} PropertyStore;
+
+// Create a new, empty property store.
+PropertyStore *PropertyStore_New(void);
+
+// Returns number of column slots in store,
+// attribute IDs within store are in range [0, count).
+unsigned short PropertyStore_ColumnCount (
+    const PropertyStore *store
+);
+
+// Retrieves entity's attribute value,
+// returns PROPERTY_NOTFOUND if entity has no value for attribute.
+SIValue *PropertyStore_Get (
+    const PropertyStore *store,
+    Attribute_ID attr_id,
+    EntityID id
+);
+
+// Sets entity's attribute value, column is created or grown if required,
+// returns a reference to the stored value.
+SIValue *PropertyStore_Set (
+    PropertyStore *store,
+    Attribute_ID attr_id,
+    EntityID id,
+    SIValue value
+);
+
+// Free every attribute value held for entity.
+void PropertyStore_RemoveEntity (
+    PropertyStore *store,
+    EntityID id
+);
+
+// Free store and all of its values.
+void PropertyStore_Free (
+    PropertyStore *store
+);
+
+#endif
@@ -15,14 +15,22 @@
 
 /*========================= Synchronization functions ========================= */
 
-/* Acquire mutex when a reader thread may modify shared data. */
-static inline void _Graph_EnterCriticalSection(Graph *g) {
-    pthread_mutex_lock(&g->_mutex);
+/* Retrieve the lock guarding matrix m, matrices are spread across
+ * GRAPH_MATRIX_LOCK_COUNT locks by address (Fibonacci hashing),
+ * such that synchronizing matrix A doesn't block synchronization of matrix B. */
+static inline pthread_mutex_t *_Graph_MatrixLock(const Graph *g, GrB_Matrix m) {
+    uint64_t h = ((uint64_t)(uintptr_t)m) * 11400714819323198485ull;
+    return (pthread_mutex_t *)&g->_matrix_locks[h >> 58];
 }
 
-/* Release mutex. */
-static inline void _Graph_LeaveCriticalSection(Graph *g) {
-    pthread_mutex_unlock(&g->_mutex);
+/* Acquire matrix lock when a reader thread may modify shared data. */
+static inline void _Graph_EnterCriticalSection(const Graph *g, GrB_Matrix m) {
+    pthread_mutex_lock(_Graph_MatrixLock(g, m));
+}
+
+/* Release matrix lock. */
+static inline void _Graph_LeaveCriticalSection(const Graph *g, GrB_Matrix m) {
+    pthread_mutex_unlock(_Graph_MatrixLock(g, m));
 }
 
 /* Acquire a lock that does not restrict access from additional reader threads */
@@ -38,7 +46,11 @@ void Graph_AcquireWriteLock(Graph *g) {
 
 /* Release the held lock */
 void Graph_ReleaseLock(Graph *g) {
+    bool writer = g->_writelocked;
     g->_writelocked = false;
+    /* Writer flushes pending work while still holding exclusive access,
+     * sparing readers from synchronizing matrices. */
+    if(writer) Graph_ApplyAllPending(g);
     pthread_rwlock_unlock(&g->_rwlock);
 }
 
@@ -83,6 +95,15 @@ GrB_Matrix _Graph_GetRelationMap(const Graph *g, int relation_idx) {
     return m;
 }
 
+// Apply hypersparse conversion heuristic to M if enabled,
+// GraphBLAS switches M's format as its number of non empty columns
+// crosses GxB_HYPER_DEFAULT * dimension.
+static void _Graph_SetMatrixFormat(const Graph *g, GrB_Matrix M) {
+    if(!g->_hypersparse) return;
+    GrB_Info res = GxB_Matrix_Option_set(M, GxB_HYPER, GxB_HYPER_DEFAULT);
+    assert(res == GrB_SUCCESS);
+}
+
 // Create a new mapping matrix M,
 // M[I,J] holds the edge ID connecting node J to I (CSC format)
 // assuming _relations_map[K] holds mapping for relation K.
@@ -90,6 +111,7 @@ void _Graph_AddRelationMap(Graph *g) {
     GrB_Matrix mapper;
     GrB_Info res = GrB_Matrix_new(&mapper, GrB_UINT64, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
     assert(res == GrB_SUCCESS);
+    _Graph_SetMatrixFormat(g, mapper);
     g->_relations_map = array_append(g->_relations_map, mapper);
 }
 
@@ -116,28 +138,128 @@ static inline Entity *_Graph_GetEntity(const DataBlock *entities, EntityID id) {
 
 /*============= Matrix synchronization and resizing functions =============== */
 
+/* Resize given matrix, such that its number of row and columns
+ * matches the number of nodes in the graph. */
+static void _MatrixResize(const Graph *g, GrB_Matrix m) {
+    GrB_Index n_rows;
+    GrB_Matrix_nrows(&n_rows, m);
+    if (n_rows != Graph_RequiredMatrixDim(g)) {
+        assert(GxB_Matrix_resize(m, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g)) == GrB_SUCCESS);
+    }
+}
+
+/* Applies pending connections of relation r to the graph's matrices.
+ * Relation entries map to a single edge, a connection of nodes already
+ * connected by r replaces the mapped edge, as such only entries introduced
+ * by the pending connections are counted by the adjacency matrices
+ * and the graph statistics. */
+static void _Graph_ApplyPendingConnections(Graph *g, int r) {
+    PendingConnections *pending = g->_pending + r;
+    GrB_Index n = array_len(pending->rows);
+    if(n == 0) return;
+
+    GrB_Matrix R = g->relations[r];
+    GrB_Matrix TR = g->_t_relations[r];
+    GrB_Matrix map = g->_relations_map[r];
+    GrB_Matrix adj = g->adjacency_matrix;
+    GrB_Matrix tadj = g->_t_adjacency_matrix;
+    _MatrixResize(g, R);
+    _MatrixResize(g, TR);
+    _MatrixResize(g, map);
+    _MatrixResize(g, adj);
+    _MatrixResize(g, tadj);
+
+    GrB_Index dim = Graph_RequiredMatrixDim(g);
+    bool *x = rm_malloc(sizeof(bool) * n);
+    for(GrB_Index i = 0; i < n; i++) x[i] = true;
+
+    // Connections as matrices, the last connection of each pair is mapped.
+    GrB_Matrix P;
+    GrB_Matrix TP;
+    GrB_Matrix M;
+    GrB_Matrix_new(&P, GrB_BOOL, dim, dim);
+    GrB_Matrix_new(&TP, GrB_BOOL, dim, dim);
+    GrB_Matrix_new(&M, GrB_UINT64, dim, dim);
+    GrB_Matrix_build_BOOL(P, pending->rows, pending->cols, x, n, GrB_LOR);
+    GrB_Matrix_build_BOOL(TP, pending->cols, pending->rows, x, n, GrB_LOR);
+    GrB_Matrix_build_UINT64(M, pending->rows, pending->cols, pending->ids, n, GrB_SECOND_UINT64);
+
+    // New entries, N = P<!R>.
+    GrB_Matrix N;
+    GrB_Matrix TN;
+    GrB_Descriptor desc;
+    GrB_Matrix_new(&N, GrB_BOOL, dim, dim);
+    GrB_Matrix_new(&TN, GrB_BOOL, dim, dim);
+    GrB_Descriptor_new(&desc);
+    GrB_Descriptor_set(desc, GrB_MASK, GrB_SCMP);
+    GrB_Matrix_apply(N, R, NULL, GrB_IDENTITY_BOOL, P, desc);
+    GrB_transpose(TN, NULL, NULL, N, NULL);
+
+    GrB_eWiseAdd_Matrix_BinaryOp(R, NULL, NULL, GrB_LOR, R, P, NULL);
+    GrB_eWiseAdd_Matrix_BinaryOp(TR, NULL, NULL, GrB_LOR, TR, TP, NULL);
+    GrB_eWiseAdd_Matrix_BinaryOp(map, NULL, NULL, GrB_SECOND_UINT64, map, M, NULL);
+    // Adjacency entries count connecting edges.
+    GrB_eWiseAdd_Matrix_BinaryOp(adj, NULL, NULL, GrB_PLUS_UINT32, adj, N, NULL);
+    GrB_eWiseAdd_Matrix_BinaryOp(tadj, NULL, NULL, GrB_PLUS_UINT32, tadj, TN, NULL);
+
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, N);
+    GrB_Index *rows = rm_malloc(sizeof(GrB_Index) * nvals);
+    GrB_Index *cols = rm_malloc(sizeof(GrB_Index) * nvals);
+    GrB_Matrix_extractTuples_BOOL(rows, cols, NULL, &nvals, N);
+    for(GrB_Index i = 0; i < nvals; i++) {
+        GraphStatistics_UpdateEdgeCount(&g->_stats, r, Graph_GetNodeLabel(g, cols[i]),
+                                        Graph_GetNodeLabel(g, rows[i]), 1);
+    }
+
+    rm_free(x);
+    rm_free(rows);
+    rm_free(cols);
+    GrB_Matrix_free(&P);
+    GrB_Matrix_free(&TP);
+    GrB_Matrix_free(&M);
+    GrB_Matrix_free(&N);
+    GrB_Matrix_free(&TN);
+    GrB_Descriptor_free(&desc);
+    array_clear(pending->rows);
+    array_clear(pending->cols);
+    array_clear(pending->ids);
+}
+
+/* Applies pending connections of every relation,
+ * only the writer (or a single threaded loader) forms connections,
+ * readers never find pending connections. */
+static void _Graph_ApplyAllPendingConnections(const Graph *g) {
+    if(g->_pending_count == 0) return;
+    Graph *graph = (Graph*)g;
+    for(int r = 0; r < Graph_RelationTypeCount(graph); r++) {
+        _Graph_ApplyPendingConnections(graph, r);
+    }
+    graph->_pending_count = 0;
+}
+
 /* Resize given matrix, such that its number of row and columns
  * matches the number of nodes in the graph. Also, synchronize
  * matrix to execute any pending operations. */
 void _MatrixSynchronize(const Graph *g, GrB_Matrix m) {
-    GrB_Index n_rows;
-    GrB_Matrix_nrows(&n_rows, m);
+    _Graph_ApplyAllPendingConnections(g);
 
     // If the graph belongs to one thread, we don't need to flush pending operations
     // or lock the mutex.
     if (g->_writelocked) {
-        if (n_rows != Graph_RequiredMatrixDim(g)) {
-            assert(GxB_Matrix_resize(m, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g)) == GrB_SUCCESS);
-        }
+        _MatrixResize(g, m);
         return;
     }
 
+    GrB_Index n_rows;
+    GrB_Matrix_nrows(&n_rows, m);
+
     // If the matrix has pending operations or requires
     // a resize, enter critical section.
     bool pending = false;
     GxB_Matrix_Pending(m, &pending);
     if(pending || (n_rows != Graph_RequiredMatrixDim(g))) {
-        _Graph_EnterCriticalSection((Graph *)g);
+        _Graph_EnterCriticalSection(g, m);
         // Double-check if resize is necessary.
         GrB_Matrix_nrows(&n_rows, m);
         if(n_rows != Graph_RequiredMatrixDim(g))
@@ -147,7 +269,7 @@ void _MatrixSynchronize(const Graph *g, GrB_Matrix m) {
         GxB_Matrix_Pending(m, &pending);
         if (pending) _Graph_ApplyPending(m);
 
-        _Graph_LeaveCriticalSection((Graph *)g);
+        _Graph_LeaveCriticalSection(g, m);
     }
 }
 
@@ -192,6 +314,9 @@ void Graph_SetMatrixPolicy(Graph *g, MATRIX_POLICY policy) {
 void Graph_ApplyAllPending(Graph *g) {
     GrB_Matrix M;
 
+    g->SynchronizeMatrix(g, g->adjacency_matrix);
+    g->SynchronizeMatrix(g, g->_t_adjacency_matrix);
+
     for(int i = 0; i < array_len(g->labels); i ++) {
       M = g->labels[i];
       g->SynchronizeMatrix(g, M);
@@ -200,6 +325,8 @@ void Graph_ApplyAllPending(Graph *g) {
     for(int i = 0; i < array_len(g->relations); i ++) {
       M = g->relations[i];
       g->SynchronizeMatrix(g, M);
+      M = g->_t_relations[i];
+      g->SynchronizeMatrix(g, M);
     }
 
     for(int i = 0; i < array_len(g->_relations_map); i ++) {
@@ -218,20 +345,32 @@ Graph *Graph_New(size_t node_cap, size_t edge_cap) {
     g->edges = DataBlock_New(edge_cap, sizeof(Entity));
     g->labels = array_new(GrB_Matrix, GRAPH_DEFAULT_LABEL_CAP);
     g->relations = array_new(GrB_Matrix, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    g->_t_relations = array_new(GrB_Matrix, GRAPH_DEFAULT_RELATION_TYPE_CAP);
     g->_relations_map = array_new(GrB_Matrix, GRAPH_DEFAULT_RELATION_TYPE_CAP);
-    GrB_Matrix_new(&g->adjacency_matrix, GrB_BOOL, node_cap, node_cap);
+    g->_pending = array_new(PendingConnections, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    g->_pending_count = 0;
+    GrB_Matrix_new(&g->adjacency_matrix, GrB_UINT32, node_cap, node_cap);
+    GrB_Matrix_new(&g->_t_adjacency_matrix, GrB_UINT32, node_cap, node_cap);
+
+    // Properties are held by entities unless columnar layout is enabled.
+    g->_label_stores = NULL;
+    g->_relation_stores = NULL;
+
+    // Matrices are never hypersparse unless enabled.
+    g->_hypersparse = false;
 
     // Initialize a read-write lock scoped to the individual graph
     assert(pthread_rwlock_init(&g->_rwlock, NULL) == 0);
     g->_writelocked = false;
+    g->_version = 0;
+    GraphStatistics_Init(&g->_stats);
 
     // Force GraphBLAS updates and resize matrices to node count by default
     Graph_SetMatrixPolicy(g, SYNC_AND_MINIMIZE_SPACE);
 
-    /* TODO: We might want a mutex per matrix,
-     * such that when a thread is resizing matrix A
-     * another thread could be resizing matrix B. */
-    assert(pthread_mutex_init(&g->_mutex, NULL) == 0);
+    for(int i = 0; i < GRAPH_MATRIX_LOCK_COUNT; i++) {
+        assert(pthread_mutex_init(&g->_matrix_locks[i], NULL) == 0);
+    }
     assert(pthread_mutex_init(&g->_writers_mutex, NULL) == 0);
 
     return g;
@@ -287,18 +426,9 @@ int Graph_GetEdge(const Graph *g, EdgeID id, Edge *e) {
 
 int Graph_GetNodeLabel(const Graph *g, NodeID nodeID) {
     assert(g);
-    int label = GRAPH_NO_LABEL;
-    for(int i = 0; i < array_len(g->labels); i++) {
-        bool x = false;
-        GrB_Matrix M = Graph_GetLabel(g, i);
-        GrB_Info res = GrB_Matrix_extractElement_BOOL(&x, M, nodeID, nodeID);
-        if(res == GrB_SUCCESS && x == true) {
-            label = i;
-            break;
-        }
-    }
-
-    return label;
+    Entity *en = _Graph_GetEntity(g->nodes, nodeID);
+    if(!en) return GRAPH_NO_LABEL;
+    return en->label;
 }
 
 int Graph_GetEdgeRelation(const Graph *g, Edge *e) {
@@ -358,15 +488,21 @@ void Graph_GetEdgesConnectingNodes(const Graph *g, NodeID srcID, NodeID destID,
 
 void Graph_CreateNode(Graph* g, int label, Node *n) {
     assert(g);
+    g->_version++;
 
     NodeID id;
     Entity *en = DataBlock_AllocateItem(g->nodes, &id);
     en->id = id;
     en->prop_count = 0;
+    en->label = label;
     en->properties = NULL;
+    en->store = NULL;
     n->entity = en;
 
     if(label != GRAPH_NO_LABEL) {
+        GraphStatistics_UpdateNodeCount(&g->_stats, label, 1);
+        if(g->_label_stores) en->store = g->_label_stores[label];
+
         // Try to set matrix at position [id, id]
         // incase of a failure, scale matrix.
         GrB_Matrix m = g->labels[label];
@@ -385,8 +521,8 @@ int Graph_ConnectNodes(Graph *g, NodeID src, NodeID dest, int r, Edge *e) {
     assert(Graph_GetNode(g, src, &srcNode));
     assert(Graph_GetNode(g, dest, &destNode));
     assert(g && r < Graph_RelationTypeCount(g));
+    g->_version++;
 
-    GrB_Matrix relationMat = Graph_GetRelationMatrix(g, r);
     e->srcNodeID = src;
     e->destNodeID = dest;
 
@@ -394,16 +530,18 @@ int Graph_ConnectNodes(Graph *g, NodeID src, NodeID dest, int r, Edge *e) {
     Entity *en = DataBlock_AllocateItem(g->edges, &id);
     en->id = id;
     en->prop_count = 0;
+    en->label = GRAPH_NO_LABEL;
     en->properties = NULL;
+    en->store = (g->_relation_stores) ? g->_relation_stores[r] : NULL;
     e->entity = en;
 
-    GrB_Matrix adj = Graph_GetAdjacencyMatrix(g);
-    GrB_Matrix relationMapMat = _Graph_GetRelationMap(g, r);
-
-    // Columns represent source nodes, rows represent destination nodes.
-    GrB_Matrix_setElement_BOOL(adj, true, dest, src);
-    GrB_Matrix_setElement_BOOL(relationMat, true, dest, src);
-    GrB_Matrix_setElement_UINT64(relationMapMat, id, dest, src);
+    /* Matrices and statistics are updated once the connection is applied,
+     * sparing a lookup for an existing entry on every connection. */
+    PendingConnections *pending = g->_pending + r;
+    pending->rows = array_append(pending->rows, dest);
+    pending->cols = array_append(pending->cols, src);
+    pending->ids = array_append(pending->ids, id);
+    g->_pending_count++;
     return 1;
 }
 
@@ -415,11 +553,11 @@ void Graph_GetNodeEdges(const Graph *g, const Node *n, GRAPH_EDGE_DIR dir, int e
     NodeID destNodeID;
     GxB_MatrixTupleIter *tupleIter;
     GrB_Matrix M;
-    if(edgeType == GRAPH_NO_RELATION) M = Graph_GetAdjacencyMatrix(g);
-    else M = Graph_GetRelationMatrix(g, edgeType);
 
     // Outgoing.
     if(dir == GRAPH_EDGE_DIR_OUTGOING || dir == GRAPH_EDGE_DIR_BOTH) {
+        // Column srcNodeID of M holds the destinations of outgoing edges.
+        M = Graph_GetRelationMatrix(g, edgeType);
         GxB_MatrixTupleIter_new(&tupleIter, M);
         srcNodeID = ENTITY_GET_ID(n);
         GxB_MatrixTupleIter_iterate_column(tupleIter, srcNodeID);
@@ -434,98 +572,199 @@ void Graph_GetNodeEdges(const Graph *g, const Node *n, GRAPH_EDGE_DIR dir, int e
 
     // Incoming.
     if(dir == GRAPH_EDGE_DIR_INCOMING || dir == GRAPH_EDGE_DIR_BOTH) {
-        // TODO: Callers whishing to get Incoming edges to a number of nodes
-        // should pass a transposed matrix, as the operations below are costly
-        // and we'll perform them forevery node.
+        // Column destNodeID of the transposed matrix holds
+        // the sources of incoming edges.
+        M = Graph_GetTransposedRelationMatrix(g, edgeType);
         destNodeID = ENTITY_GET_ID(n);
-        size_t nRows = Graph_RequiredMatrixDim(g);
-        GrB_Vector incoming;
-        GrB_Descriptor desc;
-        GrB_Vector_new(&incoming, GrB_BOOL, nRows);
-        GrB_Descriptor_new(&desc);
-        GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
-        GrB_Col_extract(incoming, NULL, NULL, M, GrB_ALL, nRows, destNodeID, desc);
-        GrB_Descriptor_free(&desc);
-
-        GxB_MatrixTupleIter_new(&tupleIter, (GrB_Matrix)incoming);
-        GxB_MatrixTupleIter_iterate_column(tupleIter, 0);
+        GxB_MatrixTupleIter_new(&tupleIter, M);
+        GxB_MatrixTupleIter_iterate_column(tupleIter, destNodeID);
         while(true) {
             bool depleted = false;
             GxB_MatrixTupleIter_next(tupleIter, &srcNodeID, NULL, &depleted);
             if(depleted) break;
             Graph_GetEdgesConnectingNodes(g, srcNodeID, destNodeID, edgeType, edges);
         }
-        GrB_Vector_free(&incoming);
         GxB_MatrixTupleIter_free(tupleIter);
     }
 }
 
-/* Removes an edge from Graph and updates graph relevent matrices. */
-int Graph_DeleteEdge(Graph *g, Edge *e) {
-    GrB_Matrix M;
-    GrB_Info res;
-    int r = Edge_GetRelationID(e);
-    NodeID src_id = Edge_GetSrcNodeID(e);
-    NodeID dest_id = Edge_GetDestNodeID(e);
-    M = Graph_GetRelationMatrix(g, r);
-
-    // Test to see if edge exists.
-    bool x = false;
-    GrB_Matrix_extractElement_BOOL(&x, M, dest_id, src_id);
-    if(!x) return 0;
-
-    res = GxB_Matrix_Delete(M, dest_id, src_id);
-    assert(res == GrB_SUCCESS);
+#define EDGE_ID_ISLT(a,b) (ENTITY_GET_ID(a) < ENTITY_GET_ID(b))
+#define NODE_ID_ISLT(a,b) (ENTITY_GET_ID(a) < ENTITY_GET_ID(b))
+
+/* Removes duplicate edges from sorted array, returns new length. */
+static uint32_t _Graph_UniqueEdges(Edge *edges, uint32_t n) {
+    if(n == 0) return 0;
+    uint32_t j = 0;
+    for(uint32_t i = 1; i < n; i++) {
+        if(ENTITY_GET_ID(edges + i) != ENTITY_GET_ID(edges + j)) edges[++j] = edges[i];
+    }
+    return j + 1;
+}
 
-    M = _Graph_GetRelationMap(g, r);
-    res = GxB_Matrix_Delete(M, dest_id, src_id);
+/* Clears collected (row, col) tuples from M. */
+static void _Graph_ClearTuples(GrB_Matrix M, GrB_Index *rows, GrB_Index *cols) {
+    GrB_Info res = GxB_Matrix_DeleteTuples(M, rows, cols, array_len(rows));
     assert(res == GrB_SUCCESS);
+}
 
-    // See if source is connected to destination with additional edges.
-    bool connected = false;
-    int relationCount = Graph_RelationTypeCount(g);
-    for(int i = 0; i < relationCount; i++) {
-        M = Graph_GetRelationMatrix(g, i);
-        GrB_Matrix_extractElement_BOOL(&connected, M, dest_id, src_id);
-        if(connected) break;
+void Graph_BulkDelete(Graph *g, Node *nodes, size_t node_count, Edge *edges,
+                      size_t edge_count, uint *node_deleted, uint *edge_deleted) {
+    assert(g);
+    g->_version++;
+    uint implicit_edge_count = 0;
+    if(node_deleted) *node_deleted = 0;
+    if(edge_deleted) *edge_deleted = 0;
+
+    // Collect unique, existing, edges explicitly marked for deletion.
+    Edge *deleted_edges = array_new(Edge, edge_count);
+    for(size_t i = 0; i < edge_count; i++) {
+        Edge *e = edges + i;
+        bool x = false;
+        GrB_Matrix R = Graph_GetRelationMatrix(g, Edge_GetRelationID(e));
+        GrB_Matrix_extractElement_BOOL(&x, R, Edge_GetDestNodeID(e), Edge_GetSrcNodeID(e));
+        if(x) deleted_edges = array_append(deleted_edges, *e);
+    }
+    uint32_t deleted_edge_count = array_len(deleted_edges);
+    QSORT(Edge, deleted_edges, deleted_edge_count, EDGE_ID_ISLT);
+    deleted_edge_count = _Graph_UniqueEdges(deleted_edges, deleted_edge_count);
+    array_trimm_len(deleted_edges, deleted_edge_count);
+    if(edge_deleted) *edge_deleted = deleted_edge_count;
+
+    // Unique nodes, sorted by ID.
+    Node *deleted_nodes = array_new(Node, node_count);
+    for(size_t i = 0; i < node_count; i++) deleted_nodes = array_append(deleted_nodes, nodes[i]);
+    uint32_t deleted_node_count = array_len(deleted_nodes);
+    QSORT(Node, deleted_nodes, deleted_node_count, NODE_ID_ISLT);
+    if(deleted_node_count > 0) {
+        uint32_t j = 0;
+        for(uint32_t i = 1; i < deleted_node_count; i++) {
+            if(ENTITY_GET_ID(deleted_nodes + i) != ENTITY_GET_ID(deleted_nodes + j)) {
+                deleted_nodes[++j] = deleted_nodes[i];
+            }
+        }
+        deleted_node_count = j + 1;
     }
+    if(node_deleted) *node_deleted = deleted_node_count;
 
-    /* There are no additional edges connecting source to destination
-     * Remove edge from THE adjacency matrix. */
-    if(!connected) {
-        M = Graph_GetAdjacencyMatrix(g);
-        res = GxB_Matrix_Delete(M, dest_id, src_id);
+    // Incoming/outgoing edges of deleted nodes are removed as well.
+    for(uint32_t i = 0; i < deleted_node_count; i++) {
+        Graph_GetNodeEdges(g, deleted_nodes + i, GRAPH_EDGE_DIR_BOTH, GRAPH_NO_RELATION, &deleted_edges);
     }
+    deleted_edge_count = array_len(deleted_edges);
+    QSORT(Edge, deleted_edges, deleted_edge_count, EDGE_ID_ISLT);
+    deleted_edge_count = _Graph_UniqueEdges(deleted_edges, deleted_edge_count);
 
-    // Free and remove edges from datablock.
-    FreeEntity(e->entity);
-    DataBlock_DeleteItem(g->edges, ENTITY_GET_ID(e));
-    return 1;
-}
+    // Collect (dest, src) tuples per relation.
+    int relationCount = Graph_RelationTypeCount(g);
+    GrB_Index **rows = rm_malloc(sizeof(GrB_Index*) * relationCount);
+    GrB_Index **cols = rm_malloc(sizeof(GrB_Index*) * relationCount);
+    for(int r = 0; r < relationCount; r++) {
+        rows[r] = array_new(GrB_Index, 0);
+        cols[r] = array_new(GrB_Index, 0);
+    }
+    for(uint32_t i = 0; i < deleted_edge_count; i++) {
+        Edge *e = deleted_edges + i;
+        int r = Edge_GetRelationID(e);
+        /* Edges replaced by reconnecting their nodes are no longer mapped,
+         * matrix entries and statistics are owned by the mapped edge. */
+        EdgeID mapped = INVALID_ENTITY_ID;
+        GrB_Matrix_extractElement_UINT64(&mapped, _Graph_GetRelationMap(g, r),
+                                         Edge_GetDestNodeID(e), Edge_GetSrcNodeID(e));
+        if(mapped != ENTITY_GET_ID(e)) continue;
+        rows[r] = array_append(rows[r], Edge_GetDestNodeID(e));
+        cols[r] = array_append(cols[r], Edge_GetSrcNodeID(e));
+        GraphStatistics_UpdateEdgeCount(&g->_stats, r,
+                                        Graph_GetNodeLabel(g, Edge_GetSrcNodeID(e)),
+                                        Graph_GetNodeLabel(g, Edge_GetDestNodeID(e)), -1);
+    }
 
-void Graph_DeleteNode(Graph *g, Node *n) {
-    assert(g && n);
-    
-    // Delete incoming/outgoing edges of deleted node.
-    Edge *e = NULL;
-    Edge *edges = array_new(Edge, 32);
+    // Clear relation matrices, their transposes and relation maps.
+    for(int r = 0; r < relationCount; r++) {
+        if(array_len(rows[r]) == 0) continue;
+        _Graph_ClearTuples(Graph_GetRelationMatrix(g, r), rows[r], cols[r]);
+        _Graph_ClearTuples(Graph_GetTransposedRelationMatrix(g, r), cols[r], rows[r]);
+        _Graph_ClearTuples(_Graph_GetRelationMap(g, r), rows[r], cols[r]);
+    }
 
-    Graph_GetNodeEdges(g, n, GRAPH_EDGE_DIR_BOTH, GRAPH_NO_RELATION, &edges);
-    uint32_t edgeCount = array_len(edges);
-    for(int j = 0; j < edgeCount; j++) Graph_DeleteEdge(g, edges+j);
+    /* Decrease number of edges connecting source to destination,
+     * clear adjacency matrix entries for which no edges remain. */
+    GrB_Matrix adj = Graph_GetAdjacencyMatrix(g);
+    GrB_Matrix tadj = Graph_GetTransposedAdjacencyMatrix(g);
+    GrB_Index *adj_rows = array_new(GrB_Index, deleted_edge_count);
+    GrB_Index *adj_cols = array_new(GrB_Index, deleted_edge_count);
+    for(int r = 0; r < relationCount; r++) {
+        for(uint32_t i = 0; i < array_len(rows[r]); i++) {
+            NodeID src_id = cols[r][i];
+            NodeID dest_id = rows[r][i];
+            uint32_t edge_count = 0;
+            GrB_Matrix_extractElement_UINT32(&edge_count, adj, dest_id, src_id);
+            assert(edge_count > 0);
+            // Entry exists, updated in place.
+            GrB_Matrix_setElement_UINT32(adj, edge_count - 1, dest_id, src_id);
+            GrB_Matrix_setElement_UINT32(tadj, edge_count - 1, src_id, dest_id);
+            if(edge_count > 1) continue;
+            adj_rows = array_append(adj_rows, dest_id);
+            adj_cols = array_append(adj_cols, src_id);
+        }
+    }
+    _Graph_ClearTuples(adj, adj_rows, adj_cols);
+    _Graph_ClearTuples(tadj, adj_cols, adj_rows);
+
+    // Collect diagonal entries per label.
+    int labelCount = Graph_LabelTypeCount(g);
+    GrB_Index **labeled = rm_malloc(sizeof(GrB_Index*) * labelCount);
+    for(int l = 0; l < labelCount; l++) labeled[l] = array_new(GrB_Index, 0);
+    for(uint32_t i = 0; i < deleted_node_count; i++) {
+        Node *n = deleted_nodes + i;
+        int l = n->entity->label;
+        if(l == GRAPH_NO_LABEL) continue;
+        labeled[l] = array_append(labeled[l], ENTITY_GET_ID(n));
+    }
 
-    // Clear label matrix at position node ID.
-    uint32_t label_count = array_len(g->labels);
-    for(int i = 0; i < label_count; i++) {
-        GrB_Matrix M = Graph_GetLabel(g, i);
-        GxB_Matrix_Delete(M, ENTITY_GET_ID(n), ENTITY_GET_ID(n));
+    // Clear label matrices.
+    for(int l = 0; l < labelCount; l++) {
+        if(array_len(labeled[l]) == 0) continue;
+        GraphStatistics_UpdateNodeCount(&g->_stats, l, -(int64_t)array_len(labeled[l]));
+        _Graph_ClearTuples(Graph_GetLabel(g, l), labeled[l], labeled[l]);
     }
 
-    FreeEntity(n->entity);
-    DataBlock_DeleteItem(g->nodes, ENTITY_GET_ID(n));
+    // Free and remove entities from datablocks.
+    for(uint32_t i = 0; i < deleted_edge_count; i++) {
+        Edge *e = deleted_edges + i;
+        FreeEntity(e->entity);
+        DataBlock_DeleteItem(g->edges, ENTITY_GET_ID(e));
+    }
+    for(uint32_t i = 0; i < deleted_node_count; i++) {
+        Node *n = deleted_nodes + i;
+        FreeEntity(n->entity);
+        DataBlock_DeleteItem(g->nodes, ENTITY_GET_ID(n));
+    }
 
     // Cleanup.
-    array_free(edges);
+    for(int r = 0; r < relationCount; r++) {
+        array_free(rows[r]);
+        array_free(cols[r]);
+    }
+    rm_free(rows);
+    rm_free(cols);
+    for(int l = 0; l < labelCount; l++) array_free(labeled[l]);
+    rm_free(labeled);
+    array_free(adj_rows);
+    array_free(adj_cols);
+    array_free(deleted_edges);
+    array_free(deleted_nodes);
+}
+
+/* Removes an edge from Graph and updates graph relevent matrices. */
+int Graph_DeleteEdge(Graph *g, Edge *e) {
+    uint edge_deleted;
+    Graph_BulkDelete(g, NULL, 0, e, 1, NULL, &edge_deleted);
+    return edge_deleted;
+}
+
+void Graph_DeleteNode(Graph *g, Node *n) {
+    assert(g && n);
+    Graph_BulkDelete(g, n, 1, NULL, 0, NULL, NULL);
 }
 
 DataBlockIterator *Graph_ScanNodes(const Graph *g) {
@@ -533,17 +772,55 @@ DataBlockIterator *Graph_ScanNodes(const Graph *g) {
     return DataBlock_Scan(g->nodes);
 }
 
+DataBlockIterator *Graph_ScanNodesRange(const Graph *g, NodeID start, NodeID end) {
+    assert(g);
+    return DataBlock_ScanRange(g->nodes, start, end);
+}
+
 DataBlockIterator *Graph_ScanEdges(const Graph *g) {
     assert(g);
     return DataBlock_Scan(g->edges);
 }
 
+void Graph_EnableColumnarProperties(Graph *g) {
+    assert(g && Graph_NodeCount(g) == 0 && Graph_EdgeCount(g) == 0);
+    if(g->_label_stores) return;
+
+    uint32_t labelCount = array_len(g->labels);
+    g->_label_stores = array_new(PropertyStore*, GRAPH_DEFAULT_LABEL_CAP);
+    for(int i = 0; i < labelCount; i++) {
+        g->_label_stores = array_append(g->_label_stores, PropertyStore_New());
+    }
+
+    uint32_t relationCount = Graph_RelationTypeCount(g);
+    g->_relation_stores = array_new(PropertyStore*, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    for(int i = 0; i < relationCount; i++) {
+        g->_relation_stores = array_append(g->_relation_stores, PropertyStore_New());
+    }
+}
+
+void Graph_EnableHypersparseMatrices(Graph *g) {
+    assert(g);
+    g->_hypersparse = true;
+
+    // Apply to existing matrices.
+    for(int i = 0; i < array_len(g->labels); i++) _Graph_SetMatrixFormat(g, g->labels[i]);
+    for(int i = 0; i < array_len(g->relations); i++) {
+        _Graph_SetMatrixFormat(g, g->relations[i]);
+        _Graph_SetMatrixFormat(g, g->_t_relations[i]);
+        _Graph_SetMatrixFormat(g, g->_relations_map[i]);
+    }
+}
+
 int Graph_AddLabel(Graph *g) {
     assert(g);
 
     GrB_Matrix m;
     GrB_Matrix_new(&m, GrB_BOOL, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
+    _Graph_SetMatrixFormat(g, m);
     array_append(g->labels, m);
+    GraphStatistics_AddLabel(&g->_stats);
+    if(g->_label_stores) g->_label_stores = array_append(g->_label_stores, PropertyStore_New());
     return array_len(g->labels)-1;
 }
 
@@ -552,9 +829,23 @@ int Graph_AddRelationType(Graph *g) {
 
     GrB_Matrix m;
     GrB_Matrix_new(&m, GrB_BOOL, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
+    _Graph_SetMatrixFormat(g, m);
     g->relations = array_append(g->relations, m);
 
+    GrB_Matrix tm;
+    GrB_Matrix_new(&tm, GrB_BOOL, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
+    _Graph_SetMatrixFormat(g, tm);
+    g->_t_relations = array_append(g->_t_relations, tm);
+
     _Graph_AddRelationMap(g);
+    PendingConnections pending = {
+        .rows = array_new(GrB_Index, 0),
+        .cols = array_new(GrB_Index, 0),
+        .ids = array_new(EdgeID, 0)
+    };
+    g->_pending = array_append(g->_pending, pending);
+    GraphStatistics_AddRelationType(&g->_stats);
+    if(g->_relation_stores) g->_relation_stores = array_append(g->_relation_stores, PropertyStore_New());
 
     // Edge mapping for relation K is at _relations_map[K].
     assert(array_len(g->_relations_map) == Graph_RelationTypeCount(g));
@@ -569,6 +860,13 @@ GrB_Matrix Graph_GetAdjacencyMatrix(const Graph *g) {
     return m;
 }
 
+GrB_Matrix Graph_GetTransposedAdjacencyMatrix(const Graph *g) {
+    assert(g);
+    GrB_Matrix m = g->_t_adjacency_matrix;
+    g->SynchronizeMatrix(g, m);
+    return m;
+}
+
 GrB_Matrix Graph_GetLabel(const Graph *g, int label_idx) {
     assert(g && label_idx < array_len(g->labels));
     GrB_Matrix m = g->labels[label_idx];
@@ -589,6 +887,82 @@ GrB_Matrix Graph_GetRelationMatrix(const Graph *g, int relation_idx) {
     return m;
 }
 
+GrB_Matrix Graph_GetTransposedRelationMatrix(const Graph *g, int relation_idx) {
+    assert(g && (relation_idx == GRAPH_NO_RELATION || relation_idx < Graph_RelationTypeCount(g)));
+    GrB_Matrix m;
+
+    if(relation_idx == GRAPH_NO_RELATION) {
+        m = Graph_GetTransposedAdjacencyMatrix(g);
+    } else {
+        m = g->_t_relations[relation_idx];
+        g->SynchronizeMatrix(g, m);
+    }
+    return m;
+}
+
+GrB_Matrix Graph_GetTransposedMatrix(const Graph *g, GrB_Matrix M) {
+    assert(g && M);
+    if(M == g->adjacency_matrix) return Graph_GetTransposedAdjacencyMatrix(g);
+
+    uint32_t relationCount = Graph_RelationTypeCount(g);
+    for(int i = 0; i < relationCount; i++) {
+        if(M == g->relations[i]) return Graph_GetTransposedRelationMatrix(g, i);
+    }
+
+    // Label matrices are diagonal, as such they are their own transpose.
+    uint32_t labelCount = Graph_LabelTypeCount(g);
+    for(int i = 0; i < labelCount; i++) {
+        if(M == g->labels[i]) return Graph_GetLabel(g, i);
+    }
+
+    return NULL;
+}
+
+bool Graph_IdentifyMatrix(const Graph *g, GrB_Matrix M, char *type, int *id, bool *transposed) {
+    assert(g && M && type && id && transposed);
+    *id = 0;
+    *type = 'A';
+    *transposed = (M == g->_t_adjacency_matrix);
+    if(M == g->adjacency_matrix || *transposed) return true;
+
+    *type = 'R';
+    uint32_t relationCount = Graph_RelationTypeCount(g);
+    for(int i = 0; i < relationCount; i++) {
+        *id = i;
+        *transposed = (M == g->_t_relations[i]);
+        if(M == g->relations[i] || *transposed) return true;
+    }
+
+    *type = 'L';
+    *transposed = false;
+    uint32_t labelCount = Graph_LabelTypeCount(g);
+    for(int i = 0; i < labelCount; i++) {
+        *id = i;
+        if(M == g->labels[i]) return true;
+    }
+
+    return false;
+}
+
+const GraphStatistics *Graph_GetStatistics(const Graph *g) {
+    assert(g);
+    // Edge counts of pending connections are resolved along with the matrices.
+    g->SynchronizeMatrix(g, g->adjacency_matrix);
+    return &g->_stats;
+}
+
+uint64_t Graph_Version(const Graph *g) {
+    assert(g);
+    return g->_version;
+}
+
+size_t Graph_MatrixMemoryUsage(GrB_Matrix M, bool *hypersparse) {
+    size_t size = 0;
+    GrB_Info res = GxB_Matrix_MemoryUsage(M, &size, hypersparse);
+    assert(res == GrB_SUCCESS);
+    return size;
+}
+
 void Graph_Free(Graph *g) {
     assert(g);
     // Free matrices.
@@ -596,17 +970,26 @@ void Graph_Free(Graph *g) {
     DataBlockIterator *it;
     GrB_Matrix m = Graph_GetAdjacencyMatrix(g);
 
+    GrB_Matrix_free(&m);
+    m = g->_t_adjacency_matrix;
     GrB_Matrix_free(&m);
 
     uint32_t relationCount = Graph_RelationTypeCount(g);
     for(int i = 0; i < relationCount; i++) {
         m = g->relations[i];
         GrB_Matrix_free(&m);
+        m = g->_t_relations[i];
+        GrB_Matrix_free(&m);
         m = g->_relations_map[i];
         GrB_Matrix_free(&m);
+        array_free(g->_pending[i].rows);
+        array_free(g->_pending[i].cols);
+        array_free(g->_pending[i].ids);
     }
     array_free(g->relations);
+    array_free(g->_t_relations);
     array_free(g->_relations_map);
+    array_free(g->_pending);
 
     uint32_t labelCount = array_len(g->labels);
     for(int i = 0; i < labelCount; i++) {
@@ -614,25 +997,38 @@ void Graph_Free(Graph *g) {
         GrB_Matrix_free(&m);
     }
     array_free(g->labels);
+    GraphStatistics_Free(&g->_stats);
 
+    // Entities backed by a columnar store are released along with their store.
     it = Graph_ScanNodes(g);
     while ((en = (Entity*)DataBlockIterator_Next(it)) != NULL)
-        FreeEntity(en);
+        if(!en->store) FreeEntity(en);
 
     DataBlockIterator_Free(it);
 
     it = Graph_ScanEdges(g);
     while ((en = DataBlockIterator_Next(it)) != NULL)
-        FreeEntity(en);
+        if(!en->store) FreeEntity(en);
 
     DataBlockIterator_Free(it);
 
+    if(g->_label_stores) {
+        for(int i = 0; i < array_len(g->_label_stores); i++) PropertyStore_Free(g->_label_stores[i]);
+        array_free(g->_label_stores);
+    }
+    if(g->_relation_stores) {
+        for(int i = 0; i < array_len(g->_relation_stores); i++) PropertyStore_Free(g->_relation_stores[i]);
+        array_free(g->_relation_stores);
+    }
+
     // Free blocks.
     DataBlock_Free(g->nodes);
     DataBlock_Free(g->edges);
 
     // Destroy graph-scoped locks.
-    pthread_mutex_destroy(&g->_mutex);
+    for(int i = 0; i < GRAPH_MATRIX_LOCK_COUNT; i++) {
+        pthread_mutex_destroy(&g->_matrix_locks[i]);
+    }
     pthread_mutex_destroy(&g->_writers_mutex);
     pthread_rwlock_destroy(&g->_rwlock);
 
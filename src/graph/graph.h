@@ -12,6 +12,8 @@
 
 #include "entities/node.h"
 #include "entities/edge.h"
+#include "entities/property_store.h"
+#include "graph_statistics.h"
 #include "../redismodule.h"
 #include "../util/triemap/triemap.h"
 #include "../util/datablock/datablock.h"
@@ -24,6 +26,7 @@
 #define GRAPH_DEFAULT_LABEL_CAP 16           // Default number of different labels a graph can hold before resizing.
 #define GRAPH_NO_LABEL -1                    // Labels are numbered [0-N], -1 represents no label.
 #define GRAPH_NO_RELATION -1                 // Relations are numbered [0-N], -1 represents no relation.
+#define GRAPH_MATRIX_LOCK_COUNT 64           // Number of locks guarding matrix synchronization.
 
 typedef enum {
     GRAPH_EDGE_DIR_INCOMING,
@@ -37,6 +40,15 @@ typedef enum {
     DISABLED,
 } MATRIX_POLICY;
 
+/* Connections formed by Graph_ConnectNodes are applied to
+ * the relation and adjacency matrices in bulk once matrices are synchronized,
+ * rows hold destination node ids, cols source node ids. */
+typedef struct {
+    GrB_Index *rows;    // Destination node ids.
+    GrB_Index *cols;    // Source node ids.
+    EdgeID *ids;        // Connecting edge ids.
+} PendingConnections;
+
 // Forward declaration of Graph struct
 typedef struct Graph Graph;
 // typedef for synchronization function pointer
@@ -45,14 +57,23 @@ typedef void (*SyncMatrixFunc)(const Graph*, GrB_Matrix);
 struct Graph {
     DataBlock *nodes;                   // Graph nodes stored in blocks.
     DataBlock *edges;                   // Graph edges stored in blocks.
-    GrB_Matrix adjacency_matrix;        // Adjacency matrix, holds all graph connections.
+    GrB_Matrix adjacency_matrix;        // Adjacency matrix, holds number of edges connecting each pair of nodes.
+    GrB_Matrix _t_adjacency_matrix;     // Transposed adjacency matrix.
     GrB_Matrix *labels;                 // Label matrices.
     GrB_Matrix *relations;              // Relation matrices.
+    GrB_Matrix *_t_relations;           // Transposed relation matrices.
     GrB_Matrix *_relations_map;         // Maps from (relation, row, col) to edge id.
+    PendingConnections *_pending;       // Connections yet to be applied to matrices, per relation.
+    uint64_t _pending_count;            // Number of pending connections across relations.
+    PropertyStore **_label_stores;      // Columnar property store per label, NULL if disabled.
+    PropertyStore **_relation_stores;   // Columnar property store per relation, NULL if disabled.
+    bool _hypersparse;                  // Label and relation matrices may switch to hypersparse format.
     pthread_mutex_t _writers_mutex;     // Mutex restrict single writer.
-    pthread_mutex_t _mutex;             // Mutex for accessing critical sections.
+    pthread_mutex_t _matrix_locks[GRAPH_MATRIX_LOCK_COUNT]; // Matrix synchronization locks, a matrix maps to a single lock.
     pthread_rwlock_t _rwlock;           // Read-write lock scoped to this specific graph
     bool _writelocked;                  // true if the read-write lock was acquired by a writer
+    uint64_t _version;                  // Write version, bumped whenever nodes or edges are added or removed.
+    GraphStatistics _stats;             // Entity counts, maintained on every write and applied connection.
     SyncMatrixFunc SynchronizeMatrix;   // Function pointer to matrix synchronization routine.
 };
 
@@ -71,7 +92,8 @@ void Graph_WriterEnter(Graph *g);
 /* Writer release access to graph. */
 void Graph_WriterLeave(Graph *g);
 
-/* Release the held lock */
+/* Release the held lock, a writer flushes all pending matrix
+ * operations beforehand, such that readers find matrices synchronized. */
 void Graph_ReleaseLock(Graph *g);
 
 /* Choose the current matrix synchronization policy. */
@@ -86,6 +108,22 @@ Graph *Graph_New (
     size_t edge_cap     // Allocation size for edge datablocks.
 );
 
+// Switch graph to columnar property layout,
+// attributes of labeled nodes and of edges are held in a dense
+// column per (label/relation, attribute) rather than by each entity.
+// Must be called before any entity is created.
+void Graph_EnableColumnarProperties (
+    Graph *g
+);
+
+// Allow label and relation matrices to use hypersparse format,
+// a matrix is converted to hypersparse once the number of its non empty
+// columns drops far below its dimension, avoiding an O(N) column
+// pointer array per sparse matrix.
+void Graph_EnableHypersparseMatrices (
+    Graph *g
+);
+
 // Creates a new label matrix, returns id given to label.
 int Graph_AddLabel (
     Graph *g
@@ -117,6 +155,9 @@ void Graph_CreateNode (
 );
 
 // Connects source node to destination node.
+// The connection is applied to the graph's matrices and statistics
+// once matrices are synchronized, connecting nodes already connected
+// by relation r replaces the edge mapped to them.
 // Returns 1 if connection is formed, 0 otherwise.
 int Graph_ConnectNodes (
     Graph *g,           // Graph on which to operate.
@@ -138,6 +179,19 @@ int Graph_DeleteEdge (
     Edge *e
 );
 
+// Removes nodes and edges from the graph, clearing each matrix
+// in a single pass. Edges connected to deleted nodes are removed as well,
+// duplicate and missing entities are ignored.
+void Graph_BulkDelete (
+    Graph *g,               // Graph to delete entities from.
+    Node *nodes,            // Nodes to delete.
+    size_t node_count,      // Number of nodes to delete.
+    Edge *edges,            // Edges to delete.
+    size_t edge_count,      // Number of edges to delete.
+    uint *node_deleted,     // [optional] Number of nodes removed.
+    uint *edge_deleted      // [optional] Number of given edges removed.
+);
+
 // All graph matrices are required to be squared NXN
 // where N is Graph_RequiredMatrixDim.
 size_t Graph_RequiredMatrixDim (
@@ -150,6 +204,14 @@ DataBlockIterator *Graph_ScanNodes (
     const Graph *g
 );
 
+// Retrieves a node iterator which can be used to access
+// nodes with IDs in the range [start, end).
+DataBlockIterator *Graph_ScanNodesRange (
+    const Graph *g,
+    NodeID start,
+    NodeID end
+);
+
 // Retrieves an edge iterator which can be used to access
 // every edge in the graph.
 DataBlockIterator *Graph_ScanEdges (
@@ -184,7 +246,7 @@ int Graph_GetNode (
     Node *n
 );
 
-// Retrieves node label
+// Retrieves node label, as stored within the node entity,
 // returns GRAPH_NO_LABEL if node has no label.
 int Graph_GetNodeLabel (
     const Graph *g,
@@ -225,12 +287,20 @@ void Graph_GetNodeEdges (
     Edge **edges            // array_t incoming/outgoing edges.
 );
 
-// Retrieves the adjacency matrix.
+// Retrieves the adjacency matrix, M[dest, src] holds the number of edges
+// (of any type) connecting src to dest, entries are never zero.
 // Matrix is resized if its size doesn't match graph's node count.
 GrB_Matrix Graph_GetAdjacencyMatrix (
     const Graph *g
 );
 
+// Retrieves the transposed adjacency matrix,
+// M[src, dest] is set if src is connected to dest.
+// Matrix is resized if its size doesn't match graph's node count.
+GrB_Matrix Graph_GetTransposedAdjacencyMatrix (
+    const Graph *g
+);
+
 // Retrieves a label matrix.
 // Matrix is resized if its size doesn't match graph's node count.
 GrB_Matrix Graph_GetLabel (
@@ -245,6 +315,52 @@ GrB_Matrix Graph_GetRelationMatrix (
     int relation        // Relation described by matrix.
 );
 
+// Retrieves a transposed typed adjacency matrix.
+// Matrix is resized if its size doesn't match graph's node count.
+GrB_Matrix Graph_GetTransposedRelationMatrix (
+    const Graph *g,     // Graph from which to get adjacency matrix.
+    int relation        // Relation described by matrix.
+);
+
+// Retrieves the maintained transpose of M,
+// label matrices are diagonal and are returned as is,
+// returns NULL if M isn't maintained by g.
+GrB_Matrix Graph_GetTransposedMatrix (
+    const Graph *g,     // Graph maintaining M.
+    GrB_Matrix M        // Matrix to look up.
+);
+
+// Identifies matrix M as one of g's matrices, sets type to
+// 'A' (adjacency), 'L' (label) or 'R' (relation), id to the label or
+// relation id and transposed if M holds the transpose of that matrix,
+// returns false if M isn't maintained by g.
+bool Graph_IdentifyMatrix (
+    const Graph *g,     // Graph maintaining M.
+    GrB_Matrix M,       // Matrix to look up.
+    char *type,         // Matrix type.
+    int *id,            // Label or relation id.
+    bool *transposed    // M is the transposed matrix.
+);
+
+// Returns graph's write version, which increases monotonically
+// whenever nodes or edges are created or deleted.
+uint64_t Graph_Version (
+    const Graph *g
+);
+
+// Retrieves graph statistics, counts of nodes per label
+// and edges per relation type, pending connections are applied beforehand.
+const GraphStatistics *Graph_GetStatistics (
+    const Graph *g
+);
+
+// Returns number of bytes allocated by matrix M,
+// sets hypersparse to true if M is in hypersparse format.
+size_t Graph_MatrixMemoryUsage (
+    GrB_Matrix M,           // Matrix to inspect.
+    bool *hypersparse       // [optional] Matrix format.
+);
+
 // Free graph.
 void Graph_Free (
     Graph *g
@@ -0,0 +1,83 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include <assert.h>
+#include <stdbool.h>
+#include "graph_statistics.h"
+#include "../util/arr.h"
+
+void GraphStatistics_Init(GraphStatistics *stats) {
+    assert(stats);
+    stats->node_count = array_new(uint64_t, 0);
+    stats->edge_count = array_new(uint64_t, 0);
+    stats->out_edges = array_new(uint64_t*, 0);
+    stats->in_edges = array_new(uint64_t*, 0);
+}
+
+void GraphStatistics_AddLabel(GraphStatistics *stats) {
+    stats->node_count = array_append(stats->node_count, 0);
+    uint32_t relationCount = array_len(stats->edge_count);
+    for(uint32_t r = 0; r < relationCount; r++) {
+        stats->out_edges[r] = array_append(stats->out_edges[r], 0);
+        stats->in_edges[r] = array_append(stats->in_edges[r], 0);
+    }
+}
+
+void GraphStatistics_AddRelationType(GraphStatistics *stats) {
+    uint32_t labelCount = array_len(stats->node_count);
+    uint64_t *out_edges = array_newlen(uint64_t, labelCount);
+    uint64_t *in_edges = array_newlen(uint64_t, labelCount);
+    for(uint32_t l = 0; l < labelCount; l++) {
+        out_edges[l] = 0;
+        in_edges[l] = 0;
+    }
+    stats->edge_count = array_append(stats->edge_count, 0);
+    stats->out_edges = array_append(stats->out_edges, out_edges);
+    stats->in_edges = array_append(stats->in_edges, in_edges);
+}
+
+void GraphStatistics_UpdateNodeCount(GraphStatistics *stats, int label, int64_t delta) {
+    if(label < 0) return;
+    assert(label < array_len(stats->node_count));
+    stats->node_count[label] += delta;
+}
+
+void GraphStatistics_UpdateEdgeCount(GraphStatistics *stats, int r, int src_label,
+                                     int dest_label, int64_t delta) {
+    assert(r >= 0 && r < array_len(stats->edge_count));
+    stats->edge_count[r] += delta;
+    if(src_label >= 0) stats->out_edges[r][src_label] += delta;
+    if(dest_label >= 0) stats->in_edges[r][dest_label] += delta;
+}
+
+uint64_t GraphStatistics_NodeCount(const GraphStatistics *stats, int label) {
+    if(label < 0 || label >= array_len(stats->node_count)) return 0;
+    return stats->node_count[label];
+}
+
+uint64_t GraphStatistics_EdgeCount(const GraphStatistics *stats, int r) {
+    if(r < 0 || r >= array_len(stats->edge_count)) return 0;
+    return stats->edge_count[r];
+}
+
+uint64_t GraphStatistics_LabelEdgeCount(const GraphStatistics *stats, int r, int label, bool outgoing) {
+    if(r < 0 || r >= array_len(stats->edge_count)) return 0;
+    if(label < 0 || label >= array_len(stats->node_count)) return 0;
+    return (outgoing) ? stats->out_edges[r][label] : stats->in_edges[r][label];
+}
+
+void GraphStatistics_Free(GraphStatistics *stats) {
+    uint32_t relationCount = array_len(stats->edge_count);
+    for(uint32_t r = 0; r < relationCount; r++) {
+        array_free(stats->out_edges[r]);
+        array_free(stats->in_edges[r]);
+    }
+    array_free(stats->out_edges);
+    array_free(stats->in_edges);
+    array_free(stats->edge_count);
+    array_free(stats->node_count);
+}
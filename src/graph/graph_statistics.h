@@ -0,0 +1,54 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __GRAPH_STATISTICS_H__
+#define __GRAPH_STATISTICS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Graph statistics, entity counts maintained incrementally
+ * as nodes and edges are created and deleted.
+ * The planner uses these to estimate cardinalities. */
+typedef struct {
+    uint64_t *node_count;   // Number of nodes per label.
+    uint64_t *edge_count;   // Number of edges per relation type.
+    uint64_t **out_edges;   // Per relation type, number of edges leaving nodes of each label.
+    uint64_t **in_edges;    // Per relation type, number of edges entering nodes of each label.
+} GraphStatistics;
+
+// Initialize empty statistics.
+void GraphStatistics_Init(GraphStatistics *stats);
+
+// Track a newly introduced label.
+void GraphStatistics_AddLabel(GraphStatistics *stats);
+
+// Track a newly introduced relation type.
+void GraphStatistics_AddRelationType(GraphStatistics *stats);
+
+// Account for nodes of given label being created (delta > 0) or deleted (delta < 0).
+void GraphStatistics_UpdateNodeCount(GraphStatistics *stats, int label, int64_t delta);
+
+// Account for an edge of relation r connecting src_label to dest_label
+// being created (delta > 0) or deleted (delta < 0).
+void GraphStatistics_UpdateEdgeCount(GraphStatistics *stats, int r, int src_label,
+                                     int dest_label, int64_t delta);
+
+// Number of nodes with given label.
+uint64_t GraphStatistics_NodeCount(const GraphStatistics *stats, int label);
+
+// Number of edges of relation type r.
+uint64_t GraphStatistics_EdgeCount(const GraphStatistics *stats, int r);
+
+// Number of edges of relation type r leaving (outgoing) or entering
+// nodes of given label.
+uint64_t GraphStatistics_LabelEdgeCount(const GraphStatistics *stats, int r, int label, bool outgoing);
+
+// Free statistics.
+void GraphStatistics_Free(GraphStatistics *stats);
+
+#endif
@@ -6,6 +6,9 @@
 #include "../redismodule.h"
 
 extern pthread_key_t _tlsGCKey;    // Thread local storage graph context key.
+extern bool _columnarProperties;   // Store entity properties in per schema columns.
+extern bool _hypersparseMatrices;  // Allow hypersparse label and relation matrices.
+extern size_t _pathCacheSize;      // Memory cap of each graph's path cache.
 
 //------------------------------------------------------------------------------
 // GraphContext API
@@ -29,6 +32,8 @@ GraphContext* GraphContext_New(RedisModuleCtx *ctx, const char *graphname,
 
   // Initialize the graph's matrices and datablock storage
   gc->g = Graph_New(node_cap, edge_cap);
+  if(_columnarProperties) Graph_EnableColumnarProperties(gc->g);
+  if(_hypersparseMatrices) Graph_EnableHypersparseMatrices(gc->g);
   gc->graph_name = rm_strdup(graphname);
   // Allocate the default space for schemas and indices
   gc->node_schemas = array_new(Schema*, GRAPH_DEFAULT_LABEL_CAP);
@@ -38,6 +43,11 @@ GraphContext* GraphContext_New(RedisModuleCtx *ctx, const char *graphname,
   gc->node_unified_schema = Schema_New("ALL", GRAPH_NO_LABEL);
   gc->relation_unified_schema = Schema_New("ALL", GRAPH_NO_RELATION);
 
+  gc->string_dict = StringDictionary_New();
+  gc->attribute_strings[SCHEMA_NODE] = array_new(uint32_t, 0);
+  gc->attribute_strings[SCHEMA_EDGE] = array_new(uint32_t, 0);
+  gc->path_cache = PathCache_New(_pathCacheSize);
+
   pthread_setspecific(_tlsGCKey, gc);
 
   // Set and close GraphContext key in Redis keyspace
@@ -235,6 +245,24 @@ void GraphContext_DeleteNodeFromIndices(GraphContext *gc, Node *n) {
 //------------------------------------------------------------------------------
 
 // Free all data associated with graph
+//------------------------------------------------------------------------------
+// String dictionary API
+//------------------------------------------------------------------------------
+
+bool GraphContext_InternValue(GraphContext *gc, SchemaType t, Attribute_ID attr_id, SIValue *v) {
+  if(!(v->type & SI_STRING)) return false;
+
+  // Attributes encountered for the first time haven't interned any string.
+  uint32_t *counts = gc->attribute_strings[t];
+  if(!counts) counts = array_new(uint32_t, attr_id + 1);
+  while(array_len(counts) <= attr_id) counts = array_append(counts, 0);
+  gc->attribute_strings[t] = counts;
+
+  bool hit;
+  *v = StringDictionary_InternValue(gc->string_dict, *v, &counts[attr_id], &hit);
+  return hit;
+}
+
 void GraphContext_Free(GraphContext *gc) {
   Graph_Free(gc->g);
   rm_free(gc->graph_name);
@@ -259,5 +287,11 @@ void GraphContext_Free(GraphContext *gc) {
     array_free(gc->relation_schemas);
   }
 
+  // Entities are gone, release interned strings.
+  StringDictionary_Free(gc->string_dict);
+  if(gc->attribute_strings[SCHEMA_NODE]) array_free(gc->attribute_strings[SCHEMA_NODE]);
+  if(gc->attribute_strings[SCHEMA_EDGE]) array_free(gc->attribute_strings[SCHEMA_EDGE]);
+  PathCache_Free(gc->path_cache);
+
   rm_free(gc);
 }
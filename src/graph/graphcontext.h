@@ -6,6 +6,8 @@
 #include "../index/index.h"
 #include "../schema/schema.h"
 #include "graph.h"
+#include "../util/string_dictionary.h"
+#include "path_cache.h"
 
 #define DEFAULT_INDEX_CAP 4
 
@@ -19,6 +21,9 @@ typedef struct {
   Schema **node_schemas;            // Array of schemas for each node label 
 
   unsigned short index_count;       // Number of indicies.
+  StringDictionary *string_dict;    // Interned string property values.
+  uint32_t *attribute_strings[2];   // Strings interned per attribute, indexed by SchemaType.
+  PathCache *path_cache;            // Materialized products shared across queries.
 } GraphContext;
 
 /* GraphContext API */
@@ -55,6 +60,11 @@ void GraphContext_AddNodeToIndices(GraphContext *gc, Schema *s, Node *n);
 // Remove a single node from all indices that refer to it
 void GraphContext_DeleteNodeFromIndices(GraphContext *gc, Node *n);
 
+/* String dictionary API */
+// Interns string value of attribute attr_id, see StringDictionary_InternValue.
+// Returns true if value was already present in the dictionary.
+bool GraphContext_InternValue(GraphContext *gc, SchemaType t, Attribute_ID attr_id, SIValue *v);
+
 // Free the GraphContext and all associated graph data
 void GraphContext_Free(GraphContext *gc);
 
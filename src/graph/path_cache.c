@@ -0,0 +1,175 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "path_cache.h"
+#include "../util/rmalloc.h"
+#include "../util/triemap/triemap.h"
+#include <assert.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+struct PathCacheEntry {
+    char *key;                      // Canonical operand sequence.
+    GrB_Matrix product;             // Materialized product.
+    uint64_t version;               // Graph version product was computed under.
+    size_t bytes;                   // Memory held by product.
+    uint32_t refcount;              // Number of outstanding references.
+    bool evicted;                   // Entry was removed from cache.
+    struct PathCacheEntry *prev;    // More recently used entry.
+    struct PathCacheEntry *next;    // Less recently used entry.
+};
+
+struct PathCache {
+    TrieMap *entries;           // Maps key to entry.
+    PathCacheEntry *head;       // Most recently used entry.
+    PathCacheEntry *tail;       // Least recently used entry.
+    size_t memory_cap;          // Maximum number of bytes held by products.
+    PathCacheStats stats;       // Usage statistics.
+    pthread_mutex_t lock;       // Guards cache.
+};
+
+static void _PathCacheEntry_Free(PathCacheEntry *entry) {
+    GrB_Matrix_free(&entry->product);
+    rm_free(entry->key);
+    rm_free(entry);
+}
+
+static void _PathCache_Unlink(PathCache *cache, PathCacheEntry *entry) {
+    if(entry->prev) entry->prev->next = entry->next;
+    else cache->head = entry->next;
+    if(entry->next) entry->next->prev = entry->prev;
+    else cache->tail = entry->prev;
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+static void _PathCache_PushFront(PathCache *cache, PathCacheEntry *entry) {
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if(cache->head) cache->head->prev = entry;
+    cache->head = entry;
+    if(!cache->tail) cache->tail = entry;
+}
+
+// Removes entry from cache, entry is freed once unreferenced.
+static void _PathCache_Evict(PathCache *cache, PathCacheEntry *entry) {
+    TrieMap_Delete(cache->entries, entry->key, strlen(entry->key), TrieMap_NOP_CB);
+    _PathCache_Unlink(cache, entry);
+    cache->stats.entries--;
+    cache->stats.bytes -= entry->bytes;
+    cache->stats.evictions++;
+
+    entry->evicted = true;
+    if(entry->refcount == 0) _PathCacheEntry_Free(entry);
+}
+
+PathCache *PathCache_New(size_t memory_cap) {
+    PathCache *cache = rm_calloc(1, sizeof(PathCache));
+    cache->entries = NewTrieMap();
+    cache->memory_cap = memory_cap;
+    int res = pthread_mutex_init(&cache->lock, NULL);
+    assert(res == 0);
+    (void)res;
+    return cache;
+}
+
+PathCacheEntry *PathCache_Get(PathCache *cache, const char *key, uint64_t version) {
+    assert(cache && key);
+    pthread_mutex_lock(&cache->lock);
+
+    PathCacheEntry *entry = TrieMap_Find(cache->entries, (char*)key, strlen(key));
+    if(entry == TRIEMAP_NOTFOUND) {
+        entry = NULL;
+    } else if(entry->version != version) {
+        // Graph was modified since product was computed.
+        _PathCache_Evict(cache, entry);
+        entry = NULL;
+    }
+
+    if(entry) {
+        _PathCache_Unlink(cache, entry);
+        _PathCache_PushFront(cache, entry);
+        entry->refcount++;
+        cache->stats.hits++;
+    } else {
+        cache->stats.misses++;
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+    return entry;
+}
+
+PathCacheEntry *PathCache_Put(PathCache *cache, const char *key, uint64_t version, GrB_Matrix product) {
+    assert(cache && key && product);
+
+    size_t bytes = 0;
+    GxB_Matrix_MemoryUsage(product, &bytes, NULL);
+    if(bytes > cache->memory_cap) return NULL;
+
+    PathCacheEntry *entry = rm_malloc(sizeof(PathCacheEntry));
+    entry->key = rm_strdup(key);
+    entry->product = product;
+    entry->version = version;
+    entry->bytes = bytes;
+    entry->refcount = 1;
+    entry->evicted = false;
+
+    pthread_mutex_lock(&cache->lock);
+
+    // Product might have been introduced by a concurrent query.
+    PathCacheEntry *existing = TrieMap_Find(cache->entries, entry->key, strlen(key));
+    if(existing != TRIEMAP_NOTFOUND) _PathCache_Evict(cache, existing);
+
+    TrieMap_Add(cache->entries, entry->key, strlen(key), entry, NULL);
+    _PathCache_PushFront(cache, entry);
+    cache->stats.entries++;
+    cache->stats.bytes += bytes;
+
+    // Evict least recently used products until cache fits its cap.
+    while(cache->stats.bytes > cache->memory_cap) {
+        _PathCache_Evict(cache, cache->tail);
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+    return entry;
+}
+
+GrB_Matrix PathCacheEntry_Product(const PathCacheEntry *entry) {
+    assert(entry);
+    return entry->product;
+}
+
+void PathCache_Release(PathCache *cache, PathCacheEntry *entry) {
+    assert(cache && entry);
+    pthread_mutex_lock(&cache->lock);
+    assert(entry->refcount > 0);
+    entry->refcount--;
+    if(entry->evicted && entry->refcount == 0) _PathCacheEntry_Free(entry);
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void PathCache_GetStats(PathCache *cache, PathCacheStats *stats) {
+    assert(cache && stats);
+    pthread_mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void PathCache_Free(PathCache *cache) {
+    if(!cache) return;
+    PathCacheEntry *entry = cache->head;
+    while(entry) {
+        PathCacheEntry *next = entry->next;
+        assert(entry->refcount == 0);
+        _PathCacheEntry_Free(entry);
+        entry = next;
+    }
+    TrieMap_Free(cache->entries, TrieMap_NOP_CB);
+    pthread_mutex_destroy(&cache->lock);
+    rm_free(cache);
+}
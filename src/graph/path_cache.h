@@ -0,0 +1,61 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __PATH_CACHE_H__
+#define __PATH_CACHE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+/* Path cache, holds materialized products of graph matrices
+ * shared across queries, e.g. the friends of friends matrix R*R.
+ * Products are keyed by their canonical operand sequence and tagged
+ * with the graph's write version at the time they were computed,
+ * a product computed under an older version is never returned.
+ * The cache is bounded by a memory cap, once exceeded least recently
+ * used products are evicted. Products handed out are reference counted,
+ * an evicted product is freed once its last reference is released.
+ * All functions are thread safe. */
+
+typedef struct PathCache PathCache;
+typedef struct PathCacheEntry PathCacheEntry;
+
+typedef struct {
+    uint64_t hits;          // Number of lookups resolved by the cache.
+    uint64_t misses;        // Number of lookups which found no valid product.
+    uint64_t evictions;     // Number of products removed from the cache.
+    size_t entries;         // Number of cached products.
+    size_t bytes;           // Memory held by cached products.
+} PathCacheStats;
+
+// Create a new cache holding up to memory_cap bytes,
+// a cap of 0 disables caching.
+PathCache *PathCache_New(size_t memory_cap);
+
+// Retrieves product associated with key, computed under given version,
+// returns NULL if missing. A returned entry must be released.
+PathCacheEntry *PathCache_Get(PathCache *cache, const char *key, uint64_t version);
+
+// Introduces product computed under given version,
+// on success cache takes ownership of product and a referenced entry
+// is returned, NULL is returned if product does not fit in cache.
+PathCacheEntry *PathCache_Put(PathCache *cache, const char *key, uint64_t version, GrB_Matrix product);
+
+// Returns product held by entry.
+GrB_Matrix PathCacheEntry_Product(const PathCacheEntry *entry);
+
+// Releases a reference to entry.
+void PathCache_Release(PathCache *cache, PathCacheEntry *entry);
+
+// Retrieves cache statistics.
+void PathCache_GetStats(PathCache *cache, PathCacheStats *stats);
+
+// Free cache and all of its products, no entry may be referenced.
+void PathCache_Free(PathCache *cache);
+
+#endif
@@ -16,6 +16,9 @@
 
 /* Thread local storage graph context key. */
 extern pthread_key_t _tlsGCKey;
+extern bool _columnarProperties;   // Store entity properties in per schema columns.
+extern size_t _pathCacheSize;      // Memory cap of each graph's path cache.
+extern bool _hypersparseMatrices;  // Allow hypersparse label and relation matrices.
 
 /* Declaration of the type for redis registration. */
 RedisModuleType *GraphContextRedisModuleType;
@@ -129,6 +132,8 @@ void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver) {
   gc->graph_name = RedisModule_LoadStringBuffer(rdb, NULL);
 
   gc->g = Graph_New(GRAPH_DEFAULT_NODE_CAP, GRAPH_DEFAULT_EDGE_CAP);
+  if(_columnarProperties) Graph_EnableColumnarProperties(gc->g);
+  if(_hypersparseMatrices) Graph_EnableHypersparseMatrices(gc->g);
 
   // #Node schemas
   uint32_t schema_count = RedisModule_LoadUnsigned(rdb);
@@ -157,7 +162,11 @@ void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver) {
   }
 
   // Graph object.
-  RdbLoadGraph(rdb, gc->g, gc->node_unified_schema, gc->relation_unified_schema);
+  gc->string_dict = StringDictionary_New();
+  gc->attribute_strings[SCHEMA_NODE] = array_new(uint32_t, 0);
+  gc->attribute_strings[SCHEMA_EDGE] = array_new(uint32_t, 0);
+  gc->path_cache = PathCache_New(_pathCacheSize);
+  RdbLoadGraph(rdb, encver, gc);
 
   // #Indices
   // (index label, index property) X #indices
@@ -12,7 +12,9 @@
 
 extern RedisModuleType *GraphContextRedisModuleType;
 
-#define GRAPHCONTEXT_TYPE_ENCODING_VERSION 2
+#define GRAPHCONTEXT_TYPE_ENCODING_VERSION 3
+// First encoding version to store 64 bit integer properties natively.
+#define GRAPHCONTEXT_TYPE_INT64_ENCODING_VERSION 3
 
 /* Commands related to the redis Graph registration */
 int GraphContextType_Register(RedisModuleCtx *ctx);
@@ -8,6 +8,7 @@
 #include <assert.h>
 #include "../graph.h"
 #include "serialize_graph.h"
+#include "graphcontext_type.h"
 #include "../../util/arr.h"
 #include "../../util/qsort.h"
 #include "../../../deps/GraphBLAS/Include/GraphBLAS.h"
@@ -75,12 +76,15 @@ static void _Schema_FreeAttributeMapping(char **mapping, unsigned short mapping_
     free(mapping);
 }
 
-SIValue _RdbLoadSIValue(RedisModuleIO *rdb) {
+SIValue _RdbLoadSIValue(RedisModuleIO *rdb, int encver) {
     /* Format:
      * SIType
      * Value */
     SIType t = RedisModule_LoadUnsigned(rdb);
-    if(t & SI_NUMERIC) {
+    if(t == T_INT64 && encver >= GRAPHCONTEXT_TYPE_INT64_ENCODING_VERSION) {
+        return SI_LongVal(RedisModule_LoadSigned(rdb));
+    } else if(t & SI_NUMERIC) {
+        // Earlier encodings store every numeric as a double.
         return SI_DoubleVal(RedisModule_LoadDouble(rdb));
     } else if (t == T_BOOL) {
         return SI_BoolVal(RedisModule_LoadUnsigned(rdb));
@@ -94,7 +98,7 @@ SIValue _RdbLoadSIValue(RedisModuleIO *rdb) {
     }
 }
 
-void _RdbLoadEntity(RedisModuleIO *rdb, GraphEntity *e, Schema *s) {
+void _RdbLoadEntity(RedisModuleIO *rdb, int encver, GraphEntity *e, Schema *s, SchemaType t, GraphContext *gc) {
     /* Format:
      * #properties N
      * (name, value type, value) X N
@@ -104,15 +108,16 @@ void _RdbLoadEntity(RedisModuleIO *rdb, GraphEntity *e, Schema *s) {
 
     for(int i = 0; i < propCount; i++) {
         char *attr_name = RedisModule_LoadStringBuffer(rdb, NULL);
-        SIValue attr_value = _RdbLoadSIValue(rdb);
+        SIValue attr_value = _RdbLoadSIValue(rdb, encver);
         Attribute_ID attr_id = Schema_GetAttributeID(s, attr_name);
         assert(attr_id != ATTRIBUTE_NOTFOUND);
+        GraphContext_InternValue(gc, t, attr_id, &attr_value);
         GraphEntity_AddProperty(e, attr_id, attr_value);
         RedisModule_Free(attr_name);
     }
 }
 
-void _RdbLoadNodes(RedisModuleIO *rdb, Graph *g, Schema *s) {
+void _RdbLoadNodes(RedisModuleIO *rdb, int encver, Graph *g, Schema *s, GraphContext *gc) {
     /* Format:
      * #nodes
      *      ID
@@ -139,11 +144,11 @@ void _RdbLoadNodes(RedisModuleIO *rdb, Graph *g, Schema *s) {
         uint64_t l = RedisModule_LoadUnsigned(rdb);
         Graph_CreateNode(g, l, &n);
 
-        _RdbLoadEntity(rdb, (GraphEntity*)&n, s);
+        _RdbLoadEntity(rdb, encver, (GraphEntity*)&n, s, SCHEMA_NODE, gc);
     }
 }
 
-void _RdbLoadEdges(RedisModuleIO *rdb, Graph *g, Schema *s) {
+void _RdbLoadEdges(RedisModuleIO *rdb, int encver, Graph *g, Schema *s, GraphContext *gc) {
     /* Format:
      * #edges (N)
      * {
@@ -166,7 +171,7 @@ void _RdbLoadEdges(RedisModuleIO *rdb, Graph *g, Schema *s) {
         NodeID destId = RedisModule_LoadUnsigned(rdb);
         uint64_t relation = RedisModule_LoadUnsigned(rdb);
         assert(Graph_ConnectNodes(g, srcId, destId, relation, &e));
-        _RdbLoadEntity(rdb, (GraphEntity*)&e, s);
+        _RdbLoadEntity(rdb, encver, (GraphEntity*)&e, s, SCHEMA_EDGE, gc);
     }
 }
 
@@ -175,8 +180,12 @@ void _RdbSaveSIValue(RedisModuleIO *rdb, const SIValue *v) {
      * SIType
      * Value */
     RedisModule_SaveUnsigned(rdb, v->type);
-    if(v->type & SI_NUMERIC) {
-        RedisModule_SaveDouble(rdb, v->doubleval);
+    if(v->type == T_INT64) {
+        RedisModule_SaveSigned(rdb, v->longval);
+    } else if(v->type & SI_NUMERIC) {
+        double d;
+        SIValue_ToDouble(v, &d);
+        RedisModule_SaveDouble(rdb, d);
     } else if (v->type == T_BOOL) {
         RedisModule_SaveUnsigned(rdb, v->boolval);
     } else if (v->type == T_NULL) {
@@ -195,6 +204,19 @@ void _RdbSaveEntity(RedisModuleIO *rdb, const Entity *e, char **attr_map) {
 
     RedisModule_SaveUnsigned(rdb, e->prop_count);
 
+    if(e->store) {
+        // Attributes are held by a columnar store.
+        unsigned short column_count = PropertyStore_ColumnCount(e->store);
+        for(Attribute_ID i = 0; i < column_count; i++) {
+            SIValue *v = PropertyStore_Get(e->store, i, e->id);
+            if(v == PROPERTY_NOTFOUND) continue;
+            char *attr_name = attr_map[i];
+            RedisModule_SaveStringBuffer(rdb, attr_name, strlen(attr_name) + 1);
+            _RdbSaveSIValue(rdb, v);
+        }
+        return;
+    }
+
     for(int i = 0; i < e->prop_count; i++) {
         EntityProperty attr = e->properties[i];
         char *attr_name = attr_map[attr.id];
@@ -229,7 +251,7 @@ void _RdbSaveNodes(RedisModuleIO *rdb, const Graph *g, Schema *s) {
         RedisModule_SaveUnsigned(rdb, 1);
 
         // (labels) X M
-        int l = Graph_GetNodeLabel(g, e->id);
+        int l = e->label;
         RedisModule_SaveUnsigned(rdb, l);
         
         // properties N
@@ -335,7 +357,7 @@ void RdbSaveGraph(RedisModuleIO *rdb, void *value, Schema *ns, Schema *es) {
     _RdbSaveEdges(rdb, g, es);
 }
 
-void RdbLoadGraph(RedisModuleIO *rdb, Graph *g, Schema *ns, Schema *es) {
+void RdbLoadGraph(RedisModuleIO *rdb, int encver, GraphContext *gc) {
      /* Format:
      * #nodes
      *      #labels M
@@ -351,14 +373,16 @@ void RdbLoadGraph(RedisModuleIO *rdb, Graph *g, Schema *ns, Schema *es) {
      *      (name, value type, value) X N
      */
 
+    Graph *g = gc->g;
+
     // While loading the graph, minimize matrix realloc and synchronization calls.
     Graph_SetMatrixPolicy(g, RESIZE_TO_CAPACITY);
 
     // Load nodes.
-    _RdbLoadNodes(rdb, g, ns);
+    _RdbLoadNodes(rdb, encver, g, gc->node_unified_schema, gc);
 
     // Load edges.
-    _RdbLoadEdges(rdb, g, es);
+    _RdbLoadEdges(rdb, encver, g, gc->relation_unified_schema, gc);
 
     // Revert to default synchronization behavior
     Graph_SetMatrixPolicy(g, SYNC_AND_MINIMIZE_SPACE);
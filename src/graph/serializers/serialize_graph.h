@@ -10,8 +10,10 @@
 
 #include "../../redismodule.h"
 #include "../../schema/schema.h"
+#include "../graphcontext.h"
 
-void RdbLoadGraph(RedisModuleIO *rdb, Graph *g, Schema *ns, Schema *es);
+// Loads gc's graph encoded in version encver, string property values are interned.
+void RdbLoadGraph(RedisModuleIO *rdb, int encver, GraphContext *gc);
 void RdbSaveGraph(RedisModuleIO *rdb, void *value, Schema *ns, Schema *es);
 
 #endif
@@ -6,43 +6,105 @@
 */
 
 #include "group_cache.h"
+#include "../util/rmalloc.h"
+
+/* Entries are keyed by their group's array of values,
+ * keys of equal length are compared value by value. */
+static int _CacheGroup_KeysDiffer(const void *a, const void *b, size_t len) {
+    return !CacheGroupKeysMatch(a, b, len / sizeof(SIValue));
+}
+
+#define uthash_malloc(sz) rm_malloc(sz)
+#define uthash_free(ptr,sz) rm_free(ptr)
+#define uthash_memcmp(a,b,n) _CacheGroup_KeysDiffer(a,b,n)
+#include "../util/uthash.h"
+
+struct CacheGroupEntry {
+    UT_hash_handle hh;      // Makes entry hashable.
+    Group *group;
+};
+
+static unsigned _CacheGroup_Hash(const SIValue *keys, int key_count) {
+    uint64_t h = 0;
+    for(int i = 0; i < key_count; i++) h = h * 31 + SIValue_HashCode(keys[i]);
+    return (unsigned)(h ^ (h >> 32));
+}
+
+bool CacheGroupKeysMatch(const SIValue *a, const SIValue *b, int key_count) {
+    for(int i = 0; i < key_count; i++) {
+        int cmp = SIValue_Compare(a[i], b[i]);
+        if(cmp == DISJOINT) {
+            if(a[i].type != b[i].type) return false;
+        } else if(cmp != 0) {
+            return false;
+        }
+    }
+    return true;
+}
 
 CacheGroup* CacheGroupNew() {
-    return NewTrieMap();
+    CacheGroup *groups = rm_malloc(sizeof(CacheGroup));
+    groups->entries = NULL;
+    return groups;
 }
 
-void CacheGroupAdd(CacheGroup *groups, char *key, Group *group) {
-    TrieMap_Add(groups, key, strlen(key), group, NULL);
+void CacheGroupAdd(CacheGroup *groups, Group *group) {
+    CacheGroupEntry *entry = rm_malloc(sizeof(CacheGroupEntry));
+    entry->group = group;
+    unsigned hash = _CacheGroup_Hash(group->keys, group->key_count);
+    HASH_ADD_KEYPTR_BYHASHVALUE(hh, groups->entries, group->keys,
+                                group->key_count * sizeof(SIValue), hash, entry);
 }
 
 // Retrives a group,
 // Sets group to NULL if key is missing.
-Group* CacheGroupGet(CacheGroup *groups, char *key) {
-    Group *g = TrieMap_Find(groups, key, strlen(key));
-    if (g == TRIEMAP_NOTFOUND) return NULL;
-    return g;
+Group* CacheGroupGet(CacheGroup *groups, const SIValue *keys, int key_count) {
+    CacheGroupEntry *entry;
+    unsigned hash = _CacheGroup_Hash(keys, key_count);
+    HASH_FIND_BYHASHVALUE(hh, groups->entries, keys, key_count * sizeof(SIValue), hash, entry);
+    return (entry) ? entry->group : NULL;
+}
+
+Group* CacheGroupPop(CacheGroup *groups) {
+    CacheGroupEntry *entry = groups->entries;
+    if(!entry) return NULL;
+
+    Group *group = entry->group;
+    HASH_DEL(groups->entries, entry);
+    rm_free(entry);
+    return group;
 }
 
 void FreeGroupCache(CacheGroup *groups) {
-    TrieMap_Free(groups, (void (*)(void *))FreeGroup);
+    if(!groups) return;
+    CacheGroupEntry *entry, *tmp;
+    HASH_ITER(hh, groups->entries, entry, tmp) {
+        HASH_DEL(groups->entries, entry);
+        FreeGroup(entry->group);
+        rm_free(entry);
+    }
+    rm_free(groups);
 }
 
 // Returns an iterator to scan entire group cache
 CacheGroupIterator* CacheGroupIter(CacheGroup *groups) {
-    char *prefix = "";
-	return TrieMap_Iterate(groups, prefix, strlen(prefix));
+    CacheGroupIterator *iter = rm_malloc(sizeof(CacheGroupIterator));
+    iter->next = groups->entries;
+    return iter;
 }
 
-// Advance iterator and returns key & value in current position.
-int CacheGroupIterNext(CacheGroupIterator *iter, char **key, Group **group) {
-    tm_len_t len = 0;
-    int res = TrieMapIterator_Next(iter, key, &len, (void**)group);
-    if(res == 0) {
+// Advance iterator and returns group in current position.
+int CacheGroupIterNext(CacheGroupIterator *iter, Group **group) {
+    CacheGroupEntry *entry = iter->next;
+    if(!entry) {
         *group = NULL;
+        return 0;
     }
-    return res;
+    *group = entry->group;
+    iter->next = entry->hh.next;
+    return 1;
 }
 
 void CacheGroupIterator_Free(CacheGroupIterator* iter) {
-    if(iter) TrieMapIterator_Free(iter);
+    if(iter) rm_free(iter);
 }
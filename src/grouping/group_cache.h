@@ -8,28 +8,48 @@
 #ifndef GROUP_CACHE_H_
 #define GROUP_CACHE_H_
 
+#include <stdbool.h>
 #include "group.h"
-#include "../util/triemap/triemap.h"
 
-typedef TrieMapIterator CacheGroupIterator;
-typedef TrieMap CacheGroup;
+/* Group cache is a hash table of groups, keyed by the values
+ * composing each group. Two keys match if each pair of their values
+ * compares as equal, incomparable values such as NULLs match
+ * values of the same type. */
+
+typedef struct CacheGroupEntry CacheGroupEntry;
+
+typedef struct {
+    CacheGroupEntry *entries;   // Hash table of groups.
+} CacheGroup;
+
+typedef struct {
+    CacheGroupEntry *next;      // Entry to return next.
+} CacheGroupIterator;
 
 CacheGroup* CacheGroupNew();
 
-void CacheGroupAdd(CacheGroup *groups, char *key, Group *group);
+// Adds group to cache, keyed by group's keys.
+void CacheGroupAdd(CacheGroup *groups, Group *group);
+
+// Retrives group composed of key_count keys,
+// returns NULL if group is missing.
+Group* CacheGroupGet(CacheGroup *groups, const SIValue *keys, int key_count);
+
+// Removes an arbitrary group from cache and returns it,
+// returns NULL if cache is empty.
+Group* CacheGroupPop(CacheGroup *groups);
 
-// Retrives a group,
-// Sets group to NULL if key is missing.
-Group* CacheGroupGet(CacheGroup *groups, char *key);
+// Checks if two group keys, each composed of key_count values, match.
+bool CacheGroupKeysMatch(const SIValue *a, const SIValue *b, int key_count);
 
 void FreeGroupCache(CacheGroup *groups);
 
 // Returns an iterator to scan hashtable
 CacheGroupIterator* CacheGroupIter(CacheGroup *groups);
 
-// Advance iterator and returns key & value in current position.
-int CacheGroupIterNext(CacheGroupIterator *iter, char **key, Group **group);
+// Advance iterator and returns group in current position.
+int CacheGroupIterNext(CacheGroupIterator *iter, Group **group);
 
 void CacheGroupIterator_Free(CacheGroupIterator* iter);
 
-#endif
\ No newline at end of file
+#endif
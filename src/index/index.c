@@ -30,7 +30,15 @@ int compareStrings(SIValue *a, SIValue *b) {
 }
 
 int compareNumerics(SIValue *a, SIValue *b) {
-  double diff = a->doubleval - b->doubleval;
+  // Compare 64 bit integers natively, avoiding loss of precision.
+  if (a->type == T_INT64 && b->type == T_INT64) {
+    return (a->longval > b->longval) - (a->longval < b->longval);
+  }
+
+  double x, y;
+  SIValue_ToDouble(a, &x);
+  SIValue_ToDouble(b, &y);
+  double diff = x - y;
   return COMPARE_RETVAL(diff);
 }
 
@@ -71,41 +79,19 @@ Index* Index_Create(Graph *g, const char *label, int label_id, const char *attr_
   initializeSkiplists(index);
 
   Node node;
-  EntityProperty *prop;
-
   skiplist *sl;
   NodeID node_id;
-  GraphEntity *entity;
-
-  int found;
-  int prop_index = 0;
 
   while(true) {
     bool depleted = false;
     GxB_MatrixTupleIter_next(it, NULL, &node_id, &depleted);
     if(depleted) break;
     Graph_GetNode(g, node_id, &node);
-    // If the sought property is at a different offset than it occupied in the previous node,
-    // then seek and update
-    if (attr_id != ENTITY_PROPS(&node)[prop_index].id) {
-      found = 0;
-      for (int i = 0; i < ENTITY_PROP_COUNT(&node); i ++) {
-        prop = ENTITY_PROPS(&node) + i;
-        if (attr_id == prop->id) {
-          prop_index = i;
-          found = 1;
-          break;
-        }
-      }
-    } else {
-      found = 1;
-    }
-    // The targeted property does not exist on this node
-    if (!found) continue;
 
-    prop = ENTITY_PROPS(&node) + prop_index;
     // This value will be cloned within the skiplistInsert routine if necessary
-    SIValue *key = &prop->value;
+    SIValue *key = GraphEntity_GetProperty((GraphEntity*)&node, attr_id);
+    // The targeted property does not exist on this node
+    if (key == PROPERTY_NOTFOUND) continue;
 
     sl = _select_skiplist(index, key->type);
     if (!sl) continue; // Value was of a type not supported by indices.
@@ -132,6 +118,11 @@ void Index_DeleteNode(Index *idx, NodeID node, SIValue *val) {
   skiplistInsert(sl, val, node);
 }
 
+uint64_t Index_DistinctValues(const Index *idx) {
+  // Skiplists hold a single entry per distinct value.
+  return idx->string_sl->length + idx->numeric_sl->length;
+}
+
 //------------------------------------------------------------------------------
 // Index iterator functions
 //------------------------------------------------------------------------------
@@ -43,6 +43,9 @@ void Index_DeleteNode(Index *idx, NodeID node, SIValue *val);
 /* Insert a single entity into an index. */
 void Index_InsertNode(Index *idx, NodeID node, SIValue *val);
 
+/* Number of distinct values held by the index. */
+uint64_t Index_DistinctValues(const Index *idx);
+
 /* Build a new iterator to traverse all indexed values of the specified type. */
 IndexIter* IndexIter_Create(Index *idx, SIType type);
 
@@ -20,6 +20,11 @@
 threadpool _thpool = NULL;
 pthread_key_t _tlsGCKey;    // Thread local storage graph context key.
 pthread_key_t _tlsASTKey;   // Thread local storage AST key.
+bool _columnarProperties = false;   // Store entity properties in per schema columns.
+bool _hypersparseMatrices = false;  // Allow hypersparse label and relation matrices.
+size_t _pathCacheSize = PATH_CACHE_DEFAULT_SIZE;   // Memory cap of each graph's path cache.
+int _parallelWorkers = 1;   // Number of threads executing parallel queries, shared by all queries.
+size_t _parallelThreshold = PARALLEL_DEFAULT_THRESHOLD;    // Number of scanned nodes above which queries run in parallel.
 
 /* Set up thread pool,
  * number of threads within pool should be
@@ -70,6 +75,23 @@ int RedisModule_OnLoad(RedisModuleCtx *ctx, RedisModuleString **argv, int argc)
     if (!_Setup_ThreadPOOL(threadCount)) return REDISMODULE_ERR;
     RedisModule_Log(ctx, "notice", "Thread pool created, using %d threads.", threadCount);
 
+    _columnarProperties = Config_GetColumnarProperties(argv, argc);
+    if(_columnarProperties) RedisModule_Log(ctx, "notice", "Using columnar property storage.");
+
+    _hypersparseMatrices = Config_GetHypersparseMatrices(argv, argc);
+    if(_hypersparseMatrices) RedisModule_Log(ctx, "notice", "Using hypersparse label and relation matrices.");
+
+    _pathCacheSize = Config_GetPathCacheSize(argv, argc);
+    RedisModule_Log(ctx, "notice", "Path cache size: %zu bytes.", _pathCacheSize);
+
+    // Parallel queries are executed by as many threads as the thread pool holds.
+    _parallelWorkers = threadCount;
+    _parallelThreshold = Config_GetParallelThreshold(argv, argc);
+    if(_parallelThreshold && _parallelWorkers > 1) {
+        RedisModule_Log(ctx, "notice", "Queries scanning over %zu nodes run on %d threads.",
+                        _parallelThreshold, _parallelWorkers);
+    }
+
     if (_RegisterDataTypes(ctx) != REDISMODULE_OK) return REDISMODULE_ERR;
 
     if(RedisModule_CreateCommand(ctx, "graph.QUERY", MGraph_Query, "write deny-oom deny-script", 1, 1, 1) == REDISMODULE_ERR) {
@@ -88,5 +110,9 @@ int RedisModule_OnLoad(RedisModuleCtx *ctx, RedisModuleString **argv, int argc)
         return REDISMODULE_ERR;
     }
 
+    if(RedisModule_CreateCommand(ctx, "graph.MEMORY", MGraph_Memory, "readonly deny-script", 1, 1, 1) == REDISMODULE_ERR) {
+        return REDISMODULE_ERR;
+    }
+
     return REDISMODULE_OK;
 }
@@ -95,6 +95,18 @@ int ReturnClause_ContainsAggregation(const AST_ReturnNode *returnNode) {
     return 0;
 }
 
+int ReturnClause_AggregatesAll(const AST_ReturnNode *returnNode) {
+    if(!returnNode) return 0;
+
+    uint elemCount = array_len(returnNode->returnElements);
+    for(uint i = 0; i < elemCount; i++) {
+        AST_ArithmeticExpressionNode *exp = returnNode->returnElements[i]->exp;
+        if(!exp || !_ContainsAggregation(exp)) return 0;
+    }
+
+    return 1;
+}
+
 void ReturnClause_ReferredEntities(const AST_ReturnNode *returnNode, TrieMap *referred_nodes) {
     if(!returnNode) return;
     
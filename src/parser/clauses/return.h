@@ -34,6 +34,10 @@ int ReturnClause_ContainsCollapsedNodes(const AST_ReturnNode *return_node);
 
 int ReturnClause_ContainsAggregation(const AST_ReturnNode *return_node);
 
+/* Checks if every return element is aggregated, in which case
+ * the return clause forms a single group. */
+int ReturnClause_AggregatesAll(const AST_ReturnNode *return_node);
+
 void ReturnClause_ReferredEntities(const AST_ReturnNode *return_node, TrieMap *referred_nodes);
 
 void ReturnClause_ReferredFunctions(const AST_ReturnNode *return_node, TrieMap *referred_funcs);
@@ -30,6 +30,7 @@
 	#include <stdio.h>
 	#include <assert.h>
 	#include <limits.h>
+	#include <strings.h>
 	#include "token.h"	
 	#include "grammar.h"
 	#include "ast.h"
@@ -46,7 +47,7 @@
 	*/
 	// Increase depth from 100 to 1000 to handel deep recursion.
 	#define YYSTACKDEPTH 1000
-#line 50 "grammar.c"
+#line 51 "grammar.c"
 /**************** End of %include directives **********************************/
 /* These constants specify the various numeric values for terminal symbols
 ** in a format understandable to "makeheaders".  This section is blank unless
@@ -150,17 +151,17 @@ typedef union {
 #define ParseARG_PDECL , parseCtx *ctx 
 #define ParseARG_FETCH  parseCtx *ctx  = yypParser->ctx 
 #define ParseARG_STORE yypParser->ctx  = ctx 
-#define YYNSTATE             126
-#define YYNRULE              110
+#define YYNSTATE             127
+#define YYNRULE              111
 #define YYNTOKEN             52
-#define YY_MAX_SHIFT         125
-#define YY_MIN_SHIFTREDUCE   198
-#define YY_MAX_SHIFTREDUCE   307
-#define YY_ERROR_ACTION      308
-#define YY_ACCEPT_ACTION     309
-#define YY_NO_ACTION         310
-#define YY_MIN_REDUCE        311
-#define YY_MAX_REDUCE        420
+#define YY_MAX_SHIFT         126
+#define YY_MIN_SHIFTREDUCE   200
+#define YY_MAX_SHIFTREDUCE   310
+#define YY_ERROR_ACTION      311
+#define YY_ACCEPT_ACTION     312
+#define YY_NO_ACTION         313
+#define YY_MIN_REDUCE        314
+#define YY_MAX_REDUCE        424
 /************* End control #defines *******************************************/
 
 /* Define the yytestcase() macro to be a no-op if is not already defined
@@ -226,128 +227,131 @@ typedef union {
 **  yy_default[]       Default action for each state.
 **
 *********** Begin parsing tables **********************************************/
-#define YY_ACTTAB_COUNT (335)
+#define YY_ACTTAB_COUNT (349)
 static const YYACTIONTYPE yy_action[] = {
- /*     0 */   125,  309,   66,   13,  317,  322,   78,  270,   97,  340,
- /*    10 */    96,   12,  319,   43,   42,  325,  112,   57,  330,   90,
- /*    20 */    80,   20,   19,   18,   17,   16,  294,  295,  298,  296,
- /*    30 */   297,   26,  300,   78,  270,  393,   69,  108,    2,  273,
- /*    40 */    25,   33,   46,  393,   67,   95,  392,   80,   20,  302,
- /*    50 */   303,  305,  306,  307,  392,  393,   67,  120,  382,  300,
- /*    60 */    19,   18,   17,   16,   50,  299,  392,   36,  361,  118,
- /*    70 */   382,  102,    6,    8,   37,  361,  302,  303,  305,  306,
- /*    80 */   307,   19,   18,   17,   16,  294,  295,  298,  296,  297,
- /*    90 */    78,  263,   24,   23,  119,   78,  222,  341,   96,  100,
- /*   100 */    78,   27,  393,   67,   80,   20,   65,  100,   22,   80,
- /*   110 */     7,  314,   61,  392,   54,    1,  300,  381,   34,   57,
- /*   120 */   330,  300,   54,  343,  299,   85,  300,   39,   19,   18,
- /*   130 */    17,   16,  343,  302,  303,  305,  306,  307,  302,  303,
- /*   140 */   305,  306,  307,  302,  303,  305,  306,  307,   19,   18,
- /*   150 */    17,   16,  110,   38,   51,  393,   72,  393,   31,  393,
- /*   160 */    70,  393,   30,  393,   31,  273,  392,   54,  392,   92,
- /*   170 */   392,   75,  392,   73,  392,  377,   47,    6,    8,  393,
- /*   180 */    31,  393,   72,  393,   72,  301,   77,  117,   15,   56,
- /*   190 */   392,   76,  392,   35,  392,  318,   45,   79,  343,   74,
- /*   200 */   393,   71,   26,  304,  393,  390,  287,  288,   57,  330,
- /*   210 */    49,  392,  393,  389,   10,  392,   48,  393,   81,  393,
- /*   220 */    82,  393,   68,  392,    1,   91,   49,  116,  392,   54,
- /*   230 */   392,   35,  392,  121,   15,  101,  343,  105,  103,   84,
- /*   240 */   278,  111,   54,   15,   17,   16,   88,  333,   86,   24,
- /*   250 */    40,  326,   25,  321,  323,   21,  124,  123,   44,  235,
- /*   260 */    94,   54,  100,   98,   77,   99,  113,  362,  109,  106,
- /*   270 */   107,   26,  344,  331,  115,  372,  114,  316,   58,  122,
- /*   280 */    59,    1,   60,  312,   64,   62,    9,  293,   83,    3,
- /*   290 */     5,   63,  223,  224,   87,   41,   89,    8,   29,  236,
- /*   300 */    93,   14,  121,  242,  247,  257,   28,  245,  253,  311,
- /*   310 */    52,  240,  246,  244,  241,   55,  238,  251,  243,  104,
- /*   320 */   239,   53,   32,  237,    4,  272,  284,  310,  310,  310,
- /*   330 */   310,  310,  290,   11,  292,
+ /*     0 */   126,  312,   66,   13,  320,  325,   78,  272,   97,  343,
+ /*    10 */    96,   12,  322,   43,   42,  328,  112,   57,  333,   90,
+ /*    20 */    80,   20,   19,   18,   17,   16,  297,  298,  301,  299,
+ /*    30 */   300,   26,  303,   78,  272,  397,   69,  108,    2,  275,
+ /*    40 */    25,   33,   46,   78,  122,    5,  396,   80,   20,  305,
+ /*    50 */   306,  308,  309,  310,   95,  397,   67,   80,   20,  303,
+ /*    60 */   397,   67,    7,    9,  121,  302,  396,  100,   22,  303,
+ /*    70 */   384,  396,  397,   31,  120,  385,  305,  306,  308,  309,
+ /*    80 */   310,  265,   54,  396,   92,   77,  305,  306,  308,  309,
+ /*    90 */   310,   19,   18,   17,   16,  297,  298,  301,  299,  300,
+ /*   100 */    78,   56,   24,   23,   50,   78,  224,   36,  364,   49,
+ /*   110 */    78,   27,  397,   30,   80,   20,   65,  110,   38,   80,
+ /*   120 */     8,  317,   61,  396,   73,    1,  303,  397,   67,   57,
+ /*   130 */   333,  303,   54,   48,  302,   85,  303,  101,  396,  344,
+ /*   140 */    96,  118,  385,  305,  306,  308,  309,  310,  305,  306,
+ /*   150 */   308,  309,  310,  305,  306,  308,  309,  310,   19,   18,
+ /*   160 */    17,   16,   19,   18,   17,   16,   26,  397,   72,  397,
+ /*   170 */    72,   19,   18,   17,   16,  397,   31,   51,  396,  275,
+ /*   180 */   396,   49,  100,   79,   54,   75,  396,  380,    1,  397,
+ /*   190 */    31,  111,  119,  397,   72,  397,   70,   54,   88,   47,
+ /*   200 */   396,   76,  321,   45,  396,  116,  396,  397,   71,   74,
+ /*   210 */   397,  393,   34,  397,  392,   57,  333,  346,  396,   86,
+ /*   220 */    54,  396,  397,   81,  396,  397,   82,  397,   68,   40,
+ /*   230 */    15,  102,   39,  396,   37,  364,  396,  346,  396,  117,
+ /*   240 */    91,  304,   15,  105,  103,   35,   35,   84,  290,  291,
+ /*   250 */   346,  346,    7,    9,  280,   17,   16,   15,  336,  307,
+ /*   260 */    24,  329,   25,  324,  125,  326,  124,  237,   44,   94,
+ /*   270 */    21,   54,  100,   98,   99,   77,  107,  365,  109,  106,
+ /*   280 */   113,  115,   26,  347,  375,  114,  334,  319,   58,   59,
+ /*   290 */    60,  123,    1,   10,  315,   62,   63,  296,    3,   64,
+ /*   300 */    83,    6,  225,  226,   87,   41,   89,    9,   29,  238,
+ /*   310 */    93,  121,   28,   14,  244,  249,  247,   11,  313,   52,
+ /*   320 */   242,  248,  246,  314,  240,  255,  253,  245,  243,  104,
+ /*   330 */    53,  241,   32,  239,   55,  259,  313,    4,  274,  287,
+ /*   340 */   313,  313,  281,  313,  313,  313,  313,  293,  295,
 };
 static const YYCODETYPE yy_lookahead[] = {
  /*     0 */    53,   54,   55,   91,   57,   58,    4,    5,   76,   77,
  /*    10 */    78,   64,   65,   66,   67,   68,   89,   70,   71,   72,
  /*    20 */    18,   19,    3,    4,    5,    6,    7,    8,    9,   10,
  /*    30 */    11,   13,   30,    4,    5,   78,   79,   83,   36,   20,
- /*    40 */    22,   19,   24,   78,   79,   18,   89,   18,   19,   47,
- /*    50 */    48,   49,   50,   51,   89,   78,   79,   92,   93,   30,
- /*    60 */     3,    4,    5,    6,   83,   46,   89,   86,   87,   92,
- /*    70 */    93,   83,    1,    2,   86,   87,   47,   48,   49,   50,
- /*    80 */    51,    3,    4,    5,    6,    7,    8,    9,   10,   11,
- /*    90 */     4,   20,   12,   13,   37,    4,   16,   77,   78,   17,
- /*   100 */     4,   21,   78,   79,   18,   19,   57,   17,   18,   18,
- /*   110 */    19,   62,   63,   89,   32,   35,   30,   93,   75,   70,
- /*   120 */    71,   30,   32,   80,   46,   45,   30,   75,    3,    4,
- /*   130 */     5,    6,   80,   47,   48,   49,   50,   51,   47,   48,
- /*   140 */    49,   50,   51,   47,   48,   49,   50,   51,    3,    4,
- /*   150 */     5,    6,   17,   18,    4,   78,   79,   78,   79,   78,
- /*   160 */    79,   78,   79,   78,   79,   20,   89,   32,   89,   90,
- /*   170 */    89,   94,   89,   90,   89,   90,   26,    1,    2,   78,
- /*   180 */    79,   78,   79,   78,   79,   30,    5,   69,   23,   81,
- /*   190 */    89,   90,   89,   75,   89,   57,   58,   94,   80,   94,
- /*   200 */    78,   79,   13,   48,   78,   79,   41,   42,   70,   71,
- /*   210 */    29,   89,   78,   79,   19,   89,   85,   78,   79,   78,
- /*   220 */    79,   78,   79,   89,   35,   69,   29,   17,   89,   32,
- /*   230 */    89,   75,   89,   38,   23,   83,   80,   30,   31,   28,
- /*   240 */    20,   83,   32,   23,    5,    6,   19,   74,   17,   12,
- /*   250 */    73,   68,   22,   63,   61,   27,   44,   43,   60,   18,
- /*   260 */    82,   32,   17,   84,    5,   83,   18,   87,   83,   85,
- /*   270 */    84,   13,   80,   71,   83,   88,   88,   61,   60,   39,
- /*   280 */    59,   35,   58,   61,   58,   60,   34,   18,   37,   56,
- /*   290 */    27,   59,   18,   20,   18,   15,   14,    2,   23,   18,
- /*   300 */    23,    7,   38,    4,   18,   33,   23,   28,   30,    0,
- /*   310 */    18,   20,   28,   28,   25,   18,   20,   30,   28,   31,
- /*   320 */    20,   23,   17,   20,   23,   18,   18,   95,   95,   95,
- /*   330 */    95,   95,   30,   40,   30,   95,   95,   95,   95,   95,
- /*   340 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+ /*    40 */    22,   19,   24,    4,    5,   19,   89,   18,   19,   47,
+ /*    50 */    48,   49,   50,   51,   18,   78,   79,   18,   19,   30,
+ /*    60 */    78,   79,    1,    2,   38,   46,   89,   17,   18,   30,
+ /*    70 */    93,   89,   78,   79,   92,   93,   47,   48,   49,   50,
+ /*    80 */    51,   20,   32,   89,   90,    5,   47,   48,   49,   50,
+ /*    90 */    51,    3,    4,    5,    6,    7,    8,    9,   10,   11,
+ /*   100 */     4,   81,   12,   13,   83,    4,   16,   86,   87,   29,
+ /*   110 */     4,   21,   78,   79,   18,   19,   57,   17,   18,   18,
+ /*   120 */    19,   62,   63,   89,   90,   35,   30,   78,   79,   70,
+ /*   130 */    71,   30,   32,   85,   46,   45,   30,   83,   89,   77,
+ /*   140 */    78,   92,   93,   47,   48,   49,   50,   51,   47,   48,
+ /*   150 */    49,   50,   51,   47,   48,   49,   50,   51,    3,    4,
+ /*   160 */     5,    6,    3,    4,    5,    6,   13,   78,   79,   78,
+ /*   170 */    79,    3,    4,    5,    6,   78,   79,    4,   89,   20,
+ /*   180 */    89,   29,   17,   94,   32,   94,   89,   90,   35,   78,
+ /*   190 */    79,   83,   37,   78,   79,   78,   79,   32,   19,   26,
+ /*   200 */    89,   90,   57,   58,   89,   17,   89,   78,   79,   94,
+ /*   210 */    78,   79,   75,   78,   79,   70,   71,   80,   89,   17,
+ /*   220 */    32,   89,   78,   79,   89,   78,   79,   78,   79,   73,
+ /*   230 */    23,   83,   75,   89,   86,   87,   89,   80,   89,   69,
+ /*   240 */    69,   30,   23,   30,   31,   75,   75,   28,   41,   42,
+ /*   250 */    80,   80,    1,    2,   20,    5,    6,   23,   74,   48,
+ /*   260 */    12,   68,   22,   63,   44,   61,   43,   18,   60,   82,
+ /*   270 */    27,   32,   17,   84,   83,    5,   84,   87,   83,   85,
+ /*   280 */    18,   83,   13,   80,   88,   88,   71,   61,   60,   59,
+ /*   290 */    58,   39,   35,   34,   61,   60,   59,   18,   56,   58,
+ /*   300 */    37,   27,   18,   20,   18,   15,   14,    2,   23,   18,
+ /*   310 */    23,   38,   23,    7,    4,   18,   28,   40,   95,   18,
+ /*   320 */    20,   28,   28,    0,   20,   30,   30,   28,   25,   31,
+ /*   330 */    23,   20,   17,   20,   18,   33,   95,   23,   18,   18,
+ /*   340 */    95,   95,   20,   95,   95,   95,   95,   30,   30,   95,
  /*   350 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
  /*   360 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
  /*   370 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
- /*   380 */    95,   95,   95,   95,   95,   95,   95,
+ /*   380 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+ /*   390 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+ /*   400 */    95,
 };
-#define YY_SHIFT_COUNT    (125)
+#define YY_SHIFT_COUNT    (126)
 #define YY_SHIFT_MIN      (0)
-#define YY_SHIFT_MAX      (309)
+#define YY_SHIFT_MAX      (323)
 static const unsigned short int yy_shift_ofst[] = {
- /*     0 */    80,    2,   29,   18,   29,   86,   91,   91,   91,   91,
- /*    10 */    86,   86,  189,   86,   86,   86,   86,   86,   86,   86,
- /*    20 */    86,   90,   82,   22,   22,   27,   22,   22,   27,   22,
- /*    30 */    19,   78,   96,  135,  150,  150,  181,  197,  210,  150,
- /*    40 */   227,  231,  237,  230,  212,  214,  241,  228,  229,  245,
- /*    50 */   259,  228,  229,  248,  248,  229,   22,  258,  212,  214,
- /*    60 */   240,  246,  212,  214,  240,  246,  252,   57,  145,  125,
- /*    70 */   125,  125,  125,   71,  165,  211,  176,  207,  155,  220,
- /*    80 */   195,  239,  239,  269,  251,  263,  274,  273,  276,  280,
- /*    90 */   282,  275,  295,  281,  277,  264,  294,  283,  299,  279,
- /*   100 */   286,  284,  285,  278,  287,  288,  290,  289,  291,  296,
- /*   110 */   292,  300,  298,  305,  272,  303,  297,  275,  301,  307,
- /*   120 */   301,  308,  293,  302,  304,  309,
+ /*     0 */    90,    2,   29,   18,   29,   39,   96,  101,  101,  101,
+ /*    10 */   101,   96,  153,   96,   96,   96,   96,   96,   96,   96,
+ /*    20 */    96,   50,  165,   22,   22,   36,   22,   22,   36,   22,
+ /*    30 */    19,   88,  106,  100,  173,  173,   80,  152,  188,  173,
+ /*    40 */   179,  202,  248,  240,  220,  223,  249,  243,  239,  255,
+ /*    50 */   270,  243,  239,  262,  262,  239,   22,  269,  220,  223,
+ /*    60 */   252,  257,  220,  223,  252,  257,  259,  155,  159,  168,
+ /*    70 */   168,  168,  168,   61,  207,  219,  251,  213,  211,  234,
+ /*    80 */    26,  250,  250,  279,  263,  274,  284,  283,  286,  290,
+ /*    90 */   292,  285,  305,  291,  287,  273,  306,  289,  310,  288,
+ /*   100 */   297,  293,  294,  295,  296,  298,  299,  303,  300,  304,
+ /*   110 */   301,  311,  307,  315,  302,  313,  316,  285,  314,  320,
+ /*   120 */   314,  321,  322,  277,  317,  318,  323,
 };
 #define YY_REDUCE_COUNT (66)
 #define YY_REDUCE_MIN   (-88)
-#define YY_REDUCE_MAX   (233)
+#define YY_REDUCE_MAX   (242)
 static const short yy_reduce_ofst[] = {
- /*     0 */   -53,  -35,  -23,   49,   24,   77,   79,   83,   85,  101,
- /*    10 */   103,  105,  138,  -43,   81,  122,  126,  134,  139,  141,
- /*    20 */   143,  -19,  -12,  118,  156,  -68,  118,   43,   20,   52,
- /*    30 */   -88,  -88,  -73,  -46,  108,  108,  131,  152,  158,  108,
- /*    40 */   173,  177,  183,  190,  193,  198,  178,  179,  182,  180,
- /*    50 */   184,  186,  185,  187,  188,  191,  192,  202,  216,  218,
- /*    60 */   221,  224,  222,  225,  232,  226,  233,
+ /*     0 */   -53,  -18,   49,   59,  -23,   89,   91,   -6,   34,   97,
+ /*    10 */   111,  115,  145,  -43,  117,  129,  132,  135,  144,  147,
+ /*    20 */   149,   21,  148,  170,  171,  -68,  170,  137,   62,  157,
+ /*    30 */   -88,  -88,  -73,  -46,   20,   20,   48,   54,  108,   20,
+ /*    40 */   184,  156,  193,  200,  204,  208,  187,  189,  191,  190,
+ /*    50 */   194,  192,  195,  196,  197,  198,  203,  215,  226,  228,
+ /*    60 */   230,  232,  233,  235,  237,  241,  242,
 };
 static const YYACTIONTYPE yy_default[] = {
- /*     0 */   328,  308,  308,  328,  308,  308,  308,  308,  308,  308,
- /*    10 */   308,  308,  328,  308,  308,  308,  308,  308,  308,  308,
- /*    20 */   308,  369,  369,  334,  308,  308,  308,  308,  308,  308,
- /*    30 */   308,  308,  308,  369,  338,  345,  363,  369,  369,  346,
- /*    40 */   308,  308,  324,  320,  404,  402,  308,  308,  369,  308,
- /*    50 */   363,  308,  369,  308,  308,  369,  308,  329,  404,  402,
- /*    60 */   398,  315,  404,  402,  398,  313,  373,  384,  308,  375,
- /*    70 */   342,  394,  395,  308,  399,  308,  374,  368,  308,  308,
- /*    80 */   396,  388,  387,  308,  308,  308,  308,  308,  308,  308,
- /*    90 */   308,  327,  378,  308,  347,  396,  308,  339,  308,  308,
- /*   100 */   308,  308,  308,  308,  365,  367,  308,  308,  308,  308,
- /*   110 */   308,  308,  371,  308,  308,  308,  308,  332,  380,  308,
- /*   120 */   379,  308,  308,  308,  308,  308,
+ /*     0 */   331,  311,  311,  331,  311,  311,  311,  311,  311,  311,
+ /*    10 */   311,  311,  331,  311,  311,  311,  311,  311,  311,  311,
+ /*    20 */   311,  372,  372,  337,  311,  311,  311,  311,  311,  311,
+ /*    30 */   311,  311,  311,  372,  341,  348,  366,  372,  372,  349,
+ /*    40 */   311,  311,  327,  323,  408,  406,  311,  311,  372,  311,
+ /*    50 */   366,  311,  372,  311,  311,  372,  311,  332,  408,  406,
+ /*    60 */   402,  318,  408,  406,  402,  316,  376,  387,  311,  378,
+ /*    70 */   345,  398,  399,  311,  403,  311,  377,  371,  311,  311,
+ /*    80 */   400,  391,  390,  311,  311,  311,  311,  311,  311,  311,
+ /*    90 */   311,  330,  381,  311,  350,  400,  311,  342,  311,  311,
+ /*   100 */   311,  311,  311,  311,  368,  370,  311,  311,  311,  311,
+ /*   110 */   311,  311,  374,  311,  311,  311,  311,  335,  383,  311,
+ /*   120 */   382,  311,  311,  311,  311,  311,  311,
 };
 /********** End of lemon-generated parsing tables *****************************/
 
@@ -636,35 +640,36 @@ static const char *const yyRuleName[] = {
  /*  78 */ "arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression",
  /*  79 */ "arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression",
  /*  80 */ "arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS",
- /*  81 */ "arithmetic_expression ::= value",
- /*  82 */ "arithmetic_expression ::= variable",
- /*  83 */ "arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression",
- /*  84 */ "arithmetic_expression_list ::= arithmetic_expression",
- /*  85 */ "variable ::= UQSTRING",
- /*  86 */ "variable ::= UQSTRING DOT UQSTRING",
- /*  87 */ "orderClause ::=",
- /*  88 */ "orderClause ::= ORDER BY arithmetic_expression_list",
- /*  89 */ "orderClause ::= ORDER BY arithmetic_expression_list ASC",
- /*  90 */ "orderClause ::= ORDER BY arithmetic_expression_list DESC",
- /*  91 */ "skipClause ::=",
- /*  92 */ "skipClause ::= SKIP INTEGER",
- /*  93 */ "limitClause ::=",
- /*  94 */ "limitClause ::= LIMIT INTEGER",
- /*  95 */ "unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING",
- /*  96 */ "relation ::= EQ",
- /*  97 */ "relation ::= GT",
- /*  98 */ "relation ::= LT",
- /*  99 */ "relation ::= LE",
- /* 100 */ "relation ::= GE",
- /* 101 */ "relation ::= NE",
- /* 102 */ "value ::= INTEGER",
- /* 103 */ "value ::= DASH INTEGER",
- /* 104 */ "value ::= STRING",
- /* 105 */ "value ::= FLOAT",
- /* 106 */ "value ::= DASH FLOAT",
- /* 107 */ "value ::= TRUE",
- /* 108 */ "value ::= FALSE",
- /* 109 */ "value ::= NULLVAL",
+ /*  81 */ "arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS MUL RIGHT_PARENTHESIS",
+ /*  82 */ "arithmetic_expression ::= value",
+ /*  83 */ "arithmetic_expression ::= variable",
+ /*  84 */ "arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression",
+ /*  85 */ "arithmetic_expression_list ::= arithmetic_expression",
+ /*  86 */ "variable ::= UQSTRING",
+ /*  87 */ "variable ::= UQSTRING DOT UQSTRING",
+ /*  88 */ "orderClause ::=",
+ /*  89 */ "orderClause ::= ORDER BY arithmetic_expression_list",
+ /*  90 */ "orderClause ::= ORDER BY arithmetic_expression_list ASC",
+ /*  91 */ "orderClause ::= ORDER BY arithmetic_expression_list DESC",
+ /*  92 */ "skipClause ::=",
+ /*  93 */ "skipClause ::= SKIP INTEGER",
+ /*  94 */ "limitClause ::=",
+ /*  95 */ "limitClause ::= LIMIT INTEGER",
+ /*  96 */ "unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING",
+ /*  97 */ "relation ::= EQ",
+ /*  98 */ "relation ::= GT",
+ /*  99 */ "relation ::= LT",
+ /* 100 */ "relation ::= LE",
+ /* 101 */ "relation ::= GE",
+ /* 102 */ "relation ::= NE",
+ /* 103 */ "value ::= INTEGER",
+ /* 104 */ "value ::= DASH INTEGER",
+ /* 105 */ "value ::= STRING",
+ /* 106 */ "value ::= FLOAT",
+ /* 107 */ "value ::= DASH FLOAT",
+ /* 108 */ "value ::= TRUE",
+ /* 109 */ "value ::= FALSE",
+ /* 110 */ "value ::= NULLVAL",
 };
 #endif /* NDEBUG */
 
@@ -787,9 +792,9 @@ static void yy_destructor(
 /********* Begin destructor definitions ***************************************/
     case 90: /* cond */
 {
-#line 393 "grammar.y"
+#line 398 "grammar.y"
  Free_AST_FilterNode((yypminor->yy86)); 
-#line 793 "grammar.c"
+#line 798 "grammar.c"
 }
       break;
 /********* End destructor definitions *****************************************/
@@ -1165,35 +1170,36 @@ static const struct {
   {   79,   -3 }, /* (78) arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
   {   79,   -3 }, /* (79) arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
   {   79,   -4 }, /* (80) arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
-  {   79,   -1 }, /* (81) arithmetic_expression ::= value */
-  {   79,   -1 }, /* (82) arithmetic_expression ::= variable */
-  {   94,   -3 }, /* (83) arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
-  {   94,   -1 }, /* (84) arithmetic_expression_list ::= arithmetic_expression */
-  {   78,   -1 }, /* (85) variable ::= UQSTRING */
-  {   78,   -3 }, /* (86) variable ::= UQSTRING DOT UQSTRING */
-  {   59,    0 }, /* (87) orderClause ::= */
-  {   59,   -3 }, /* (88) orderClause ::= ORDER BY arithmetic_expression_list */
-  {   59,   -4 }, /* (89) orderClause ::= ORDER BY arithmetic_expression_list ASC */
-  {   59,   -4 }, /* (90) orderClause ::= ORDER BY arithmetic_expression_list DESC */
-  {   60,    0 }, /* (91) skipClause ::= */
-  {   60,   -2 }, /* (92) skipClause ::= SKIP INTEGER */
-  {   61,    0 }, /* (93) limitClause ::= */
-  {   61,   -2 }, /* (94) limitClause ::= LIMIT INTEGER */
-  {   64,   -6 }, /* (95) unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING */
-  {   91,   -1 }, /* (96) relation ::= EQ */
-  {   91,   -1 }, /* (97) relation ::= GT */
-  {   91,   -1 }, /* (98) relation ::= LT */
-  {   91,   -1 }, /* (99) relation ::= LE */
-  {   91,   -1 }, /* (100) relation ::= GE */
-  {   91,   -1 }, /* (101) relation ::= NE */
-  {   89,   -1 }, /* (102) value ::= INTEGER */
-  {   89,   -2 }, /* (103) value ::= DASH INTEGER */
-  {   89,   -1 }, /* (104) value ::= STRING */
-  {   89,   -1 }, /* (105) value ::= FLOAT */
-  {   89,   -2 }, /* (106) value ::= DASH FLOAT */
-  {   89,   -1 }, /* (107) value ::= TRUE */
-  {   89,   -1 }, /* (108) value ::= FALSE */
-  {   89,   -1 }, /* (109) value ::= NULLVAL */
+  {   79,   -4 }, /* (81) arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS MUL RIGHT_PARENTHESIS */
+  {   79,   -1 }, /* (82) arithmetic_expression ::= value */
+  {   79,   -1 }, /* (83) arithmetic_expression ::= variable */
+  {   94,   -3 }, /* (84) arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
+  {   94,   -1 }, /* (85) arithmetic_expression_list ::= arithmetic_expression */
+  {   78,   -1 }, /* (86) variable ::= UQSTRING */
+  {   78,   -3 }, /* (87) variable ::= UQSTRING DOT UQSTRING */
+  {   59,    0 }, /* (88) orderClause ::= */
+  {   59,   -3 }, /* (89) orderClause ::= ORDER BY arithmetic_expression_list */
+  {   59,   -4 }, /* (90) orderClause ::= ORDER BY arithmetic_expression_list ASC */
+  {   59,   -4 }, /* (91) orderClause ::= ORDER BY arithmetic_expression_list DESC */
+  {   60,    0 }, /* (92) skipClause ::= */
+  {   60,   -2 }, /* (93) skipClause ::= SKIP INTEGER */
+  {   61,    0 }, /* (94) limitClause ::= */
+  {   61,   -2 }, /* (95) limitClause ::= LIMIT INTEGER */
+  {   64,   -6 }, /* (96) unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING */
+  {   91,   -1 }, /* (97) relation ::= EQ */
+  {   91,   -1 }, /* (98) relation ::= GT */
+  {   91,   -1 }, /* (99) relation ::= LT */
+  {   91,   -1 }, /* (100) relation ::= LE */
+  {   91,   -1 }, /* (101) relation ::= GE */
+  {   91,   -1 }, /* (102) relation ::= NE */
+  {   89,   -1 }, /* (103) value ::= INTEGER */
+  {   89,   -2 }, /* (104) value ::= DASH INTEGER */
+  {   89,   -1 }, /* (105) value ::= STRING */
+  {   89,   -1 }, /* (106) value ::= FLOAT */
+  {   89,   -2 }, /* (107) value ::= DASH FLOAT */
+  {   89,   -1 }, /* (108) value ::= TRUE */
+  {   89,   -1 }, /* (109) value ::= FALSE */
+  {   89,   -1 }, /* (110) value ::= NULLVAL */
 };
 
 static void yy_accept(yyParser*);  /* Forward Declaration */
@@ -1274,448 +1280,452 @@ static void yy_reduce(
 /********** Begin reduce actions **********************************************/
         YYMINORTYPE yylhsminor;
       case 0: /* query ::= expr */
-#line 45 "grammar.y"
-{ ctx->root = yymsp[0].minor.yy67; }
-#line 1280 "grammar.c"
+#line 46 "grammar.y"
+{
+	// Discard query rejected while being reduced.
+	if(ctx->ok) ctx->root = yymsp[0].minor.yy67;
+	else AST_Free(yymsp[0].minor.yy67);
+}
+#line 1290 "grammar.c"
         break;
       case 1: /* expr ::= multipleMatchClause whereClause multipleCreateClause returnClause orderClause skipClause limitClause */
-#line 47 "grammar.y"
+#line 52 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(yymsp[-6].minor.yy155, yymsp[-5].minor.yy181, yymsp[-4].minor.yy96, NULL, NULL, NULL, yymsp[-3].minor.yy188, yymsp[-2].minor.yy28, yymsp[-1].minor.yy173, yymsp[0].minor.yy77, NULL, NULL);
 }
-#line 1287 "grammar.c"
+#line 1297 "grammar.c"
   yymsp[-6].minor.yy67 = yylhsminor.yy67;
         break;
       case 2: /* expr ::= multipleMatchClause whereClause multipleCreateClause */
-#line 51 "grammar.y"
+#line 56 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(yymsp[-2].minor.yy155, yymsp[-1].minor.yy181, yymsp[0].minor.yy96, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1295 "grammar.c"
+#line 1305 "grammar.c"
   yymsp[-2].minor.yy67 = yylhsminor.yy67;
         break;
       case 3: /* expr ::= multipleMatchClause whereClause deleteClause */
-#line 55 "grammar.y"
+#line 60 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(yymsp[-2].minor.yy155, yymsp[-1].minor.yy181, NULL, NULL, NULL, yymsp[0].minor.yy115, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1303 "grammar.c"
+#line 1313 "grammar.c"
   yymsp[-2].minor.yy67 = yylhsminor.yy67;
         break;
       case 4: /* expr ::= multipleMatchClause whereClause setClause */
-#line 59 "grammar.y"
+#line 64 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(yymsp[-2].minor.yy155, yymsp[-1].minor.yy181, NULL, NULL, yymsp[0].minor.yy130, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1311 "grammar.c"
+#line 1321 "grammar.c"
   yymsp[-2].minor.yy67 = yylhsminor.yy67;
         break;
       case 5: /* expr ::= multipleMatchClause whereClause setClause returnClause orderClause skipClause limitClause */
-#line 63 "grammar.y"
+#line 68 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(yymsp[-6].minor.yy155, yymsp[-5].minor.yy181, NULL, NULL, yymsp[-4].minor.yy130, NULL, yymsp[-3].minor.yy188, yymsp[-2].minor.yy28, yymsp[-1].minor.yy173, yymsp[0].minor.yy77, NULL, NULL);
 }
-#line 1319 "grammar.c"
+#line 1329 "grammar.c"
   yymsp[-6].minor.yy67 = yylhsminor.yy67;
         break;
       case 6: /* expr ::= multipleCreateClause */
-#line 67 "grammar.y"
+#line 72 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(NULL, NULL, yymsp[0].minor.yy96, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1327 "grammar.c"
+#line 1337 "grammar.c"
   yymsp[0].minor.yy67 = yylhsminor.yy67;
         break;
       case 7: /* expr ::= unwindClause multipleCreateClause */
-#line 71 "grammar.y"
+#line 76 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(NULL, NULL, yymsp[0].minor.yy96, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy137);
 }
-#line 1335 "grammar.c"
+#line 1345 "grammar.c"
   yymsp[-1].minor.yy67 = yylhsminor.yy67;
         break;
       case 8: /* expr ::= indexClause */
-#line 75 "grammar.y"
+#line 80 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy74, NULL);
 }
-#line 1343 "grammar.c"
+#line 1353 "grammar.c"
   yymsp[0].minor.yy67 = yylhsminor.yy67;
         break;
       case 9: /* expr ::= mergeClause */
-#line 79 "grammar.y"
+#line 84 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(NULL, NULL, NULL, yymsp[0].minor.yy10, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1351 "grammar.c"
+#line 1361 "grammar.c"
   yymsp[0].minor.yy67 = yylhsminor.yy67;
         break;
       case 10: /* expr ::= mergeClause setClause */
-#line 83 "grammar.y"
+#line 88 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(NULL, NULL, NULL, yymsp[-1].minor.yy10, yymsp[0].minor.yy130, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1359 "grammar.c"
+#line 1369 "grammar.c"
   yymsp[-1].minor.yy67 = yylhsminor.yy67;
         break;
       case 11: /* expr ::= returnClause */
-#line 87 "grammar.y"
+#line 92 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy188, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1367 "grammar.c"
+#line 1377 "grammar.c"
   yymsp[0].minor.yy67 = yylhsminor.yy67;
         break;
       case 12: /* expr ::= unwindClause returnClause skipClause limitClause */
-#line 91 "grammar.y"
+#line 96 "grammar.y"
 {
 	yylhsminor.yy67 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-2].minor.yy188, NULL, yymsp[-1].minor.yy173, yymsp[0].minor.yy77, NULL, yymsp[-3].minor.yy137);
 }
-#line 1375 "grammar.c"
+#line 1385 "grammar.c"
   yymsp[-3].minor.yy67 = yylhsminor.yy67;
         break;
       case 13: /* multipleMatchClause ::= matchClauses */
-#line 96 "grammar.y"
+#line 101 "grammar.y"
 {
 	yylhsminor.yy155 = New_AST_MatchNode(yymsp[0].minor.yy116);
 }
-#line 1383 "grammar.c"
+#line 1393 "grammar.c"
   yymsp[0].minor.yy155 = yylhsminor.yy155;
         break;
       case 14: /* matchClauses ::= matchClause */
       case 19: /* createClauses ::= createClause */ yytestcase(yyruleno==19);
-#line 102 "grammar.y"
+#line 107 "grammar.y"
 {
 	yylhsminor.yy116 = yymsp[0].minor.yy116;
 }
-#line 1392 "grammar.c"
+#line 1402 "grammar.c"
   yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
       case 15: /* matchClauses ::= matchClauses matchClause */
       case 20: /* createClauses ::= createClauses createClause */ yytestcase(yyruleno==20);
-#line 106 "grammar.y"
+#line 111 "grammar.y"
 {
 	Vector *v;
 	while(Vector_Pop(yymsp[0].minor.yy116, &v)) Vector_Push(yymsp[-1].minor.yy116, v);
 	Vector_Free(yymsp[0].minor.yy116);
 	yylhsminor.yy116 = yymsp[-1].minor.yy116;
 }
-#line 1404 "grammar.c"
+#line 1414 "grammar.c"
   yymsp[-1].minor.yy116 = yylhsminor.yy116;
         break;
       case 16: /* matchClause ::= MATCH chains */
       case 21: /* createClause ::= CREATE chains */ yytestcase(yyruleno==21);
-#line 115 "grammar.y"
+#line 120 "grammar.y"
 {
 	yymsp[-1].minor.yy116 = yymsp[0].minor.yy116;
 }
-#line 1413 "grammar.c"
+#line 1423 "grammar.c"
         break;
       case 17: /* multipleCreateClause ::= */
-#line 120 "grammar.y"
+#line 125 "grammar.y"
 {
 	yymsp[1].minor.yy96 = NULL;
 }
-#line 1420 "grammar.c"
+#line 1430 "grammar.c"
         break;
       case 18: /* multipleCreateClause ::= createClauses */
-#line 124 "grammar.y"
+#line 129 "grammar.y"
 {
 	yylhsminor.yy96 = New_AST_CreateNode(yymsp[0].minor.yy116);
 }
-#line 1427 "grammar.c"
+#line 1437 "grammar.c"
   yymsp[0].minor.yy96 = yylhsminor.yy96;
         break;
       case 22: /* indexClause ::= indexOpToken INDEX ON indexLabel indexProp */
-#line 150 "grammar.y"
+#line 155 "grammar.y"
 {
   yylhsminor.yy74 = New_AST_IndexNode(yymsp[-1].minor.yy0.strval, yymsp[0].minor.yy0.strval, yymsp[-4].minor.yy105);
 }
-#line 1435 "grammar.c"
+#line 1445 "grammar.c"
   yymsp[-4].minor.yy74 = yylhsminor.yy74;
         break;
       case 23: /* indexOpToken ::= CREATE */
-#line 156 "grammar.y"
+#line 161 "grammar.y"
 { yymsp[0].minor.yy105 = CREATE_INDEX; }
-#line 1441 "grammar.c"
+#line 1451 "grammar.c"
         break;
       case 24: /* indexOpToken ::= DROP */
-#line 157 "grammar.y"
+#line 162 "grammar.y"
 { yymsp[0].minor.yy105 = DROP_INDEX; }
-#line 1446 "grammar.c"
+#line 1456 "grammar.c"
         break;
       case 25: /* indexLabel ::= COLON UQSTRING */
-#line 159 "grammar.y"
+#line 164 "grammar.y"
 {
   yymsp[-1].minor.yy0 = yymsp[0].minor.yy0;
 }
-#line 1453 "grammar.c"
+#line 1463 "grammar.c"
         break;
       case 26: /* indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS */
-#line 163 "grammar.y"
+#line 168 "grammar.y"
 {
   yymsp[-2].minor.yy0 = yymsp[-1].minor.yy0;
 }
-#line 1460 "grammar.c"
+#line 1470 "grammar.c"
         break;
       case 27: /* mergeClause ::= MERGE chain */
-#line 169 "grammar.y"
+#line 174 "grammar.y"
 {
 	yymsp[-1].minor.yy10 = New_AST_MergeNode(yymsp[0].minor.yy116);
 }
-#line 1467 "grammar.c"
+#line 1477 "grammar.c"
         break;
       case 28: /* setClause ::= SET setList */
-#line 174 "grammar.y"
+#line 179 "grammar.y"
 {
 	yymsp[-1].minor.yy130 = New_AST_SetNode(yymsp[0].minor.yy116);
 }
-#line 1474 "grammar.c"
+#line 1484 "grammar.c"
         break;
       case 29: /* setList ::= setElement */
-#line 179 "grammar.y"
+#line 184 "grammar.y"
 {
 	yylhsminor.yy116 = NewVector(AST_SetElement*, 1);
 	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy124);
 }
-#line 1482 "grammar.c"
+#line 1492 "grammar.c"
   yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
       case 30: /* setList ::= setList COMMA setElement */
-#line 183 "grammar.y"
+#line 188 "grammar.y"
 {
 	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy124);
 	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1491 "grammar.c"
+#line 1501 "grammar.c"
   yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
       case 31: /* setElement ::= variable EQ arithmetic_expression */
-#line 189 "grammar.y"
+#line 194 "grammar.y"
 {
 	yylhsminor.yy124 = New_AST_SetElement(yymsp[-2].minor.yy120, yymsp[0].minor.yy154);
 }
-#line 1499 "grammar.c"
+#line 1509 "grammar.c"
   yymsp[-2].minor.yy124 = yylhsminor.yy124;
         break;
       case 32: /* chain ::= node */
-#line 195 "grammar.y"
+#line 200 "grammar.y"
 {
 	yylhsminor.yy116 = NewVector(AST_GraphEntity*, 1);
 	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy89);
 }
-#line 1508 "grammar.c"
+#line 1518 "grammar.c"
   yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
       case 33: /* chain ::= chain link node */
-#line 200 "grammar.y"
+#line 205 "grammar.y"
 {
 	Vector_Push(yymsp[-2].minor.yy116, yymsp[-1].minor.yy35);
 	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy89);
 	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1518 "grammar.c"
+#line 1528 "grammar.c"
   yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
       case 34: /* chains ::= chain */
-#line 208 "grammar.y"
+#line 213 "grammar.y"
 {
 	yylhsminor.yy116 = NewVector(Vector*, 1);
 	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy116);
 }
-#line 1527 "grammar.c"
+#line 1537 "grammar.c"
   yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
       case 35: /* chains ::= chains COMMA chain */
-#line 213 "grammar.y"
+#line 218 "grammar.y"
 {
 	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy116);
 	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1536 "grammar.c"
+#line 1546 "grammar.c"
   yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
       case 36: /* deleteClause ::= DELETE deleteExpression */
-#line 221 "grammar.y"
+#line 226 "grammar.y"
 {
 	yymsp[-1].minor.yy115 = New_AST_DeleteNode(yymsp[0].minor.yy116);
 }
-#line 1544 "grammar.c"
+#line 1554 "grammar.c"
         break;
       case 37: /* deleteExpression ::= UQSTRING */
-#line 227 "grammar.y"
+#line 232 "grammar.y"
 {
 	yylhsminor.yy116 = NewVector(char*, 1);
 	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy0.strval);
 }
-#line 1552 "grammar.c"
+#line 1562 "grammar.c"
   yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
       case 38: /* deleteExpression ::= deleteExpression COMMA UQSTRING */
-#line 232 "grammar.y"
+#line 237 "grammar.y"
 {
 	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy0.strval);
 	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1561 "grammar.c"
+#line 1571 "grammar.c"
   yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
       case 39: /* node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
-#line 240 "grammar.y"
+#line 245 "grammar.y"
 {
 	yymsp[-5].minor.yy89 = New_AST_NodeEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy116);
 }
-#line 1569 "grammar.c"
+#line 1579 "grammar.c"
         break;
       case 40: /* node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
-#line 245 "grammar.y"
+#line 250 "grammar.y"
 {
 	yymsp[-4].minor.yy89 = New_AST_NodeEntity(NULL, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy116);
 }
-#line 1576 "grammar.c"
+#line 1586 "grammar.c"
         break;
       case 41: /* node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
-#line 250 "grammar.y"
+#line 255 "grammar.y"
 {
 	yymsp[-3].minor.yy89 = New_AST_NodeEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy116);
 }
-#line 1583 "grammar.c"
+#line 1593 "grammar.c"
         break;
       case 42: /* node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
-#line 255 "grammar.y"
+#line 260 "grammar.y"
 {
 	yymsp[-2].minor.yy89 = New_AST_NodeEntity(NULL, NULL, yymsp[-1].minor.yy116);
 }
-#line 1590 "grammar.c"
+#line 1600 "grammar.c"
         break;
       case 43: /* link ::= DASH edge RIGHT_ARROW */
-#line 262 "grammar.y"
+#line 267 "grammar.y"
 {
 	yymsp[-2].minor.yy35 = yymsp[-1].minor.yy35;
 	yymsp[-2].minor.yy35->direction = N_LEFT_TO_RIGHT;
 }
-#line 1598 "grammar.c"
+#line 1608 "grammar.c"
         break;
       case 44: /* link ::= LEFT_ARROW edge DASH */
-#line 268 "grammar.y"
+#line 273 "grammar.y"
 {
 	yymsp[-2].minor.yy35 = yymsp[-1].minor.yy35;
 	yymsp[-2].minor.yy35->direction = N_RIGHT_TO_LEFT;
 }
-#line 1606 "grammar.c"
+#line 1616 "grammar.c"
         break;
       case 45: /* edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
-#line 275 "grammar.y"
+#line 280 "grammar.y"
 { 
 	yymsp[-3].minor.yy35 = New_AST_LinkEntity(NULL, NULL, yymsp[-2].minor.yy116, N_DIR_UNKNOWN, yymsp[-1].minor.yy140);
 }
-#line 1613 "grammar.c"
+#line 1623 "grammar.c"
         break;
       case 46: /* edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
-#line 280 "grammar.y"
+#line 285 "grammar.y"
 { 
 	yymsp[-3].minor.yy35 = New_AST_LinkEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy116, N_DIR_UNKNOWN, NULL);
 }
-#line 1620 "grammar.c"
+#line 1630 "grammar.c"
         break;
       case 47: /* edge ::= LEFT_BRACKET edgeLabels edgeLength properties RIGHT_BRACKET */
-#line 285 "grammar.y"
+#line 290 "grammar.y"
 { 
 	yymsp[-4].minor.yy35 = New_AST_LinkEntity(NULL, yymsp[-3].minor.yy83, yymsp[-1].minor.yy116, N_DIR_UNKNOWN, yymsp[-2].minor.yy140);
 }
-#line 1627 "grammar.c"
+#line 1637 "grammar.c"
         break;
       case 48: /* edge ::= LEFT_BRACKET UQSTRING edgeLabels properties RIGHT_BRACKET */
-#line 290 "grammar.y"
+#line 295 "grammar.y"
 { 
 	yymsp[-4].minor.yy35 = New_AST_LinkEntity(yymsp[-3].minor.yy0.strval, yymsp[-2].minor.yy83, yymsp[-1].minor.yy116, N_DIR_UNKNOWN, NULL);
 }
-#line 1634 "grammar.c"
+#line 1644 "grammar.c"
         break;
       case 49: /* edgeLabel ::= COLON UQSTRING */
-#line 297 "grammar.y"
+#line 302 "grammar.y"
 {
 	yymsp[-1].minor.yy106 = yymsp[0].minor.yy0.strval;
 }
-#line 1641 "grammar.c"
+#line 1651 "grammar.c"
         break;
       case 50: /* edgeLabels ::= edgeLabel */
-#line 302 "grammar.y"
+#line 307 "grammar.y"
 {
 	yylhsminor.yy83 = array_new(char*, 1);
 	yylhsminor.yy83 = array_append(yylhsminor.yy83, yymsp[0].minor.yy106);
 }
-#line 1649 "grammar.c"
+#line 1659 "grammar.c"
   yymsp[0].minor.yy83 = yylhsminor.yy83;
         break;
       case 51: /* edgeLabels ::= edgeLabels PIPE edgeLabel */
-#line 308 "grammar.y"
+#line 313 "grammar.y"
 {
 	char *label = yymsp[0].minor.yy106;
 	yymsp[-2].minor.yy83 = array_append(yymsp[-2].minor.yy83, label);
 	yylhsminor.yy83 = yymsp[-2].minor.yy83;
 }
-#line 1659 "grammar.c"
+#line 1669 "grammar.c"
   yymsp[-2].minor.yy83 = yylhsminor.yy83;
         break;
       case 52: /* edgeLength ::= */
-#line 317 "grammar.y"
+#line 322 "grammar.y"
 {
 	yymsp[1].minor.yy140 = NULL;
 }
-#line 1667 "grammar.c"
+#line 1677 "grammar.c"
         break;
       case 53: /* edgeLength ::= MUL INTEGER DOTDOT INTEGER */
-#line 322 "grammar.y"
+#line 327 "grammar.y"
 {
 	yymsp[-3].minor.yy140 = New_AST_LinkLength(yymsp[-2].minor.yy0.intval, yymsp[0].minor.yy0.intval);
 }
-#line 1674 "grammar.c"
+#line 1684 "grammar.c"
         break;
       case 54: /* edgeLength ::= MUL INTEGER DOTDOT */
-#line 327 "grammar.y"
+#line 332 "grammar.y"
 {
 	yymsp[-2].minor.yy140 = New_AST_LinkLength(yymsp[-1].minor.yy0.intval, UINT_MAX-2);
 }
-#line 1681 "grammar.c"
+#line 1691 "grammar.c"
         break;
       case 55: /* edgeLength ::= MUL DOTDOT INTEGER */
-#line 332 "grammar.y"
+#line 337 "grammar.y"
 {
 	yymsp[-2].minor.yy140 = New_AST_LinkLength(1, yymsp[0].minor.yy0.intval);
 }
-#line 1688 "grammar.c"
+#line 1698 "grammar.c"
         break;
       case 56: /* edgeLength ::= MUL INTEGER */
-#line 337 "grammar.y"
+#line 342 "grammar.y"
 {
 	yymsp[-1].minor.yy140 = New_AST_LinkLength(yymsp[0].minor.yy0.intval, yymsp[0].minor.yy0.intval);
 }
-#line 1695 "grammar.c"
+#line 1705 "grammar.c"
         break;
       case 57: /* edgeLength ::= MUL */
-#line 342 "grammar.y"
+#line 347 "grammar.y"
 {
 	yymsp[0].minor.yy140 = New_AST_LinkLength(1, UINT_MAX-2);
 }
-#line 1702 "grammar.c"
+#line 1712 "grammar.c"
         break;
       case 58: /* properties ::= */
-#line 348 "grammar.y"
+#line 353 "grammar.y"
 {
 	yymsp[1].minor.yy116 = NULL;
 }
-#line 1709 "grammar.c"
+#line 1719 "grammar.c"
         break;
       case 59: /* properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
-#line 352 "grammar.y"
+#line 357 "grammar.y"
 {
 	yymsp[-2].minor.yy116 = yymsp[-1].minor.yy116;
 }
-#line 1716 "grammar.c"
+#line 1726 "grammar.c"
         break;
       case 60: /* mapLiteral ::= UQSTRING COLON value */
-#line 358 "grammar.y"
+#line 363 "grammar.y"
 {
 	yylhsminor.yy116 = NewVector(SIValue*, 2);
 
@@ -1727,11 +1737,11 @@ static void yy_reduce(
 	*val = yymsp[0].minor.yy189;
 	Vector_Push(yylhsminor.yy116, val);
 }
-#line 1731 "grammar.c"
+#line 1741 "grammar.c"
   yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
       case 61: /* mapLiteral ::= UQSTRING COLON value COMMA mapLiteral */
-#line 370 "grammar.y"
+#line 375 "grammar.y"
 {
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_ConstStringVal(yymsp[-4].minor.yy0.strval);
@@ -1743,345 +1753,362 @@ static void yy_reduce(
 	
 	yylhsminor.yy116 = yymsp[0].minor.yy116;
 }
-#line 1747 "grammar.c"
+#line 1757 "grammar.c"
   yymsp[-4].minor.yy116 = yylhsminor.yy116;
         break;
       case 62: /* whereClause ::= */
-#line 384 "grammar.y"
+#line 389 "grammar.y"
 { 
 	yymsp[1].minor.yy181 = NULL;
 }
-#line 1755 "grammar.c"
+#line 1765 "grammar.c"
         break;
       case 63: /* whereClause ::= WHERE cond */
-#line 387 "grammar.y"
+#line 392 "grammar.y"
 {
 	yymsp[-1].minor.yy181 = New_AST_WhereNode(yymsp[0].minor.yy86);
 }
-#line 1762 "grammar.c"
+#line 1772 "grammar.c"
         break;
       case 64: /* cond ::= arithmetic_expression relation arithmetic_expression */
-#line 396 "grammar.y"
+#line 401 "grammar.y"
 { yylhsminor.yy86 = New_AST_PredicateNode(yymsp[-2].minor.yy154, yymsp[-1].minor.yy122, yymsp[0].minor.yy154); }
-#line 1767 "grammar.c"
+#line 1777 "grammar.c"
   yymsp[-2].minor.yy86 = yylhsminor.yy86;
         break;
       case 65: /* cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
-#line 398 "grammar.y"
+#line 403 "grammar.y"
 { yymsp[-2].minor.yy86 = yymsp[-1].minor.yy86; }
-#line 1773 "grammar.c"
+#line 1783 "grammar.c"
         break;
       case 66: /* cond ::= cond AND cond */
-#line 399 "grammar.y"
+#line 404 "grammar.y"
 { yylhsminor.yy86 = New_AST_ConditionNode(yymsp[-2].minor.yy86, AND, yymsp[0].minor.yy86); }
-#line 1778 "grammar.c"
+#line 1788 "grammar.c"
   yymsp[-2].minor.yy86 = yylhsminor.yy86;
         break;
       case 67: /* cond ::= cond OR cond */
-#line 400 "grammar.y"
+#line 405 "grammar.y"
 { yylhsminor.yy86 = New_AST_ConditionNode(yymsp[-2].minor.yy86, OR, yymsp[0].minor.yy86); }
-#line 1784 "grammar.c"
+#line 1794 "grammar.c"
   yymsp[-2].minor.yy86 = yylhsminor.yy86;
         break;
       case 68: /* returnClause ::= RETURN returnElements */
-#line 404 "grammar.y"
+#line 409 "grammar.y"
 {
 	yymsp[-1].minor.yy188 = New_AST_ReturnNode(yymsp[0].minor.yy66, 0);
 }
-#line 1792 "grammar.c"
+#line 1802 "grammar.c"
         break;
       case 69: /* returnClause ::= RETURN DISTINCT returnElements */
-#line 407 "grammar.y"
+#line 412 "grammar.y"
 {
 	yymsp[-2].minor.yy188 = New_AST_ReturnNode(yymsp[0].minor.yy66, 1);
 }
-#line 1799 "grammar.c"
+#line 1809 "grammar.c"
         break;
       case 70: /* returnElements ::= returnElements COMMA returnElement */
-#line 413 "grammar.y"
+#line 418 "grammar.y"
 {
 	yylhsminor.yy66 = array_append(yymsp[-2].minor.yy66, yymsp[0].minor.yy34);
 }
-#line 1806 "grammar.c"
+#line 1816 "grammar.c"
   yymsp[-2].minor.yy66 = yylhsminor.yy66;
         break;
       case 71: /* returnElements ::= returnElement */
-#line 417 "grammar.y"
+#line 422 "grammar.y"
 {
 	yylhsminor.yy66 = array_new(AST_ReturnElementNode*, 1);
 	array_append(yylhsminor.yy66, yymsp[0].minor.yy34);
 }
-#line 1815 "grammar.c"
+#line 1825 "grammar.c"
   yymsp[0].minor.yy66 = yylhsminor.yy66;
         break;
       case 72: /* returnElement ::= MUL */
-#line 425 "grammar.y"
+#line 430 "grammar.y"
 {
 	yymsp[0].minor.yy34 = New_AST_ReturnElementExpandALL();
 }
-#line 1823 "grammar.c"
+#line 1833 "grammar.c"
         break;
       case 73: /* returnElement ::= arithmetic_expression */
-#line 428 "grammar.y"
+#line 433 "grammar.y"
 {
 	yylhsminor.yy34 = New_AST_ReturnElementNode(yymsp[0].minor.yy154, NULL);
 }
-#line 1830 "grammar.c"
+#line 1840 "grammar.c"
   yymsp[0].minor.yy34 = yylhsminor.yy34;
         break;
       case 74: /* returnElement ::= arithmetic_expression AS UQSTRING */
-#line 432 "grammar.y"
+#line 437 "grammar.y"
 {
 	yylhsminor.yy34 = New_AST_ReturnElementNode(yymsp[-2].minor.yy154, yymsp[0].minor.yy0.strval);
 }
-#line 1838 "grammar.c"
+#line 1848 "grammar.c"
   yymsp[-2].minor.yy34 = yylhsminor.yy34;
         break;
       case 75: /* arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
-#line 439 "grammar.y"
+#line 444 "grammar.y"
 {
 	yymsp[-2].minor.yy154 = yymsp[-1].minor.yy154;
 }
-#line 1846 "grammar.c"
+#line 1856 "grammar.c"
         break;
       case 76: /* arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
-#line 451 "grammar.y"
+#line 456 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
 	Vector_Push(args, yymsp[-2].minor.yy154);
 	Vector_Push(args, yymsp[0].minor.yy154);
 	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("ADD", args);
 }
-#line 1856 "grammar.c"
+#line 1866 "grammar.c"
   yymsp[-2].minor.yy154 = yylhsminor.yy154;
         break;
       case 77: /* arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
-#line 458 "grammar.y"
+#line 463 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
 	Vector_Push(args, yymsp[-2].minor.yy154);
 	Vector_Push(args, yymsp[0].minor.yy154);
 	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("SUB", args);
 }
-#line 1867 "grammar.c"
+#line 1877 "grammar.c"
   yymsp[-2].minor.yy154 = yylhsminor.yy154;
         break;
       case 78: /* arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
-#line 465 "grammar.y"
+#line 470 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
 	Vector_Push(args, yymsp[-2].minor.yy154);
 	Vector_Push(args, yymsp[0].minor.yy154);
 	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("MUL", args);
 }
-#line 1878 "grammar.c"
+#line 1888 "grammar.c"
   yymsp[-2].minor.yy154 = yylhsminor.yy154;
         break;
       case 79: /* arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
-#line 472 "grammar.y"
+#line 477 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
 	Vector_Push(args, yymsp[-2].minor.yy154);
 	Vector_Push(args, yymsp[0].minor.yy154);
 	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("DIV", args);
 }
-#line 1889 "grammar.c"
+#line 1899 "grammar.c"
   yymsp[-2].minor.yy154 = yylhsminor.yy154;
         break;
       case 80: /* arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
-#line 480 "grammar.y"
+#line 485 "grammar.y"
 {
 	yylhsminor.yy154 = New_AST_AR_EXP_OpNode(yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy116);
 }
-#line 1897 "grammar.c"
+#line 1907 "grammar.c"
   yymsp[-3].minor.yy154 = yylhsminor.yy154;
         break;
-      case 81: /* arithmetic_expression ::= value */
-#line 485 "grammar.y"
+      case 81: /* arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS MUL RIGHT_PARENTHESIS */
+#line 490 "grammar.y"
+{
+	// Only count accepts *.
+	if(strcasecmp(yymsp[-3].minor.yy0.strval, "count") != 0) {
+		char buf[256];
+		snprintf(buf, 256, "Syntax error at offset %d near '%s'", yymsp[-3].minor.yy0.pos, yymsp[-3].minor.yy0.s);
+		ctx->ok = 0;
+		ctx->errorMsg = strdup(buf);
+	}
+	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 1);
+	Vector_Push(args, New_AST_AR_EXP_ConstOperandNode(SI_LongVal(1)));
+	yylhsminor.yy154 = New_AST_AR_EXP_OpNode(yymsp[-3].minor.yy0.strval, args);
+}
+#line 1924 "grammar.c"
+  yymsp[-3].minor.yy154 = yylhsminor.yy154;
+        break;
+      case 82: /* arithmetic_expression ::= value */
+#line 504 "grammar.y"
 {
 	yylhsminor.yy154 = New_AST_AR_EXP_ConstOperandNode(yymsp[0].minor.yy189);
 }
-#line 1905 "grammar.c"
+#line 1932 "grammar.c"
   yymsp[0].minor.yy154 = yylhsminor.yy154;
         break;
-      case 82: /* arithmetic_expression ::= variable */
-#line 490 "grammar.y"
+      case 83: /* arithmetic_expression ::= variable */
+#line 509 "grammar.y"
 {
 	yylhsminor.yy154 = New_AST_AR_EXP_VariableOperandNode(yymsp[0].minor.yy120->alias, yymsp[0].minor.yy120->property);
 	free(yymsp[0].minor.yy120);
 }
-#line 1914 "grammar.c"
+#line 1941 "grammar.c"
   yymsp[0].minor.yy154 = yylhsminor.yy154;
         break;
-      case 83: /* arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
-#line 497 "grammar.y"
+      case 84: /* arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
+#line 516 "grammar.y"
 {
 	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy154);
 	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1923 "grammar.c"
+#line 1950 "grammar.c"
   yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 84: /* arithmetic_expression_list ::= arithmetic_expression */
-#line 501 "grammar.y"
+      case 85: /* arithmetic_expression_list ::= arithmetic_expression */
+#line 520 "grammar.y"
 {
 	yylhsminor.yy116 = NewVector(AST_ArithmeticExpressionNode*, 1);
 	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy154);
 }
-#line 1932 "grammar.c"
+#line 1959 "grammar.c"
   yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
-      case 85: /* variable ::= UQSTRING */
-#line 508 "grammar.y"
+      case 86: /* variable ::= UQSTRING */
+#line 527 "grammar.y"
 {
 	yylhsminor.yy120 = New_AST_Variable(yymsp[0].minor.yy0.strval, NULL);
 }
-#line 1940 "grammar.c"
+#line 1967 "grammar.c"
   yymsp[0].minor.yy120 = yylhsminor.yy120;
         break;
-      case 86: /* variable ::= UQSTRING DOT UQSTRING */
-#line 512 "grammar.y"
+      case 87: /* variable ::= UQSTRING DOT UQSTRING */
+#line 531 "grammar.y"
 {
 	yylhsminor.yy120 = New_AST_Variable(yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval);
 }
-#line 1948 "grammar.c"
+#line 1975 "grammar.c"
   yymsp[-2].minor.yy120 = yylhsminor.yy120;
         break;
-      case 87: /* orderClause ::= */
-#line 518 "grammar.y"
+      case 88: /* orderClause ::= */
+#line 537 "grammar.y"
 {
 	yymsp[1].minor.yy28 = NULL;
 }
-#line 1956 "grammar.c"
+#line 1983 "grammar.c"
         break;
-      case 88: /* orderClause ::= ORDER BY arithmetic_expression_list */
-#line 521 "grammar.y"
+      case 89: /* orderClause ::= ORDER BY arithmetic_expression_list */
+#line 540 "grammar.y"
 {
 	yymsp[-2].minor.yy28 = New_AST_OrderNode(yymsp[0].minor.yy116, ORDER_DIR_ASC);
 }
-#line 1963 "grammar.c"
+#line 1990 "grammar.c"
         break;
-      case 89: /* orderClause ::= ORDER BY arithmetic_expression_list ASC */
-#line 524 "grammar.y"
+      case 90: /* orderClause ::= ORDER BY arithmetic_expression_list ASC */
+#line 543 "grammar.y"
 {
 	yymsp[-3].minor.yy28 = New_AST_OrderNode(yymsp[-1].minor.yy116, ORDER_DIR_ASC);
 }
-#line 1970 "grammar.c"
+#line 1997 "grammar.c"
         break;
-      case 90: /* orderClause ::= ORDER BY arithmetic_expression_list DESC */
-#line 527 "grammar.y"
+      case 91: /* orderClause ::= ORDER BY arithmetic_expression_list DESC */
+#line 546 "grammar.y"
 {
 	yymsp[-3].minor.yy28 = New_AST_OrderNode(yymsp[-1].minor.yy116, ORDER_DIR_DESC);
 }
-#line 1977 "grammar.c"
+#line 2004 "grammar.c"
         break;
-      case 91: /* skipClause ::= */
-#line 533 "grammar.y"
+      case 92: /* skipClause ::= */
+#line 552 "grammar.y"
 {
 	yymsp[1].minor.yy173 = NULL;
 }
-#line 1984 "grammar.c"
+#line 2011 "grammar.c"
         break;
-      case 92: /* skipClause ::= SKIP INTEGER */
-#line 536 "grammar.y"
+      case 93: /* skipClause ::= SKIP INTEGER */
+#line 555 "grammar.y"
 {
 	yymsp[-1].minor.yy173 = New_AST_SkipNode(yymsp[0].minor.yy0.intval);
 }
-#line 1991 "grammar.c"
+#line 2018 "grammar.c"
         break;
-      case 93: /* limitClause ::= */
-#line 542 "grammar.y"
+      case 94: /* limitClause ::= */
+#line 561 "grammar.y"
 {
 	yymsp[1].minor.yy77 = NULL;
 }
-#line 1998 "grammar.c"
+#line 2025 "grammar.c"
         break;
-      case 94: /* limitClause ::= LIMIT INTEGER */
-#line 545 "grammar.y"
+      case 95: /* limitClause ::= LIMIT INTEGER */
+#line 564 "grammar.y"
 {
 	yymsp[-1].minor.yy77 = New_AST_LimitNode(yymsp[0].minor.yy0.intval);
 }
-#line 2005 "grammar.c"
+#line 2032 "grammar.c"
         break;
-      case 95: /* unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING */
-#line 551 "grammar.y"
+      case 96: /* unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING */
+#line 570 "grammar.y"
 {
 	yymsp[-5].minor.yy137 = New_AST_UnwindNode(yymsp[-3].minor.yy116, yymsp[0].minor.yy0.strval);
 }
-#line 2012 "grammar.c"
+#line 2039 "grammar.c"
         break;
-      case 96: /* relation ::= EQ */
-#line 556 "grammar.y"
+      case 97: /* relation ::= EQ */
+#line 575 "grammar.y"
 { yymsp[0].minor.yy122 = EQ; }
-#line 2017 "grammar.c"
+#line 2044 "grammar.c"
         break;
-      case 97: /* relation ::= GT */
-#line 557 "grammar.y"
+      case 98: /* relation ::= GT */
+#line 576 "grammar.y"
 { yymsp[0].minor.yy122 = GT; }
-#line 2022 "grammar.c"
+#line 2049 "grammar.c"
         break;
-      case 98: /* relation ::= LT */
-#line 558 "grammar.y"
+      case 99: /* relation ::= LT */
+#line 577 "grammar.y"
 { yymsp[0].minor.yy122 = LT; }
-#line 2027 "grammar.c"
+#line 2054 "grammar.c"
         break;
-      case 99: /* relation ::= LE */
-#line 559 "grammar.y"
+      case 100: /* relation ::= LE */
+#line 578 "grammar.y"
 { yymsp[0].minor.yy122 = LE; }
-#line 2032 "grammar.c"
+#line 2059 "grammar.c"
         break;
-      case 100: /* relation ::= GE */
-#line 560 "grammar.y"
+      case 101: /* relation ::= GE */
+#line 579 "grammar.y"
 { yymsp[0].minor.yy122 = GE; }
-#line 2037 "grammar.c"
+#line 2064 "grammar.c"
         break;
-      case 101: /* relation ::= NE */
-#line 561 "grammar.y"
+      case 102: /* relation ::= NE */
+#line 580 "grammar.y"
 { yymsp[0].minor.yy122 = NE; }
-#line 2042 "grammar.c"
+#line 2069 "grammar.c"
         break;
-      case 102: /* value ::= INTEGER */
-#line 572 "grammar.y"
-{  yylhsminor.yy189 = SI_DoubleVal(yymsp[0].minor.yy0.intval); }
-#line 2047 "grammar.c"
+      case 103: /* value ::= INTEGER */
+#line 591 "grammar.y"
+{  yylhsminor.yy189 = SI_LongVal(yymsp[0].minor.yy0.intval); }
+#line 2074 "grammar.c"
   yymsp[0].minor.yy189 = yylhsminor.yy189;
         break;
-      case 103: /* value ::= DASH INTEGER */
-#line 573 "grammar.y"
-{  yymsp[-1].minor.yy189 = SI_DoubleVal(-yymsp[0].minor.yy0.intval); }
-#line 2053 "grammar.c"
+      case 104: /* value ::= DASH INTEGER */
+#line 592 "grammar.y"
+{  yymsp[-1].minor.yy189 = SI_LongVal(-yymsp[0].minor.yy0.intval); }
+#line 2080 "grammar.c"
         break;
-      case 104: /* value ::= STRING */
-#line 574 "grammar.y"
+      case 105: /* value ::= STRING */
+#line 593 "grammar.y"
 {  yylhsminor.yy189 = SI_ConstStringVal(yymsp[0].minor.yy0.strval); }
-#line 2058 "grammar.c"
+#line 2085 "grammar.c"
   yymsp[0].minor.yy189 = yylhsminor.yy189;
         break;
-      case 105: /* value ::= FLOAT */
-#line 575 "grammar.y"
+      case 106: /* value ::= FLOAT */
+#line 594 "grammar.y"
 {  yylhsminor.yy189 = SI_DoubleVal(yymsp[0].minor.yy0.dval); }
-#line 2064 "grammar.c"
+#line 2091 "grammar.c"
   yymsp[0].minor.yy189 = yylhsminor.yy189;
         break;
-      case 106: /* value ::= DASH FLOAT */
-#line 576 "grammar.y"
+      case 107: /* value ::= DASH FLOAT */
+#line 595 "grammar.y"
 {  yymsp[-1].minor.yy189 = SI_DoubleVal(-yymsp[0].minor.yy0.dval); }
-#line 2070 "grammar.c"
+#line 2097 "grammar.c"
         break;
-      case 107: /* value ::= TRUE */
-#line 577 "grammar.y"
+      case 108: /* value ::= TRUE */
+#line 596 "grammar.y"
 { yymsp[0].minor.yy189 = SI_BoolVal(1); }
-#line 2075 "grammar.c"
+#line 2102 "grammar.c"
         break;
-      case 108: /* value ::= FALSE */
-#line 578 "grammar.y"
+      case 109: /* value ::= FALSE */
+#line 597 "grammar.y"
 { yymsp[0].minor.yy189 = SI_BoolVal(0); }
-#line 2080 "grammar.c"
+#line 2107 "grammar.c"
         break;
-      case 109: /* value ::= NULLVAL */
-#line 579 "grammar.y"
+      case 110: /* value ::= NULLVAL */
+#line 598 "grammar.y"
 { yymsp[0].minor.yy189 = SI_NullVal(); }
-#line 2085 "grammar.c"
+#line 2112 "grammar.c"
         break;
       default:
         break;
@@ -2139,14 +2166,14 @@ static void yy_syntax_error(
   ParseARG_FETCH;
 #define TOKEN yyminor
 /************ Begin %syntax_error code ****************************************/
-#line 32 "grammar.y"
+#line 33 "grammar.y"
 
 	char buf[256];
 	snprintf(buf, 256, "Syntax error at offset %d near '%s'", TOKEN.pos, TOKEN.s);
 
 	ctx->ok = 0;
 	ctx->errorMsg = strdup(buf);
-#line 2150 "grammar.c"
+#line 2177 "grammar.c"
 /************ End %syntax_error code ******************************************/
   ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
 }
@@ -2360,7 +2387,7 @@ void Parse(
 #endif
   return;
 }
-#line 581 "grammar.y"
+#line 600 "grammar.y"
 
 
 	/* Definitions of flex stuff */
@@ -2394,4 +2421,4 @@ void Parse(
 		yylex_destroy();
 		return ctx.root;
 	}
-#line 2398 "grammar.c"
+#line 2425 "grammar.c"
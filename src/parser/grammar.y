@@ -11,6 +11,7 @@
 	#include <stdio.h>
 	#include <assert.h>
 	#include <limits.h>
+	#include <strings.h>
 	#include "token.h"	
 	#include "grammar.h"
 	#include "ast.h"
@@ -42,7 +43,11 @@
 
 %type expr {AST*}
 
-query ::= expr(A). { ctx->root = A; }
+query ::= expr(A). {
+	// Discard query rejected while being reduced.
+	if(ctx->ok) ctx->root = A;
+	else AST_Free(A);
+}
 
 expr(A) ::= multipleMatchClause(B) whereClause(C) multipleCreateClause(D) returnClause(E) orderClause(F) skipClause(G) limitClause(H). {
 	A = AST_New(B, C, D, NULL, NULL, NULL, E, F, G, H, NULL, NULL);
@@ -481,6 +486,20 @@ arithmetic_expression(A) ::= UQSTRING(B) LEFT_PARENTHESIS arithmetic_expression_
 	A = New_AST_AR_EXP_OpNode(B.strval, C);
 }
 
+// count(*), evaluated as the function applied to a non-null constant.
+arithmetic_expression(A) ::= UQSTRING(B) LEFT_PARENTHESIS MUL RIGHT_PARENTHESIS. {
+	// Only count accepts *.
+	if(strcasecmp(B.strval, "count") != 0) {
+		char buf[256];
+		snprintf(buf, 256, "Syntax error at offset %d near '%s'", B.pos, B.s);
+		ctx->ok = 0;
+		ctx->errorMsg = strdup(buf);
+	}
+	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 1);
+	Vector_Push(args, New_AST_AR_EXP_ConstOperandNode(SI_LongVal(1)));
+	A = New_AST_AR_EXP_OpNode(B.strval, args);
+}
+
 // 4, "hello"
 arithmetic_expression(A) ::= value(B). {
 	A = New_AST_AR_EXP_ConstOperandNode(B);
@@ -569,8 +588,8 @@ relation(A) ::= NE. { A = NE; }
 %type value {SIValue}
 
 // raw value tokens - int / string / float
-value(A) ::= INTEGER(B). {  A = SI_DoubleVal(B.intval); }
-value(A) ::= DASH INTEGER(B). {  A = SI_DoubleVal(-B.intval); }
+value(A) ::= INTEGER(B). {  A = SI_LongVal(B.intval); }
+value(A) ::= DASH INTEGER(B). {  A = SI_LongVal(-B.intval); }
 value(A) ::= STRING(B). {  A = SI_ConstStringVal(B.strval); }
 value(A) ::= FLOAT(B). {  A = SI_DoubleVal(B.dval); }
 value(A) ::= DASH FLOAT(B). {  A = SI_DoubleVal(-B.dval); }
@@ -992,7 +992,7 @@ case 26:
 YY_RULE_SETUP
 #line 53 "lexer.l"
 {
-  tok.intval = atoi(yytext); 
+  tok.intval = strtoll(yytext, NULL, 10); 
   return INTEGER;
 }
 	YY_BREAK
@@ -16,13 +16,11 @@
 /* Checks if we've already seen given records
  * Returns 1 if the string did not exist otherwise 0. */
 static int _encounteredRecord(ResultSet *set, const Record r) {
-    char *str = NULL;
-    size_t len = 0;
-    len = Record_ToString(r, &str, &len);
+    // Record's string representation is written to set's reusable buffer.
+    size_t len = Record_ToString(r, &set->buffer, &set->bufferLen);
 
     // Returns 1 if the string did NOT exist otherwise 0
-    int newRecord = TrieMap_Add(set->trie, str, len, NULL, NULL);
-    rm_free(str);
+    int newRecord = TrieMap_Add(set->trie, set->buffer, len, NULL, NULL);
     return !newRecord;
 }
 
@@ -75,6 +73,8 @@ static void _ResultSet_ReplayStats(RedisModuleCtx* ctx, ResultSet* set) {
     if(set->stats.relationships_created > 0) resultset_size++;
     if(set->stats.nodes_deleted > 0) resultset_size++;
     if(set->stats.relationships_deleted > 0) resultset_size++;
+    if(set->stats.string_dict_hits > 0) resultset_size++;
+    if(set->stats.allocated_bytes > 0) resultset_size++;
 
     RedisModule_ReplyWithArray(ctx, resultset_size);
 
@@ -107,6 +107,16 @@ static void _ResultSet_ReplayStats(RedisModuleCtx* ctx, ResultSet* set) {
         buflen = sprintf(buff, "Relationships deleted: %d", set->stats.relationships_deleted);
         RedisModule_ReplyWithStringBuffer(ctx, (const char*)buff, buflen);
     }
+
+    if(set->stats.string_dict_hits > 0) {
+        buflen = sprintf(buff, "String dictionary hits: %d", set->stats.string_dict_hits);
+        RedisModule_ReplyWithStringBuffer(ctx, (const char*)buff, buflen);
+    }
+
+    if(set->stats.allocated_bytes > 0) {
+        buflen = sprintf(buff, "Query allocated bytes: %zu", set->stats.allocated_bytes);
+        RedisModule_ReplyWithStringBuffer(ctx, (const char*)buff, buflen);
+    }
 }
 
 static Column* _NewColumn(char *name, char *alias) {
@@ -186,7 +196,7 @@ ResultSet* NewResultSet(AST* ast, RedisModuleCtx *ctx) {
     set->recordCount = 0;    
     set->header = NULL;
     set->bufferLen = 2048;
-    set->buffer = malloc(set->bufferLen);
+    set->buffer = rm_malloc(set->bufferLen);
 
     set->stats.labels_added = 0;
     set->stats.nodes_created = 0;
@@ -194,6 +204,8 @@ ResultSet* NewResultSet(AST* ast, RedisModuleCtx *ctx) {
     set->stats.relationships_created = 0;
     set->stats.nodes_deleted = 0;
     set->stats.relationships_deleted = 0;
+    set->stats.string_dict_hits = 0;
+    set->stats.allocated_bytes = 0;
 
     // Account for skipped records.
     if(ast->limitNode != NULL) set->limit = set->skip + ast->limitNode->limit;
@@ -233,7 +245,7 @@ void ResultSet_Replay(ResultSet* set) {
 void ResultSet_Free(ResultSet *set) {
     if(!set) return;
 
-    free(set->buffer);
+    rm_free(set->buffer);
     if(set->header) _ResultSetHeader_Free(set->header);
     if(set->trie != NULL) TrieMap_Free(set->trie, TrieMap_NOP_CB);
     free(set);
@@ -9,6 +9,7 @@
 #define __GRAPH_RESULTSET_STATS_H__
 
 #include <stdbool.h>
+#include <stddef.h>
 
 typedef struct {
     int labels_added;           /* Number of labels added as part of a create query. */
@@ -17,6 +18,8 @@ typedef struct {
     int relationships_created;  /* Number of edges created as part of a create query. */
     int nodes_deleted;          /* Number of nodes removed as part of a delete query.*/
     int relationships_deleted;  /* Number of edges removed as part of a delete query.*/
+    int string_dict_hits;       /* Number of string values set which were already in the string dictionary. */
+    size_t allocated_bytes;     /* Number of bytes reserved by the query's arena. */
 } ResultSetStatistics;
 
 /* Checks to see if resultset-statistics indicate that a modification was made. */
@@ -0,0 +1,174 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "arena.h"
+#include "rmalloc.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+
+#define ARENA_BLOCK_SIZE (64 * 1024)    // Default block size.
+#define ARENA_ALIGNMENT 16              // Alignment of every allocation.
+#define ARENA_SIZE_CLASSES 64           // Free lists cover allocations of up to 1KB.
+#define ARENA_ALIGN(n) (((n) + ARENA_ALIGNMENT - 1) & ~((size_t)ARENA_ALIGNMENT - 1))
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;    // Previously allocated block.
+} ArenaBlock;
+
+#define ARENA_BLOCK_HEADER ARENA_ALIGN(sizeof(ArenaBlock))
+
+typedef struct FreeChunk {
+    struct FreeChunk *next;
+} FreeChunk;
+
+struct Arena {
+    ArenaBlock *blocks;                         // Allocated blocks, most recent first.
+    char *ptr;                                  // Next free byte within current block.
+    char *end;                                  // End of current block.
+    FreeChunk *free_lists[ARENA_SIZE_CLASSES];  // Released chunks, by size class.
+    size_t allocated;                           // Number of bytes reserved from the system.
+};
+
+static pthread_key_t _arenaKey;
+static pthread_once_t _arenaKeyOnce = PTHREAD_ONCE_INIT;
+
+static void _Arena_CreateKey(void) {
+    int res = pthread_key_create(&_arenaKey, NULL);
+    assert(res == 0);
+    (void)res;
+}
+
+// Size class of an aligned size, ARENA_SIZE_CLASSES if too large.
+static inline size_t _Arena_SizeClass(size_t size) {
+    size_t c = size / ARENA_ALIGNMENT - 1;
+    return (c < ARENA_SIZE_CLASSES) ? c : ARENA_SIZE_CLASSES;
+}
+
+// Reserves a new block capable of holding size bytes, returns its data.
+static char *_Arena_AddBlock(Arena *arena, size_t size) {
+    ArenaBlock *block = rm_malloc(ARENA_BLOCK_HEADER + size);
+    block->next = arena->blocks;
+    arena->blocks = block;
+    arena->allocated += ARENA_BLOCK_HEADER + size;
+    return (char*)block + ARENA_BLOCK_HEADER;
+}
+
+Arena *Arena_New(void) {
+    Arena *arena = rm_calloc(1, sizeof(Arena));
+    return arena;
+}
+
+void *Arena_Alloc(Arena *arena, size_t size) {
+    if(!arena) return rm_malloc(size);
+
+    size = ARENA_ALIGN(size ? size : 1);
+    size_t c = _Arena_SizeClass(size);
+
+    // Reuse a released chunk.
+    if(c < ARENA_SIZE_CLASSES && arena->free_lists[c]) {
+        FreeChunk *chunk = arena->free_lists[c];
+        arena->free_lists[c] = chunk->next;
+        return chunk;
+    }
+
+    // Bump allocate from current block.
+    if((size_t)(arena->end - arena->ptr) >= size) {
+        void *p = arena->ptr;
+        arena->ptr += size;
+        return p;
+    }
+
+    // Large allocations get a block of their own,
+    // current block remains in use.
+    if(size > ARENA_BLOCK_SIZE / 4) return _Arena_AddBlock(arena, size);
+
+    char *data = _Arena_AddBlock(arena, ARENA_BLOCK_SIZE);
+    arena->ptr = data + size;
+    arena->end = data + ARENA_BLOCK_SIZE;
+    return data;
+}
+
+void *Arena_Calloc(Arena *arena, size_t nelem, size_t size) {
+    if(!arena) return rm_calloc(nelem, size);
+
+    void *p = Arena_Alloc(arena, nelem * size);
+    memset(p, 0, nelem * size);
+    return p;
+}
+
+void *Arena_Realloc(Arena *arena, void *ptr, size_t old_size, size_t size) {
+    if(!arena) return rm_realloc(ptr, size);
+    if(!ptr) return Arena_Alloc(arena, size);
+
+    size_t old_aligned = ARENA_ALIGN(old_size ? old_size : 1);
+    size_t aligned = ARENA_ALIGN(size ? size : 1);
+    if(aligned <= old_aligned) return ptr;
+
+    // Extend last bump allocation in place.
+    if((char*)ptr + old_aligned == arena->ptr &&
+       (size_t)(arena->end - (char*)ptr) >= aligned) {
+        arena->ptr = (char*)ptr + aligned;
+        return ptr;
+    }
+
+    void *p = Arena_Alloc(arena, size);
+    memcpy(p, ptr, old_size);
+    Arena_Release(arena, ptr, old_size);
+    return p;
+}
+
+void Arena_Release(Arena *arena, void *ptr, size_t size) {
+    if(!arena) {
+        rm_free(ptr);
+        return;
+    }
+    if(!ptr) return;
+
+    size = ARENA_ALIGN(size ? size : 1);
+
+    // Roll back last bump allocation.
+    if((char*)ptr + size == arena->ptr) {
+        arena->ptr = ptr;
+        return;
+    }
+
+    // Large allocations are reclaimed once arena is freed.
+    size_t c = _Arena_SizeClass(size);
+    if(c == ARENA_SIZE_CLASSES) return;
+
+    FreeChunk *chunk = ptr;
+    chunk->next = arena->free_lists[c];
+    arena->free_lists[c] = chunk;
+}
+
+size_t Arena_AllocatedBytes(const Arena *arena) {
+    assert(arena);
+    return arena->allocated;
+}
+
+void Arena_Free(Arena *arena) {
+    if(!arena) return;
+
+    ArenaBlock *block = arena->blocks;
+    while(block) {
+        ArenaBlock *next = block->next;
+        rm_free(block);
+        block = next;
+    }
+    rm_free(arena);
+}
+
+void Arena_SetCurrent(Arena *arena) {
+    pthread_once(&_arenaKeyOnce, _Arena_CreateKey);
+    pthread_setspecific(_arenaKey, arena);
+}
+
+Arena *Arena_GetCurrent(void) {
+    pthread_once(&_arenaKeyOnce, _Arena_CreateKey);
+    return pthread_getspecific(_arenaKey);
+}
@@ -0,0 +1,52 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stddef.h>
+
+/* Arena, a bump allocator owned by a single thread.
+ * Memory is carved out of large blocks and released all at once
+ * by Arena_Free, sparing the global allocator (and its locks)
+ * the many short lived allocations made while executing a query.
+ * Small allocations given back via Arena_Release are kept
+ * on per size free lists and reused by subsequent allocations.
+ *
+ * Every function accepting an arena falls back to the
+ * rm_malloc family when given a NULL arena. */
+
+typedef struct Arena Arena;
+
+// Create a new, empty arena.
+Arena *Arena_New(void);
+
+// Allocate size bytes from arena.
+void *Arena_Alloc(Arena *arena, size_t size);
+
+// Allocate zero initialized memory for nelem elements of size bytes.
+void *Arena_Calloc(Arena *arena, size_t nelem, size_t size);
+
+// Grow or shrink an allocation of old_size bytes to size bytes.
+void *Arena_Realloc(Arena *arena, void *ptr, size_t old_size, size_t size);
+
+// Give back an allocation of size bytes.
+void Arena_Release(Arena *arena, void *ptr, size_t size);
+
+// Returns number of bytes arena reserved from the system.
+size_t Arena_AllocatedBytes(const Arena *arena);
+
+// Free arena and every allocation made from it.
+void Arena_Free(Arena *arena);
+
+// Sets calling thread's current arena, NULL clears it.
+void Arena_SetCurrent(Arena *arena);
+
+// Retrieves calling thread's current arena, NULL if unset.
+Arena *Arena_GetCurrent(void);
+
+#endif
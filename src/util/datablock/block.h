@@ -9,10 +9,18 @@
 #define _BLOCK_H_
 
 #include <stdlib.h>
+#include <stdint.h>
 
 // Number of items in a block. Should always be a power of 2.
 #define BLOCK_CAP 16384
 
+// Number of 64 bit words in a block's occupancy bitmap.
+#define BLOCK_BITMAP_WORDS (BLOCK_CAP / 64)
+
+// Is item at position pos within block in use.
+#define BLOCK_ITEM_OCCUPIED(block, pos) \
+    (((block)->occupied[(pos) >> 6] >> ((pos) & 63)) & 1)
+
 
 /* Data block is a type agnostic continuous block of memory 
  * used to hold items of the same type, each block has a next 
@@ -21,6 +29,7 @@
 typedef struct Block {
     size_t itemSize;        // Size of a single Item in bytes.
     struct Block *next;     // Pointer to next block.
+    uint64_t occupied[BLOCK_BITMAP_WORDS];  // Bit per item, set if item is in use.
     unsigned char data[];   // Item array. MUST BE LAST MEMBER OF THE STRUCT!
 } Block;
 
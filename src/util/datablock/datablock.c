@@ -74,21 +74,12 @@ void _DataBlock_AddBlocks(DataBlock *dataBlock, size_t blockCount) {
     dataBlock->itemCap = dataBlock->blockCount * BLOCK_CAP;
 }
 
-void static inline _DataBlock_MarkItemAsDeleted(const DataBlock *dataBlock, unsigned char* item) {
-    memset(item, DELETED_MARKER, dataBlock->itemSize);
+void static inline _Block_MarkItemAsDeleted(Block *block, size_t pos) {
+    block->occupied[pos >> 6] &= ~((uint64_t)1 << (pos & 63));
 }
 
-void static inline _DataBlock_MarkItemAsUndelete(const DataBlock *dataBlock, unsigned char* item) {
-    item[0] = !DELETED_MARKER;
-}
-
-int static inline _DataBlock_IsItemDeleted(const DataBlock *dataBlock, unsigned char* item) {
-    for(int i = 0; i < dataBlock->itemSize; i++) {
-        if(item[i] != DELETED_MARKER) {
-            return 0;
-        }
-    }
-    return 1;
+void static inline _Block_MarkItemAsUndelete(Block *block, size_t pos) {
+    block->occupied[pos >> 6] |= ((uint64_t)1 << (pos & 63));
 }
 
 // Checks to see if idx is within global array bounds
@@ -121,6 +112,18 @@ DataBlockIterator *DataBlock_Scan(const DataBlock *dataBlock) {
     return DataBlockIterator_New(startBlock, 0, endPos, 1);
 }
 
+DataBlockIterator *DataBlock_ScanRange(const DataBlock *dataBlock, int64_t start, int64_t end) {
+    assert(dataBlock && start >= 0);
+
+    // Range is clipped to the scanned positions of the entire datablock.
+    int64_t scanEnd = dataBlock->itemCount + array_len(dataBlock->deletedIdx);
+    if(end > scanEnd) end = scanEnd;
+    if(start >= end) return DataBlockIterator_New(dataBlock->blocks[0], 0, 0, 1);
+
+    Block *startBlock = dataBlock->blocks[ITEM_INDEX_TO_BLOCK_INDEX(start)];
+    return DataBlockIterator_New(startBlock, start, end, 1);
+}
+
 // Make sure datablock can accommodate at least k items.
 void DataBlock_Accommodate(DataBlock *dataBlock, int64_t k) {
     // Compute number of free slots.
@@ -140,13 +143,11 @@ void *DataBlock_GetItem(const DataBlock *dataBlock, size_t idx) {
 
     Block *block = GET_ITEM_BLOCK(dataBlock, idx);
     idx = ITEM_POSITION_WITHIN_BLOCK(idx);
-    
-    unsigned char *item = block->data + (idx * block->itemSize);
 
     // Incase item is marked as deleted, return NULL.
-    if(_DataBlock_IsItemDeleted(dataBlock, item)) return NULL;
+    if(!BLOCK_ITEM_OCCUPIED(block, idx)) return NULL;
 
-    return item;
+    return block->data + (idx * block->itemSize);
 }
 
 void* DataBlock_AllocateItem(DataBlock *dataBlock, u_int64_t *idx) {
@@ -172,7 +173,7 @@ void* DataBlock_AllocateItem(DataBlock *dataBlock, u_int64_t *idx) {
     pos = ITEM_POSITION_WITHIN_BLOCK(pos);
     
     unsigned char *item = block->data + (pos * block->itemSize);
-    _DataBlock_MarkItemAsUndelete(dataBlock, item);
+    _Block_MarkItemAsUndelete(block, pos);
 
     return (void*)item;
 }
@@ -186,13 +187,11 @@ void DataBlock_DeleteItem(DataBlock *dataBlock, u_int64_t idx) {
     Block *block = dataBlock->blocks[blockIdx];
 
     uint blockPos = ITEM_POSITION_WITHIN_BLOCK(idx);
-    size_t offset = blockPos * block->itemSize;
 
     // Return if item already deleted.
-    unsigned char *item = block->data + offset;
-    if(_DataBlock_IsItemDeleted(dataBlock, item)) return;
+    if(!BLOCK_ITEM_OCCUPIED(block, blockPos)) return;
 
-    _DataBlock_MarkItemAsDeleted(dataBlock, item);
+    _Block_MarkItemAsDeleted(block, blockPos);
     dataBlock->deletedIdx = array_append(dataBlock->deletedIdx, idx);
     dataBlock->itemCount--;
 }
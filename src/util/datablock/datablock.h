@@ -13,8 +13,6 @@
 #include "./block.h"
 #include "./datablock_iterator.h"
 
-#define DELETED_MARKER 0xFF
-
 /* Data block is a type agnostic continues block of memory 
  * used to hold items of the same type, each block has a next 
  * pointer to another block or NULL if this is the last block. */
@@ -39,6 +37,9 @@ void DataBlock_Accommodate(DataBlock *dataBlock, int64_t k);
 // Returns an iterator which scans entire datablock.
 DataBlockIterator *DataBlock_Scan(const DataBlock *dataBlock);
 
+// Returns an iterator which scans items at positions [start, end).
+DataBlockIterator *DataBlock_ScanRange(const DataBlock *dataBlock, int64_t start, int64_t end);
+
 // Get item at position idx
 void *DataBlock_GetItem(const DataBlock *dataBlock, size_t idx);
 
@@ -11,15 +11,6 @@
 #include "../rmalloc.h"
 #include <stdio.h>
 
-int static inline _IsItemDeleted(int itemSize, unsigned char* item) {
-    for(int i = 0; i < itemSize; i++) {
-        if(item[i] != DELETED_MARKER) {
-            return 0;
-        }
-    }
-    return 1;
-}
-
 DataBlockIterator *DataBlockIterator_New(Block *block, int64_t start_pos, int64_t end_pos, int step) {
     assert(block && start_pos >= 0 && end_pos >= start_pos && step >= 1);
     
@@ -38,38 +29,48 @@ DataBlockIterator *DataBlockIterator_Clone(const DataBlockIterator *it) {
     return DataBlockIterator_New(it->_start_block, it->_start_pos, it->_end_pos, it->_step);
 }
 
+// Advance iterator by n positions, moving to the next block if required.
+void static inline _DataBlockIterator_Advance(DataBlockIterator *iter, int n) {
+    iter->_block_pos += n;
+    iter->_current_pos += n;
+    if(iter->_block_pos >= BLOCK_CAP) {
+        iter->_block_pos -= BLOCK_CAP;
+        iter->_current_block = iter->_current_block->next;
+    }
+}
+
 void *DataBlockIterator_Next(DataBlockIterator *iter) {
     assert(iter);
-    
-    if(iter->_current_pos >= iter->_end_pos || iter->_current_block == NULL) return NULL;
-    
-    size_t itemSize = iter->_current_block->itemSize;
-    unsigned char *item = NULL;
+
     // Have we reached the end of our iterator?
     while(iter->_current_pos < iter->_end_pos && iter->_current_block != NULL) {
-        // Get item at current position.
         Block *block = iter->_current_block;
-        item = block->data + (iter->_block_pos * block->itemSize);
+        int pos = iter->_block_pos;
 
-        // Advance to next position.
-        iter->_block_pos += iter->_step;
-        iter->_current_pos += iter->_step;
-
-        // Advance to next block if current block consumed.
-        if(iter->_block_pos >= BLOCK_CAP) {
-            iter->_block_pos -= BLOCK_CAP;
-            iter->_current_block = iter->_current_block->next;
-        }
-
-        if(_IsItemDeleted(itemSize, item)) {
-            item = NULL;
+        if(iter->_step == 1) {
+            // Skip over unoccupied items a word at a time.
+            uint64_t word = block->occupied[pos >> 6] >> (pos & 63);
+            if(word == 0) {
+                _DataBlockIterator_Advance(iter, 64 - (pos & 63));
+                continue;
+            }
+            int skip = __builtin_ctzll(word);
+            pos += skip;
+            iter->_block_pos = pos;
+            iter->_current_pos += skip;
+            if(iter->_current_pos >= iter->_end_pos) break;
+        } else if(!BLOCK_ITEM_OCCUPIED(block, pos)) {
+            _DataBlockIterator_Advance(iter, iter->_step);
             continue;
         }
 
-        break;
+        // Get item at current position and advance to next position.
+        unsigned char *item = block->data + (pos * block->itemSize);
+        _DataBlockIterator_Advance(iter, iter->_step);
+        return (void*)item;
     }
-    
-    return (void*)item;
+
+    return NULL;
 }
 
 void DataBlockIterator_Reset(DataBlockIterator *iter) {
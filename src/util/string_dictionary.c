@@ -0,0 +1,123 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include <assert.h>
+#include <stddef.h>
+#include "string_dictionary.h"
+#include "arr.h"
+#include "rmalloc.h"
+
+#define uthash_malloc(sz) rm_malloc(sz)
+#define uthash_free(ptr,sz) rm_free(ptr)
+#include "uthash.h"
+
+// Longest string the dictionary will hold.
+#define STRING_DICTIONARY_MAX_LEN UINT16_MAX
+
+struct StringDictionaryEntry {
+    UT_hash_handle hh;      // Makes entry hashable.
+    uint32_t id;            // String ID.
+    char str[];             // Interned string. MUST BE LAST MEMBER OF THE STRUCT!
+};
+
+// Retrieves entry holding interned string.
+#define ENTRY_FROM_STRING(s) \
+    ((StringDictionaryEntry*)((s) - offsetof(StringDictionaryEntry, str)))
+
+StringDictionary *StringDictionary_New(void) {
+    StringDictionary *dict = rm_malloc(sizeof(StringDictionary));
+    dict->entries = NULL;
+    dict->strings = array_new(char*, 64);
+    dict->hits = 0;
+    dict->misses = 0;
+    return dict;
+}
+
+uint32_t StringDictionary_Count(const StringDictionary *dict) {
+    assert(dict);
+    return array_len(dict->strings);
+}
+
+const char *StringDictionary_Lookup(const StringDictionary *dict, const char *str) {
+    assert(dict && str);
+    StringDictionaryEntry *entry = NULL;
+    size_t len = strlen(str);
+    HASH_FIND(hh, dict->entries, str, len, entry);
+    return (entry) ? entry->str : NULL;
+}
+
+const char *StringDictionary_Intern(StringDictionary *dict, const char *str, bool *hit) {
+    assert(dict && str);
+    if(hit) *hit = false;
+
+    size_t len = strlen(str);
+    if(len > STRING_DICTIONARY_MAX_LEN) return NULL;
+
+    StringDictionaryEntry *entry = NULL;
+    HASH_FIND(hh, dict->entries, str, len, entry);
+    if(entry) {
+        dict->hits++;
+        if(hit) *hit = true;
+        return entry->str;
+    }
+
+    // Introduce a new string.
+    entry = rm_malloc(sizeof(StringDictionaryEntry) + len + 1);
+    memcpy(entry->str, str, len + 1);
+    entry->id = array_len(dict->strings);
+    dict->strings = array_append(dict->strings, entry->str);
+    HASH_ADD_KEYPTR(hh, dict->entries, entry->str, len, entry);
+    dict->misses++;
+    return entry->str;
+}
+
+SIValue StringDictionary_InternValue(StringDictionary *dict, SIValue v, uint32_t *cardinality, bool *hit) {
+    assert(dict && cardinality);
+    if(hit) *hit = false;
+    if(!(v.type & SI_STRING)) return v;
+
+    const char *interned;
+    if(*cardinality < STRING_DICTIONARY_ATTRIBUTE_CAP) {
+        uint64_t misses = dict->misses;
+        interned = StringDictionary_Intern(dict, v.stringval, hit);
+        if(dict->misses != misses) (*cardinality)++;
+    } else {
+        // High cardinality attribute, only share existing strings.
+        interned = StringDictionary_Lookup(dict, v.stringval);
+        if(interned) {
+            dict->hits++;
+            if(hit) *hit = true;
+        }
+    }
+
+    // Plain strings are owned by the entity holding them.
+    if(!interned) return (v.type == T_CONSTSTRING) ? SI_Clone(v) : v;
+
+    SIValue_Free(&v);
+    return SI_ConstStringVal((char*)interned);
+}
+
+uint32_t StringDictionary_GetID(const char *str) {
+    assert(str);
+    return ENTRY_FROM_STRING(str)->id;
+}
+
+const char *StringDictionary_GetString(const StringDictionary *dict, uint32_t id) {
+    assert(dict && id < array_len(dict->strings));
+    return dict->strings[id];
+}
+
+void StringDictionary_Free(StringDictionary *dict) {
+    if(!dict) return;
+    StringDictionaryEntry *entry, *tmp;
+    HASH_ITER(hh, dict->entries, entry, tmp) {
+        HASH_DEL(dict->entries, entry);
+        rm_free(entry);
+    }
+    array_free(dict->strings);
+    rm_free(dict);
+}
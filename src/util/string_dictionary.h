@@ -0,0 +1,89 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __STRING_DICTIONARY_H__
+#define __STRING_DICTIONARY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../value.h"
+
+/* String dictionary holds a single copy of every distinct string
+ * interned into it, each string is assigned a unique ID.
+ * Interned strings live for as long as the dictionary does,
+ * as such two interned strings are equal if and only if
+ * they share the same address.
+ * Only low cardinality attributes are encoded, an attribute stops introducing
+ * strings once it introduced STRING_DICTIONARY_ATTRIBUTE_CAP of them,
+ * its remaining values are kept as plain strings. */
+
+// Number of distinct strings a single attribute may introduce.
+#define STRING_DICTIONARY_ATTRIBUTE_CAP 1024
+
+typedef struct StringDictionaryEntry StringDictionaryEntry;
+
+typedef struct {
+    StringDictionaryEntry *entries;     // Hash table of interned strings.
+    char **strings;                     // array_t of interned strings, indexed by ID.
+    uint64_t hits;                      // Number of interns resolved to an existing string.
+    uint64_t misses;                    // Number of interns which introduced a new string.
+} StringDictionary;
+
+// Create a new, empty dictionary.
+StringDictionary *StringDictionary_New(void);
+
+// Returns number of distinct strings in dictionary.
+uint32_t StringDictionary_Count (
+    const StringDictionary *dict
+);
+
+// Returns dictionary's copy of str, introducing it if missing,
+// hit is set to true if str was already in dictionary.
+// Strings too long to intern are not introduced and NULL is returned.
+const char *StringDictionary_Intern (
+    StringDictionary *dict,
+    const char *str,
+    bool *hit
+);
+
+// Returns dictionary's copy of str, NULL if str isn't in dictionary.
+const char *StringDictionary_Lookup (
+    const StringDictionary *dict,
+    const char *str
+);
+
+// Interns string values of an attribute, returns a constant string value
+// referring to dictionary's copy, v is freed if it owns its string.
+// cardinality counts strings introduced by the attribute, once it reaches
+// STRING_DICTIONARY_ATTRIBUTE_CAP values are only resolved against existing
+// strings, unresolved values are returned as owned strings.
+// Non string values are returned as is.
+SIValue StringDictionary_InternValue (
+    StringDictionary *dict,
+    SIValue v,
+    uint32_t *cardinality,
+    bool *hit
+);
+
+// Returns ID of an interned string,
+// str must have been returned by the dictionary.
+uint32_t StringDictionary_GetID (
+    const char *str
+);
+
+// Returns string with given ID.
+const char *StringDictionary_GetString (
+    const StringDictionary *dict,
+    uint32_t id
+);
+
+// Free dictionary and all of its strings.
+void StringDictionary_Free (
+    StringDictionary *dict
+);
+
+#endif
@@ -12,6 +12,7 @@
 #include <ctype.h>
 #include <sys/param.h>
 #include <assert.h>
+#include <math.h>
 #include "util/rmalloc.h"
 
 SIValue SI_IntVal(int i) { return (SIValue){.intval = i, .type = T_INT32}; }
@@ -334,8 +335,17 @@ int SIValue_Compare(SIValue a, SIValue b) {
     return DISJOINT;
   }
 
-  // Use strcmp if values are string types
-  if (a.type & SI_STRING) return strcmp(a.stringval, b.stringval);
+  // Use strcmp if values are string types,
+  // interned strings are equal if they share the same address.
+  if (a.type & SI_STRING) {
+    if (a.stringval == b.stringval) return 0;
+    return strcmp(a.stringval, b.stringval);
+  }
+
+  // Compare 64 bit integers natively, avoiding loss of precision.
+  if (a.type == T_INT64 && b.type == T_INT64) {
+    return (a.longval > b.longval) - (a.longval < b.longval);
+  }
 
   // Attempt to cast both values to doubles
   double tmp_a, tmp_b;
@@ -379,6 +389,44 @@ int SIValue_Order(const SIValue a, const SIValue b) {
   return 0;
 }
 
+// Finalizer of 64 bit MurmurHash3, scatters bits of x.
+static inline uint64_t _hashMix(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+uint64_t SIValue_HashCode(SIValue v) {
+  // Both string types share a hash, FNV-1a over string content.
+  if (v.type & SI_STRING) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (const unsigned char *c = (const unsigned char *)v.stringval; *c; c++) {
+      h ^= *c;
+      h *= 0x100000001b3ULL;
+    }
+    return h;
+  }
+
+  double d;
+  if (v.type & SI_NUMERIC) {
+    SIValue_ToDouble(&v, &d);
+    // +0.0 and -0.0 are equal, as are all NaNs.
+    if (d == 0) d = 0;
+    if (d != d) d = NAN;
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    return _hashMix(bits);
+  }
+
+  if (v.type == T_BOOL) return _hashMix(T_BOOL ^ (uint64_t)(v.boolval != 0));
+
+  // Incomparable values are hashed by type.
+  return _hashMix(v.type);
+}
+
 void SIValue_Print(FILE *outstream, SIValue *v) {
   switch (v->type) {
     case T_STRING:
@@ -8,6 +8,7 @@
 #ifndef __SECONDARY_VALUE_H__
 #define __SECONDARY_VALUE_H__
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -116,6 +117,10 @@ int SIValue_Compare(SIValue a, SIValue b);
  * Under Cypher's orderability, where string < boolean < numeric < NULL. */
 int SIValue_Order(const SIValue a, const SIValue b);
 
+/* Hashes value, values which compare as equal are hashed equally,
+ * e.g. numerics are hashed by their double representation. */
+uint64_t SIValue_HashCode(SIValue v);
+
 void SIValue_Print(FILE *outstream, SIValue *v);
 
 /* Free an SIValue's internal property if that property is a heap allocation owned
@@ -2,6 +2,7 @@ import os
 import sys
 import unittest
 import threading
+import time
 from redisgraph import Graph, Node, Edge
 
 sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
@@ -52,6 +53,27 @@ def query_write(graph, query, threadID):
             assertions[threadID] = False
             break
 
+def query_read_timed(graph, query, threadID, iterations):
+    global assertions
+    assertions[threadID] = True
+
+    for i in range(iterations):
+        actual_result = graph.query(query)
+        if len(actual_result.result_set) < 2:
+            assertions[threadID] = False
+            break
+
+def query_write_timed(graph, threadID, iterations):
+    global assertions
+    assertions[threadID] = True
+
+    for i in range(iterations):
+        q = """MATCH (a:person {name:"Roi"}) CREATE (a)-[:visit]->(:city {id:%d})""" % i
+        actual_result = graph.query(q)
+        if actual_result.relationships_created != 1:
+            assertions[threadID] = False
+            break
+
 def delete_graph(graph, threadID):
     global assertions
     assertions[threadID] = True
@@ -136,6 +158,36 @@ class ConcurrentQueryFlowTest(FlowTestsBase):
             t.join()
             assert(assertions[i])
 
+    # Measure read throughput while a single writer keeps modifying the graph,
+    # readers should find matrices synchronized by the writer and not contend.
+    def test_03_concurrent_read_benchmark(self):
+        iterations = 50
+        q = """MATCH (p:person)-[:know]->(n:person) RETURN count(n)"""
+        threads = []
+        start = time.time()
+
+        t = threading.Thread(target=query_write_timed, args=(graphs[0], 0, iterations))
+        t.setDaemon(True)
+        threads.append(t)
+        t.start()
+
+        for i in range(1, CLIENT_COUNT):
+            graph = graphs[i]
+            t = threading.Thread(target=query_read_timed, args=(graph, q, i, iterations))
+            t.setDaemon(True)
+            threads.append(t)
+            t.start()
+
+        # Wait for threads to return.
+        for i in range(CLIENT_COUNT):
+            t = threads[i]
+            t.join()
+            assert(assertions[i])
+
+        elapsed = time.time() - start
+        read_count = (CLIENT_COUNT - 1) * iterations
+        print "%d concurrent reads alongside %d writes took %f sec (%f reads/sec)" % (read_count, iterations, elapsed, read_count / elapsed)
+
     # Concurrent writes
     def test_03_concurrent_write(self):        
         threads = []
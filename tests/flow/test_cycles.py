@@ -0,0 +1,55 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+redis_graph = None
+
+def redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class GraphCyclesFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "GraphCyclesFlowTest"
+        global redis_graph
+        cls.r = redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph("G", redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        # Triangle a->b->c->a, followed by an open path c->d->e.
+        query = """CREATE (a:node {v:'a'})-[:R]->(b:node {v:'b'})-[:R]->(c:node {v:'c'})-[:R]->(a),
+                          (c)-[:R]->(d:node {v:'d'})-[:R]->(e:node {v:'e'})"""
+        redis_graph.query(query)
+
+    # Closing edge of a cycle is checked rather than traversed.
+    def test01_closed_cycle(self):
+        redis_con = self.r.client()
+        query = """MATCH (x)-[:R]->(y)-[:R]->(z)-[:R]->(x) RETURN x.v, y.v, z.v"""
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", "G", query)
+        assert("Expand Into" in plan)
+
+        actual_result = redis_graph.query(query)
+        rows = sorted(["".join(row) for row in actual_result.result_set[1:]])
+        assert(rows == ["abc", "bca", "cab"])
+
+    def test02_open_path(self):
+        query = """MATCH (x)-[:R]->(y)-[:R]->(z) RETURN x.v, y.v, z.v"""
+        actual_result = redis_graph.query(query)
+        assert(len(actual_result.result_set) - 1 == 5)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,116 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+# import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+redis_graph = None
+people = ["Roi", "Alon", "Ailon", "Boaz", "Tal", "Omri", "Ori"]
+countries = ["Israel", "Japan"]
+
+def redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class GraphEntityCountFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "GraphEntityCountFlowTest"
+        global redis_graph
+        cls.r = redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph("G", redis_con)
+
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        global redis_graph
+
+        people_nodes = []
+        for p in people:
+            node = Node(label="person", properties={"name": p})
+            redis_graph.add_node(node)
+            people_nodes.append(node)
+
+        country_nodes = []
+        for c in countries:
+            node = Node(label="country", properties={"name": c})
+            redis_graph.add_node(node)
+            country_nodes.append(node)
+
+        # Every person knows the next person and visited every country.
+        for i in range(len(people_nodes) - 1):
+            redis_graph.add_edge(Edge(people_nodes[i], "know", people_nodes[i+1]))
+        for p in people_nodes:
+            for c in country_nodes:
+                redis_graph.add_edge(Edge(p, "visit", c))
+
+        redis_graph.commit()
+
+    def _assert_count(self, query, expected):
+        plan = redis_graph.execution_plan(query)
+        self.assertIn('Entity Count', plan)
+        actual_result = redis_graph.query(query)
+        self.assertEqual(int(float(actual_result.result_set[1][0])), expected)
+
+    def test01_count_nodes(self):
+        node_count = len(people) + len(countries)
+        self._assert_count("MATCH (n:person) RETURN count(n)", len(people))
+        self._assert_count("MATCH (n:country) RETURN count(*)", len(countries))
+        self._assert_count("MATCH (n:none) RETURN count(n)", 0)
+        self._assert_count("MATCH (n) RETURN count(n)", node_count)
+
+    def test02_count_edges(self):
+        know_count = len(people) - 1
+        visit_count = len(people) * len(countries)
+        self._assert_count("MATCH ()-[r:know]->() RETURN count(r)", know_count)
+        self._assert_count("MATCH ()<-[r:visit]-() RETURN count(r)", visit_count)
+        self._assert_count("MATCH ()-[r]->() RETURN count(r)", know_count + visit_count)
+        self._assert_count("MATCH ()-[:visit]->() RETURN count(*)", visit_count)
+
+    def test03_counts_not_reduced(self):
+        # Filtered, grouped and property counts are aggregated.
+        queries = ["MATCH (n:person) WHERE n.name = 'Roi' RETURN count(n)",
+                   "MATCH (n:person) RETURN n.name, count(n)",
+                   "MATCH (n:person) RETURN count(n.name)",
+                   "MATCH (n:person)-[:visit]->() RETURN count(n)"]
+        for q in queries:
+            plan = redis_graph.execution_plan(q)
+            self.assertNotIn('Entity Count', plan)
+            self.assertIn('Aggregate', plan)
+
+    def test04_grouped_count(self):
+        # Counts grouped by traversal source are computed from node degrees.
+        query = "MATCH (p:person)-[:visit]->(c) RETURN p.name, count(c) ORDER BY p.name"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn('Expand Count', plan)
+        actual_result = redis_graph.query(query)
+        self.assertEqual(len(actual_result.result_set), len(people) + 1)
+        for i, name in enumerate(sorted(people)):
+            row = actual_result.result_set[i+1]
+            self.assertEqual(row[0], name)
+            self.assertEqual(int(float(row[1])), len(countries))
+
+        # The last person knows no one, and isn't reported.
+        query = "MATCH (p:person)-[r:know]->() RETURN count(r)"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn('Expand Count', plan)
+        actual_result = redis_graph.query(query)
+        self.assertEqual(int(float(actual_result.result_set[1][0])), len(people) - 1)
+
+        query = "MATCH (p:person)-[:visit]->(c) RETURN c.name, count(p)"
+        plan = redis_graph.execution_plan(query)
+        self.assertNotIn('Expand Count', plan)
+
+if __name__ == '__main__':
+    unittest.main()
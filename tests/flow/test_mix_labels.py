@@ -107,5 +107,15 @@ class GraphMixLabelsFlowTest(FlowTestsBase):
         actual_result = redis_graph.query(query)
         assert (len(actual_result.result_set)-1 == (len(male+female) * (len(male+female)-1)))
 
+    # Traversal begins at the filtered node in the middle of the pattern.
+    def test_middle_entry_point(self):
+        query = """MATCH (a)-[:knows]->(b)-[:knows]->(c:female)-[:knows]->(d) WHERE c.name = 'Hila' RETURN a,b,c,d"""
+        plan = redis_graph.execution_plan(query)
+        self.assertIn('Label Scan', plan)
+        self.assertNotIn('All Node Scan', plan)
+        actual_result = redis_graph.query(query)
+        others = len(male + female) - 1
+        assert (len(actual_result.result_set)-1 == others * others * others)
+
 if __name__ == '__main__':
     unittest.main()
@@ -110,5 +110,28 @@ class GraphMultiPatternQueryFlowTest(FlowTestsBase):
             assert (actual_result.properties_set == 4)
             assert (actual_result.nodes_created == 7)
 
+    # Patterns compared by equality are hash joined rather than filtered.
+    def test07_join_patterns(self):
+        redis_con = self.r.client()
+        query = """MATCH (a:person), (b:person) WHERE a.name = b.name RETURN a.name, b.name"""
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", "G", query)
+        assert("Hash Join" in plan)
+        assert("Cartesian Product" not in plan)
+
+        actual_result = redis_graph.query(query)
+        names = sorted([row[0] for row in actual_result.result_set[1:]])
+        assert(names == sorted(people))
+        for row in actual_result.result_set[1:]:
+            assert(row[0] == row[1])
+
+        query = """MATCH (a:person), (b:person), (c:person) WHERE a.name = b.name AND c.name = b.name RETURN count(c)"""
+        actual_result = redis_graph.query(query)
+        assert(int(float(actual_result.result_set[1][0])) == len(people))
+
+        # Nodes missing the joined attribute don't join.
+        query = """MATCH (a:a), (b:a) WHERE a.v = b.v RETURN count(b)"""
+        actual_result = redis_graph.query(query)
+        assert(int(float(actual_result.result_set[1][0])) == 9)
+
 if __name__ == '__main__':
     unittest.main()
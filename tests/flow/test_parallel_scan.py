@@ -0,0 +1,90 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+# import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+redis_graph = None
+node_count = 5000
+group_count = 10
+
+def redis():
+    # Queries scanning over 100 nodes run in parallel.
+    module = os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so'
+    return DisposableRedis(loadmodule=module + ' THREAD_COUNT 4 PARALLEL_THRESHOLD 100')
+
+class GraphParallelScanFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "GraphParallelScanFlowTest"
+        global redis_graph
+        cls.r = redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph("G", redis_con)
+
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        global redis_graph
+        # Person i belongs to group i % group_count and knows person i+1.
+        nodes = []
+        for i in range(node_count):
+            node = Node(label="person", properties={"v": i, "g": i % group_count})
+            redis_graph.add_node(node)
+            nodes.append(node)
+        for i in range(node_count - 1):
+            redis_graph.add_edge(Edge(nodes[i], "know", nodes[i+1]))
+
+        redis_graph.commit()
+
+    def test01_parallel_aggregation(self):
+        query = "MATCH (a:person)-[:know]->(b) WHERE a.v >= 0 RETURN count(b), sum(b.v)"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn('Gather', plan)
+        actual_result = redis_graph.query(query)
+        self.assertEqual(int(float(actual_result.result_set[1][0])), node_count - 1)
+        self.assertEqual(int(float(actual_result.result_set[1][1])), sum(range(1, node_count)))
+
+    def test02_parallel_projection(self):
+        query = "MATCH (n:person) WHERE n.v < 1000 RETURN n.v ORDER BY n.v"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn('Gather', plan)
+        actual_result = redis_graph.query(query)
+        values = [int(float(row[0])) for row in actual_result.result_set[1:]]
+        self.assertEqual(values, range(1000))
+
+    def test03_parallel_grouped_aggregation(self):
+        # Groups are aggregated per worker thread and merged.
+        query = "MATCH (n:person) WHERE n.v >= 0 RETURN n.g, count(n), min(n.v), max(n.v), avg(n.v) ORDER BY n.g"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn('Gather', plan)
+        actual_result = redis_graph.query(query)
+        rows = actual_result.result_set[1:]
+        self.assertEqual(len(rows), group_count)
+        for g in range(group_count):
+            values = range(g, node_count, group_count)
+            row = [float(x) for x in rows[g]]
+            self.assertEqual(row[0], g)
+            self.assertEqual(row[1], len(values))
+            self.assertEqual(row[2], min(values))
+            self.assertEqual(row[3], max(values))
+            self.assertAlmostEqual(row[4], float(sum(values)) / len(values))
+
+    def test04_writes_not_parallelized(self):
+        query = "MATCH (n:person) WHERE n.v < 10 SET n.w = 1"
+        plan = redis_graph.execution_plan(query)
+        self.assertNotIn('Gather', plan)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -202,7 +202,7 @@ class GraphPersistency(FlowTestsBase):
         read_query = """MATCH (a)-[e]->(b) RETURN e, a, b"""
         actual_result = graph.query(read_query)
         expected_result = [['e.val', 'a.name', 'b.name'],
-                           ['1.000000', 'src', 'dest']]
+                           ['1', 'src', 'dest']]
         assert(actual_result.result_set == expected_result)
 
         # Overwrite the existing edge
@@ -213,7 +213,7 @@ class GraphPersistency(FlowTestsBase):
         actual_result = graph.query(read_query)
         # TODO This is the expected current behavior, subject to later change.
         expected_result = [['e.val', 'a.name', 'b.name'],
-                           ['2.000000', 'src', 'dest']]
+                           ['2', 'src', 'dest']]
         assert(actual_result.result_set == expected_result)
 
         # Save RDB & Load from RDB
@@ -223,5 +223,29 @@ class GraphPersistency(FlowTestsBase):
         actual_result = graph.query(read_query)
         assert(actual_result.result_set == expected_result)
 
+    # Verify that setting an attribute more than once
+    # saves and loads a single value for it.
+    def test05_repeated_attributes(self):
+        graphname = "repeated_attributes"
+        graph = Graph(graphname, redis_con)
+        query = """CREATE (:p {v: 'a', v: 'b', w: 'x'})"""
+        actual_result = graph.query(query)
+        assert(actual_result.nodes_created == 1)
+
+        query = """MATCH (p:p) SET p.v = 'c', p.v = 'd'"""
+        actual_result = graph.query(query)
+
+        read_query = """MATCH (p:p) RETURN p.v, p.w"""
+        expected_result = [['p.v', 'p.w'],
+                           ['d', 'x']]
+        actual_result = graph.query(read_query)
+        assert(actual_result.result_set == expected_result)
+
+        # Save RDB & Load from RDB
+        redis_con.execute_command("DEBUG", "RELOAD")
+
+        actual_result = graph.query(read_query)
+        assert(actual_result.result_set == expected_result)
+
 if __name__ == '__main__':
     unittest.main()
@@ -54,7 +54,7 @@ class ValueComparisonTest(FlowTestsBase):
                     ['str2'],
                     ['false'],
                     ['true'],
-                    ['5.000000'],
+                    ['5'],
                     ['10.500000'],
                     ['NULL']]
         assert(actual_result.result_set[1:] == expected)
@@ -76,6 +76,24 @@ class ValueComparisonTest(FlowTestsBase):
         actual_result = redis_graph.query(query)
         assert(actual_result.result_set[1][0] == '10.500000')
 
+    # Integer literals beyond 2^53 are stored and compared without losing precision.
+    def test_integer_precision(self):
+        query = """CREATE (:big {val: 9007199254740993}), (:big {val: 9007199254740992})"""
+        actual_result = redis_graph.query(query)
+        assert(actual_result.nodes_created == 2)
+
+        query = """MATCH (v:big) WHERE v.val > 9007199254740992 RETURN v.val"""
+        actual_result = redis_graph.query(query)
+        assert(actual_result.result_set[1:] == [['9007199254740993']])
+
+        query = """MATCH (v:big) WHERE v.val = 9007199254740993 RETURN v.val"""
+        actual_result = redis_graph.query(query)
+        assert(actual_result.result_set[1:] == [['9007199254740993']])
+
+        query = """MATCH (v:big) WHERE v.val = -9007199254740993 RETURN v.val"""
+        actual_result = redis_graph.query(query)
+        assert(actual_result.result_set[1:] == [])
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -0,0 +1,112 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __PLAN_TEST_H__
+#define __PLAN_TEST_H__
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include "../../src/util/arr.h"
+#include "../../src/util/rmalloc.h"
+#include "../../src/query_executor.h"
+#include "../../src/arithmetic/agg_funcs.h"
+#include "../../src/util/string_dictionary.h"
+#include "../../src/graph/graphcontext.h"
+#include "../../src/execution_plan/execution_plan.h"
+#include "../../src/execution_plan/ops/ops.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+extern pthread_key_t _tlsGCKey;     // Thread local storage graph context key.
+extern pthread_key_t _tlsASTKey;    // Thread local storage AST key.
+
+/* PlanTest
+ * base fixture for tests building execution plans over a graph context,
+ * deriving fixtures populate the graph context from their SetUpTestCase. */
+class PlanTest: public ::testing::Test {
+    protected:
+
+    static void SetUpTestCase() {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+        GxB_Global_Option_set(GxB_FORMAT, GxB_BY_COL); // all matrices in CSC format
+        GxB_Global_Option_set(GxB_HYPER, GxB_NEVER_HYPER); // matrices are never hypersparse
+
+        // Register arithmetic and aggregation functions.
+        AR_RegisterFuncs();
+        Agg_RegisterFuncs();
+
+        ASSERT_EQ(pthread_key_create(&_tlsGCKey, NULL), 0);
+        ASSERT_EQ(pthread_key_create(&_tlsASTKey, NULL), 0);
+    }
+
+    static void TearDownTestCase() {
+        GraphContext *gc = GraphContext_GetFromLTS();
+        for(int i = 0; i < array_len(gc->node_schemas); i++) Schema_Free(gc->node_schemas[i]);
+        for(int i = 0; i < array_len(gc->relation_schemas); i++) Schema_Free(gc->relation_schemas[i]);
+        array_free(gc->node_schemas);
+        array_free(gc->relation_schemas);
+        Schema_Free(gc->node_unified_schema);
+        Schema_Free(gc->relation_unified_schema);
+        StringDictionary_Free(gc->string_dict);
+        if(gc->attribute_strings[SCHEMA_NODE]) array_free(gc->attribute_strings[SCHEMA_NODE]);
+        if(gc->attribute_strings[SCHEMA_EDGE]) array_free(gc->attribute_strings[SCHEMA_EDGE]);
+        Graph_Free(gc->g);
+        free(gc);
+        GrB_finalize();
+    }
+
+    // Creates an empty graph context and sets it as the thread's graph context.
+    static GraphContext* _new_graph_context(size_t node_cap, size_t edge_cap) {
+        GraphContext *gc = (GraphContext*)calloc(1, sizeof(GraphContext));
+        gc->g = Graph_New(node_cap, edge_cap);
+        gc->node_unified_schema = Schema_New("ALL", GRAPH_NO_LABEL);
+        gc->relation_unified_schema = Schema_New("ALL", GRAPH_NO_RELATION);
+        gc->node_schemas = (Schema**)array_new(Schema*, 1);
+        gc->relation_schemas = (Schema**)array_new(Schema*, 1);
+        gc->string_dict = StringDictionary_New();
+        pthread_setspecific(_tlsGCKey, gc);
+        return gc;
+    }
+
+    static ExecutionPlan* _build_plan(const char *query) {
+        char *errMsg;
+        GraphContext *gc = GraphContext_GetFromLTS();
+        AST *ast = ParseQuery(query, strlen(query), &errMsg);
+        pthread_setspecific(_tlsASTKey, ast);
+        ModifyAST(gc, ast);
+        return NewExecutionPlan(NULL, gc, ast, true);
+    }
+
+    static void _free_plan(ExecutionPlan *plan) {
+        AST *ast = AST_GetFromLTS();
+        ExecutionPlanFree(plan);
+        AST_Free(ast);
+    }
+
+    // First operation of type within op's subtree, NULL if there's none.
+    static OpBase* _locate_op(OpBase *op, OPType type) {
+        if(op->type == type) return op;
+        for(int i = 0; i < op->childCount; i++) {
+            OpBase *located = _locate_op(op->children[i], type);
+            if(located) return located;
+        }
+        return NULL;
+    }
+};
+
+#endif
@@ -14,6 +14,8 @@ extern "C" {
 #include "../../src/util/rmalloc.h"
 #include "../../src/query_executor.h"
 #include "../../src/arithmetic/agg_funcs.h"
+#include "../../src/arithmetic/aggregate.h"
+#include "../../src/arithmetic/repository.h"
 #include "../../src/execution_plan/record.h"
 #include "../../src/arithmetic/arithmetic_expression.h"
 
@@ -99,6 +101,43 @@ TEST_F(AggregateTest, PartialCountTest) {
   AR_EXP_Free(arExp);
 }
 
+// Aggregates values [from, to) using function func.
+static AggCtx* _partial_aggregation(const char *func, int from, int to) {
+  AggCtx *ctx;
+  Agg_GetFunc(func, &ctx);
+  for (int i = from; i < to; i ++) {
+    SIValue v = SI_DoubleVal(i);
+    Agg_Step(ctx, &v, 1);
+  }
+  return ctx;
+}
+
+// Combining partial aggregations matches aggregating all values at once.
+TEST_F(AggregateTest, CombineTest) {
+  const char *funcs[] = {"sum", "count", "avg", "min", "max", "stDev", "stDevP"};
+  int num_values = 100;
+
+  for (int i = 0; i < sizeof(funcs) / sizeof(funcs[0]); i ++) {
+    AggCtx *expected = _partial_aggregation(funcs[i], 0, num_values);
+    Agg_Finalize(expected);
+
+    // Values are split among three partial aggregations, one of which is empty.
+    AggCtx *combined = _partial_aggregation(funcs[i], 40, num_values);
+    AggCtx *first = _partial_aggregation(funcs[i], 0, 40);
+    AggCtx *empty = _partial_aggregation(funcs[i], 0, 0);
+    Agg_Combine(combined, empty);
+    Agg_Combine(combined, first);
+    Agg_Finalize(combined);
+
+    ASSERT_DOUBLE_EQ(combined->result.doubleval, expected->result.doubleval) << funcs[i];
+
+    AggCtx_Free(expected);
+    AggCtx_Free(combined);
+    AggCtx_Free(first);
+    AggCtx_Free(empty);
+  }
+}
+
 // TEST_F(AggregateTest, PercentileContTest) {
 //   // Percentiles to check
 //   AR_ExpNode *zero = AR_EXP_NewConstOperandNode(SI_DoubleVal(0));
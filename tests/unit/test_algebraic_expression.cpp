@@ -905,3 +905,342 @@ TEST_F(AlgebraicExpressionTest, ExpressionExecute) {
     GrB_Matrix_free(&expected);
     GrB_Matrix_free(&res);
 }
+
+/* Graph of node_count nodes, a quarter of which are labeled L2 (label 1),
+ * the remaining nodes are labeled L1 (label 0),
+ * each node is connected to three other nodes via relation R (relation 0). */
+static Graph *_build_large_graph(size_t node_count) {
+    Graph *g = Graph_New(node_count, node_count);
+    Graph_SetMatrixPolicy(g, RESIZE_TO_CAPACITY);
+    int l1 = Graph_AddLabel(g);
+    int l2 = Graph_AddLabel(g);
+    int r = Graph_AddRelationType(g);
+    Graph_AllocateNodes(g, node_count);
+
+    Node n;
+    for(size_t i = 0; i < node_count; i++) {
+        Graph_CreateNode(g, (i % 4 == 1) ? l2 : l1, &n);
+    }
+
+    Edge e;
+    for(size_t i = 0; i < node_count; i++) {
+        Graph_ConnectNodes(g, i, (i + 1) % node_count, r, &e);
+        Graph_ConnectNodes(g, i, (i * 7 + 3) % node_count, r, &e);
+        Graph_ConnectNodes(g, i, (i * 13 + 5) % node_count, r, &e);
+    }
+    Graph_SetMatrixPolicy(g, SYNC_AND_MINIMIZE_SPACE);
+    Graph_ApplyAllPending(g);
+    return g;
+}
+
+TEST_F(AlgebraicExpressionTest, LabelRowMask) {
+    /* MATCH (a:L1)-[r:R]->(b:L2)
+     * compare applying b's label as a row mask
+     * against multiplying by its diagonal label matrix. */
+    size_t node_count = 200000;
+    Graph *bg = _build_large_graph(node_count);
+    int l1 = 0;
+    int l2 = 1;
+    int r = 0;
+
+    QueryGraph *q = QueryGraph_New(2, 1);
+    Node *a = Node_New("L1", "a");
+    Node *b = Node_New("L2", "b");
+    Edge *ar = Edge_New(a, b, "R", "r");
+    a->mat = Graph_GetLabel(bg, l1);
+    b->mat = Graph_GetLabel(bg, l2);
+    ar->mat = Graph_GetRelationMatrix(bg, r);
+    QueryGraph_AddNode(q, a, (char*)"a");
+    QueryGraph_AddNode(q, b, (char*)"b");
+    QueryGraph_ConnectNodes(q, a, b, ar, (char*)"r");
+
+    const char *query = "MATCH (a:L1)-[r:R]->(b:L2) RETURN a, b";
+    AST *ast = ParseQuery(query, strlen(query), NULL);
+    size_t exp_count = 0;
+    AlgebraicExpression **ae = AlgebraicExpression_From_Query(ast, ast->matchNode->_mergedPatterns, q, &exp_count);
+    ASSERT_EQ(exp_count, 1);
+    AlgebraicExpression *exp = ae[0];
+    ASSERT_EQ(exp->operand_count, 3);
+    // Destination label leads the expression.
+    ASSERT_TRUE(exp->operands[0].diagonal);
+    ASSERT_EQ(exp->operands[0].operand, b->mat);
+
+    GrB_Index dim = Graph_RequiredMatrixDim(bg);
+    GrB_Matrix masked;
+    GrB_Matrix multiplied;
+    GrB_Matrix_new(&masked, GrB_BOOL, dim, dim);
+    GrB_Matrix_new(&multiplied, GrB_BOOL, dim, dim);
+
+    // Repeated evaluations, as performed by a traversal.
+    int iterations = 10;
+    double tic[2];
+    exp->operands[0].diagonal = false;
+    simple_tic(tic);
+    for(int i = 0; i < iterations; i++) AlgebraicExpression_Execute(exp, multiplied);
+    double mul_time = simple_toc(tic) / iterations;
+
+    exp->operands[0].diagonal = true;
+    simple_tic(tic);
+    for(int i = 0; i < iterations; i++) AlgebraicExpression_Execute(exp, masked);
+    double mask_time = simple_toc(tic) / iterations;
+
+    // Both evaluations produce the same matrix.
+    GrB_Index masked_nvals;
+    GrB_Index multiplied_nvals;
+    GrB_Index common_nvals;
+    GrB_Matrix_nvals(&masked_nvals, masked);
+    GrB_Matrix_nvals(&multiplied_nvals, multiplied);
+    ASSERT_GT(masked_nvals, 0);
+    ASSERT_EQ(masked_nvals, multiplied_nvals);
+    GrB_eWiseMult_Matrix_Semiring(masked, NULL, NULL, GxB_LOR_LAND_BOOL, masked, multiplied, NULL);
+    GrB_Matrix_nvals(&common_nvals, masked);
+    ASSERT_EQ(common_nvals, multiplied_nvals);
+
+    printf("(a:L1)-[:R]->(b:L2) %zu nodes, label multiplication: %.6f sec, row mask: %.6f sec\n",
+           node_count, mul_time, mask_time);
+
+    AST_Free(ast);
+    AlgebraicExpression_Free(exp);
+    free(ae);
+    QueryGraph_Free(q);
+    GrB_Matrix_free(&masked);
+    GrB_Matrix_free(&multiplied);
+    Graph_Free(bg);
+}
+
+TEST_F(AlgebraicExpressionTest, LabelRowMaskMembership) {
+    /* MATCH (a:L1)-[r:R]->(b:L2)
+     * row mask must follow label membership changes
+     * which leave the label's entry count as is. */
+    size_t node_count = 8;
+    Graph *bg = _build_large_graph(node_count);
+    int l1 = 0;
+    int l2 = 1;
+    int r = 0;
+
+    QueryGraph *q = QueryGraph_New(2, 1);
+    Node *a = Node_New("L1", "a");
+    Node *b = Node_New("L2", "b");
+    Edge *ar = Edge_New(a, b, "R", "r");
+    a->mat = Graph_GetLabel(bg, l1);
+    b->mat = Graph_GetLabel(bg, l2);
+    ar->mat = Graph_GetRelationMatrix(bg, r);
+    QueryGraph_AddNode(q, a, (char*)"a");
+    QueryGraph_AddNode(q, b, (char*)"b");
+    QueryGraph_ConnectNodes(q, a, b, ar, (char*)"r");
+
+    const char *query = "MATCH (a:L1)-[r:R]->(b:L2) RETURN a, b";
+    AST *ast = ParseQuery(query, strlen(query), NULL);
+    size_t exp_count = 0;
+    AlgebraicExpression **ae = AlgebraicExpression_From_Query(ast, ast->matchNode->_mergedPatterns, q, &exp_count);
+    AlgebraicExpression *exp = ae[0];
+    ASSERT_TRUE(exp->operands[0].diagonal);
+    exp->graph = bg;
+
+    GrB_Index dim = Graph_RequiredMatrixDim(bg);
+    GrB_Matrix masked;
+    GrB_Matrix multiplied;
+    GrB_Matrix_new(&masked, GrB_BOOL, dim, dim);
+    GrB_Matrix_new(&multiplied, GrB_BOOL, dim, dim);
+
+    // Build row mask, L2 = {1, 5}.
+    AlgebraicExpression_Execute(exp, masked);
+
+    // Node 1 (L2) and node 2 (L1) exchange labels as their IDs are reused.
+    Node deleted[2];
+    Graph_GetNode(bg, 1, &deleted[0]);
+    Graph_GetNode(bg, 2, &deleted[1]);
+    Graph_BulkDelete(bg, deleted, 2, NULL, 0, NULL, NULL);
+    Node n;
+    Edge e;
+    Graph_CreateNode(bg, l2, &n);
+    ASSERT_EQ(ENTITY_GET_ID(&n), 2);
+    Graph_CreateNode(bg, l1, &n);
+    ASSERT_EQ(ENTITY_GET_ID(&n), 1);
+    Graph_ConnectNodes(bg, 0, 2, r, &e);
+    Graph_ConnectNodes(bg, 3, 1, r, &e);
+    Graph_ApplyAllPending(bg);
+    ASSERT_EQ(Graph_RequiredMatrixDim(bg), dim);
+
+    exp->operands[0].diagonal = false;
+    AlgebraicExpression_Execute(exp, multiplied);
+    exp->operands[0].diagonal = true;
+    AlgebraicExpression_Execute(exp, masked);
+
+    bool x;
+    ASSERT_EQ(GrB_Matrix_extractElement_BOOL(&x, masked, 2, 0), GrB_SUCCESS);
+    ASSERT_EQ(GrB_Matrix_extractElement_BOOL(&x, masked, 1, 3), GrB_NO_VALUE);
+
+    GrB_Index masked_nvals;
+    GrB_Index multiplied_nvals;
+    GrB_Index common_nvals;
+    GrB_Matrix_nvals(&masked_nvals, masked);
+    GrB_Matrix_nvals(&multiplied_nvals, multiplied);
+    ASSERT_EQ(masked_nvals, multiplied_nvals);
+    GrB_eWiseMult_Matrix_Semiring(masked, NULL, NULL, GxB_LOR_LAND_BOOL, masked, multiplied, NULL);
+    GrB_Matrix_nvals(&common_nvals, masked);
+    ASSERT_EQ(common_nvals, multiplied_nvals);
+
+    AST_Free(ast);
+    AlgebraicExpression_Free(exp);
+    free(ae);
+    QueryGraph_Free(q);
+    GrB_Matrix_free(&masked);
+    GrB_Matrix_free(&multiplied);
+    Graph_Free(bg);
+}
+
+TEST_F(AlgebraicExpressionTest, CachedProduct) {
+    /* MATCH (a)-[r1:R]->(m:L2)-[r2:R]->(b)
+     * traversed batch by batch, as done by Conditional Traverse,
+     * with and without caching the expression's product. */
+    size_t node_count = 200000;
+    Graph *bg = _build_large_graph(node_count);
+
+    QueryGraph *q = QueryGraph_New(3, 2);
+    Node *a = Node_New(NULL, "a");
+    Node *m = Node_New("L2", "m");
+    Node *b = Node_New(NULL, "b");
+    Edge *r1 = Edge_New(a, m, "R", "r1");
+    Edge *r2 = Edge_New(m, b, "R", "r2");
+    m->mat = Graph_GetLabel(bg, 1);
+    r1->mat = Graph_GetRelationMatrix(bg, 0);
+    r2->mat = Graph_GetRelationMatrix(bg, 0);
+    QueryGraph_AddNode(q, a, (char*)"a");
+    QueryGraph_AddNode(q, m, (char*)"m");
+    QueryGraph_AddNode(q, b, (char*)"b");
+    QueryGraph_ConnectNodes(q, a, m, r1, (char*)"r1");
+    QueryGraph_ConnectNodes(q, m, b, r2, (char*)"r2");
+
+    const char *query = "MATCH (a)-[r1:R]->(m:L2)-[r2:R]->(b) RETURN a, b";
+    AST *ast = ParseQuery(query, strlen(query), NULL);
+    size_t exp_count = 0;
+    AlgebraicExpression **ae = AlgebraicExpression_From_Query(ast, ast->matchNode->_mergedPatterns, q, &exp_count);
+    ASSERT_EQ(exp_count, 1);
+    AlgebraicExpression *exp = ae[0];
+    ASSERT_EQ(exp->operand_count, 3);
+
+    GrB_Index dim = Graph_RequiredMatrixDim(bg);
+    GrB_Index batch = 16;
+    GrB_Index batches = 12500;
+    GrB_Matrix F;
+    GrB_Matrix cached;
+    GrB_Matrix evaluated;
+    GrB_Matrix_new(&F, GrB_BOOL, dim, batch);
+    GrB_Matrix_new(&cached, GrB_BOOL, dim, batch);
+    GrB_Matrix_new(&evaluated, GrB_BOOL, dim, batch);
+
+    double tic[2];
+    double cached_time = 0;
+    double evaluated_time = 0;
+    for(GrB_Index i = 0; i < batches; i++) {
+        GrB_Matrix_clear(F);
+        for(GrB_Index j = 0; j < batch; j++) {
+            GrB_Matrix_setElement_BOOL(F, true, (i * batch + j) % dim, j);
+        }
+
+        // Full evaluation.
+        simple_tic(tic);
+        AlgebraicExpression_AppendTerm(exp, F, false, false);
+        AlgebraicExpression_Execute(exp, evaluated);
+        AlgebraicExpression_RemoveTerm(exp, exp->operand_count-1, NULL);
+        evaluated_time += simple_toc(tic);
+
+        // Product is cached after a few calls.
+        simple_tic(tic);
+        AlgebraicExpression_MultiplyRight(exp, F, cached);
+        cached_time += simple_toc(tic);
+
+        GrB_Index cached_nvals;
+        GrB_Index evaluated_nvals;
+        GrB_Index common_nvals;
+        GrB_Matrix_nvals(&cached_nvals, cached);
+        GrB_Matrix_nvals(&evaluated_nvals, evaluated);
+        ASSERT_EQ(cached_nvals, evaluated_nvals);
+        GrB_eWiseMult_Matrix_Semiring(cached, NULL, NULL, GxB_LOR_LAND_BOOL, cached, evaluated, NULL);
+        GrB_Matrix_nvals(&common_nvals, cached);
+        ASSERT_EQ(common_nvals, evaluated_nvals);
+    }
+
+    ASSERT_TRUE(exp->product != NULL);
+    printf("(a)-[:R]->(:L2)-[:R]->(b) %llu batches of %llu records, evaluated: %.6f sec, cached: %.6f sec\n",
+           batches, batch, evaluated_time, cached_time);
+
+    AST_Free(ast);
+    AlgebraicExpression_Free(exp);
+    free(ae);
+    QueryGraph_Free(q);
+    GrB_Matrix_free(&F);
+    GrB_Matrix_free(&cached);
+    GrB_Matrix_free(&evaluated);
+    Graph_Free(bg);
+}
+
+TEST_F(AlgebraicExpressionTest, OversizedProduct) {
+    /* MATCH (a)-[r1:R]->(m)-[r2:R]->(b)
+     * over a star graph, every leaf reaches every other leaf through the hub,
+     * the product outgrows its operands and should never be retained. */
+    size_t node_count = 64;
+    Graph *sg = Graph_New(node_count, node_count);
+    int r = Graph_AddRelationType(sg);
+    Graph_AllocateNodes(sg, node_count);
+
+    Node n;
+    for(size_t i = 0; i < node_count; i++) Graph_CreateNode(sg, GRAPH_NO_LABEL, &n);
+
+    Edge e;
+    for(size_t i = 1; i < node_count; i++) {
+        Graph_ConnectNodes(sg, i, 0, r, &e);
+        Graph_ConnectNodes(sg, 0, i, r, &e);
+    }
+
+    QueryGraph *q = QueryGraph_New(3, 2);
+    Node *a = Node_New(NULL, "a");
+    Node *m = Node_New(NULL, "m");
+    Node *b = Node_New(NULL, "b");
+    Edge *r1 = Edge_New(a, m, "R", "r1");
+    Edge *r2 = Edge_New(m, b, "R", "r2");
+    r1->mat = Graph_GetRelationMatrix(sg, r);
+    r2->mat = Graph_GetRelationMatrix(sg, r);
+    QueryGraph_AddNode(q, a, (char*)"a");
+    QueryGraph_AddNode(q, m, (char*)"m");
+    QueryGraph_AddNode(q, b, (char*)"b");
+    QueryGraph_ConnectNodes(q, a, m, r1, (char*)"r1");
+    QueryGraph_ConnectNodes(q, m, b, r2, (char*)"r2");
+
+    const char *query = "MATCH (a)-[r1:R]->(m)-[r2:R]->(b) RETURN a, b";
+    AST *ast = ParseQuery(query, strlen(query), NULL);
+    size_t exp_count = 0;
+    AlgebraicExpression **ae = AlgebraicExpression_From_Query(ast, ast->matchNode->_mergedPatterns, q, &exp_count);
+    ASSERT_EQ(exp_count, 1);
+    AlgebraicExpression *exp = ae[0];
+    ASSERT_EQ(exp->operand_count, 2);
+
+    GrB_Index dim = Graph_RequiredMatrixDim(sg);
+    GrB_Matrix F;
+    GrB_Matrix res;
+    GrB_Matrix_new(&F, GrB_BOOL, dim, 1);
+    GrB_Matrix_new(&res, GrB_BOOL, dim, 1);
+    GrB_Matrix_setElement_BOOL(F, true, 1, 0);
+
+    // Enough calls for the product to be considered for caching.
+    for(int i = 0; i < 8; i++) {
+        AlgebraicExpression_MultiplyRight(exp, F, res);
+
+        // Leaf 1 reaches every leaf, itself included, through the hub.
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, res);
+        ASSERT_EQ(nvals, node_count - 1);
+    }
+
+    ASSERT_TRUE(exp->cacheDisabled);
+    ASSERT_TRUE(exp->product == NULL);
+
+    AST_Free(ast);
+    AlgebraicExpression_Free(exp);
+    free(ae);
+    QueryGraph_Free(q);
+    GrB_Matrix_free(&F);
+    GrB_Matrix_free(&res);
+    Graph_Free(sg);
+}
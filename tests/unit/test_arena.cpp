@@ -0,0 +1,137 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include "../../src/util/arena.h"
+#include "../../src/util/rmalloc.h"
+#include "../../src/execution_plan/record.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class ArenaTest: public ::testing::Test {
+    protected:
+
+    static void SetUpTestCase() {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+    }
+
+    void TearDown() {
+        Arena_SetCurrent(NULL);
+    }
+};
+
+TEST_F(ArenaTest, AllocRelease) {
+    Arena *arena = Arena_New();
+    ASSERT_EQ(Arena_AllocatedBytes(arena), 0);
+
+    char *a = (char*)Arena_Alloc(arena, 24);
+    char *b = (char*)Arena_Alloc(arena, 24);
+    ASSERT_EQ((uintptr_t)a % 16, 0);
+    ASSERT_EQ((uintptr_t)b % 16, 0);
+    ASSERT_NE(a, b);
+    size_t allocated = Arena_AllocatedBytes(arena);
+    ASSERT_GT(allocated, 0);
+
+    // Releasing last allocation rolls back the bump pointer.
+    Arena_Release(arena, b, 24);
+    char *c = (char*)Arena_Alloc(arena, 24);
+    ASSERT_EQ(b, c);
+
+    // Released chunks are reused by same sized allocations.
+    Arena_Release(arena, a, 24);
+    char *d = (char*)Arena_Alloc(arena, 20);
+    ASSERT_EQ(a, d);
+
+    // No additional memory was reserved.
+    ASSERT_EQ(Arena_AllocatedBytes(arena), allocated);
+
+    int *zeros = (int*)Arena_Calloc(arena, 8, sizeof(int));
+    for(int i = 0; i < 8; i++) ASSERT_EQ(zeros[i], 0);
+
+    Arena_Free(arena);
+}
+
+TEST_F(ArenaTest, Realloc) {
+    Arena *arena = Arena_New();
+
+    int *arr = (int*)Arena_Alloc(arena, 4 * sizeof(int));
+    for(int i = 0; i < 4; i++) arr[i] = i;
+
+    // Last allocation grows in place.
+    int *grown = (int*)Arena_Realloc(arena, arr, 4 * sizeof(int), 16 * sizeof(int));
+    ASSERT_EQ(arr, grown);
+
+    // Once followed by another allocation, realloc moves data.
+    Arena_Alloc(arena, 8);
+    int *moved = (int*)Arena_Realloc(arena, grown, 16 * sizeof(int), 64 * sizeof(int));
+    ASSERT_NE(grown, moved);
+    for(int i = 0; i < 4; i++) ASSERT_EQ(moved[i], i);
+
+    Arena_Free(arena);
+}
+
+TEST_F(ArenaTest, LargeAllocation) {
+    Arena *arena = Arena_New();
+
+    char *small = (char*)Arena_Alloc(arena, 32);
+    size_t allocated = Arena_AllocatedBytes(arena);
+
+    // Large allocations get a dedicated block.
+    size_t large_size = 1024 * 1024;
+    char *large = (char*)Arena_Alloc(arena, large_size);
+    memset(large, 1, large_size);
+    ASSERT_GE(Arena_AllocatedBytes(arena), allocated + large_size);
+
+    // Current block remains in use.
+    char *next = (char*)Arena_Alloc(arena, 32);
+    ASSERT_EQ(small + 32, next);
+
+    Arena_Free(arena);
+}
+
+TEST_F(ArenaTest, NullArena) {
+    // Without an arena allocations are served by rm_malloc.
+    void *p = Arena_Alloc(NULL, 64);
+    p = Arena_Realloc(NULL, p, 64, 128);
+    Arena_Release(NULL, p, 128);
+    ASSERT_TRUE(Arena_GetCurrent() == NULL);
+}
+
+TEST_F(ArenaTest, RecordAllocation) {
+    Arena *arena = Arena_New();
+    Arena_SetCurrent(arena);
+    ASSERT_EQ(Arena_GetCurrent(), arena);
+
+    Record r = Record_New(4);
+    ASSERT_EQ(Record_length(r), 4);
+    ASSERT_GT(Arena_AllocatedBytes(arena), 0);
+    Record_AddScalar(r, 0, SI_LongVal(7));
+    ASSERT_EQ(Record_GetScalar(r, 0).longval, 7);
+
+    // Freed record memory is reused.
+    Record_Free(r);
+    Record s = Record_New(4);
+    ASSERT_EQ(r, s);
+    Record_Free(s);
+
+    Arena_SetCurrent(NULL);
+    Arena_Free(arena);
+
+    // Records created without an arena are heap allocated.
+    r = Record_New(2);
+    ASSERT_EQ(Record_length(r), 2);
+    Record_Free(r);
+}
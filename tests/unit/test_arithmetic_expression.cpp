@@ -46,6 +46,13 @@ void _test_string(const AR_ExpNode *exp, const char *expected) {
 
 void _test_ar_func(AR_ExpNode *root, SIValue expected, const Record r) {
   SIValue res = AR_EXP_Evaluate(root, r);
+  // Integer literals evaluate to integers, compare numeric values.
+  if(SI_TYPE(res) & SI_NUMERIC) {
+    double d;
+    SIValue_ToDouble(&res, &d);
+    ASSERT_EQ(d, expected.doubleval);
+    return;
+  }
   ASSERT_EQ(res.doubleval, expected.doubleval);
 }
 
@@ -80,28 +87,28 @@ TEST_F(ArithmeticTest, ExpressionTest) {
   arExp = _exp_from_query(query);
   result = AR_EXP_Evaluate(arExp, r);
   AR_EXP_Free(arExp);
-  ASSERT_EQ(result.doubleval, 1);
+  ASSERT_EQ(result.longval, 1);
 
   /* 1+2*3 */
   query = "RETURN 1+2*3";
   arExp = _exp_from_query(query);
   result = AR_EXP_Evaluate(arExp, r);
   AR_EXP_Free(arExp);
-  ASSERT_EQ(result.doubleval, 7);
+  ASSERT_EQ(result.longval, 7);
 
   /* 1 + 1 + 1 + 1 + 1 + 1 */
   query = "RETURN 1 + 1 + 1 + 1 + 1 + 1";
   arExp = _exp_from_query(query);
   result = AR_EXP_Evaluate(arExp, r);
   AR_EXP_Free(arExp);
-  ASSERT_EQ(result.doubleval, 6);
+  ASSERT_EQ(result.longval, 6);
 
   /* ABS(-5 + 2 * 1) */
   query = "RETURN ABS(-5 + 2 * 1)";
   arExp = _exp_from_query(query);
   result = AR_EXP_Evaluate(arExp, r);
   AR_EXP_Free(arExp);
-  ASSERT_EQ(result.doubleval, 3);
+  ASSERT_EQ(result.longval, 3);
 
   /* 'a' + 'b' */
   query = "RETURN 'a' + 'b'";
@@ -115,14 +122,14 @@ TEST_F(ArithmeticTest, ExpressionTest) {
   arExp = _exp_from_query(query);
   result = AR_EXP_Evaluate(arExp, r);
   AR_EXP_Free(arExp);
-  ASSERT_TRUE(strcmp(result.stringval, "3.000000a2.0000001.000000") == 0);
+  ASSERT_TRUE(strcmp(result.stringval, "3a21") == 0);
 
   /* 2 * 2 + 'a' + 3 * 3 */
   query = "RETURN 2 * 2 + 'a' + 3 * 3";
   arExp = _exp_from_query(query);
   result = AR_EXP_Evaluate(arExp, r);
   AR_EXP_Free(arExp);
-  ASSERT_TRUE(strcmp(result.stringval, "4.000000a9.000000") == 0);
+  ASSERT_TRUE(strcmp(result.stringval, "4a9") == 0);
 }
 
 TEST_F(ArithmeticTest, AggregateTest) {
@@ -697,3 +704,40 @@ TEST_F(ArithmeticTest, ToStringTest) {
   AR_EXP_Free(arExp);
   ASSERT_EQ(result.type, T_NULL);
 }
+
+TEST_F(ArithmeticTest, Int64Test) {
+  SIValue result;
+  // 2^53 + 1 can't be represented as a double.
+  int64_t big = 9007199254740993LL;
+
+  /* Integer operands yield an integer. */
+  SIValue args[2] = {SI_LongVal(big), SI_LongVal(2)};
+  result = AR_ADD(args, 2);
+  ASSERT_EQ(result.type, T_INT64);
+  ASSERT_EQ(result.longval, big + 2);
+
+  result = AR_SUB(args, 2);
+  ASSERT_EQ(result.type, T_INT64);
+  ASSERT_EQ(result.longval, big - 2);
+
+  result = AR_MUL(args, 2);
+  ASSERT_EQ(result.type, T_INT64);
+  ASSERT_EQ(result.longval, big * 2);
+
+  result = AR_DIV(args, 2);
+  ASSERT_EQ(result.type, T_INT64);
+  ASSERT_EQ(result.longval, big / 2);
+
+  /* Mixed operands yield a double. */
+  args[1] = SI_DoubleVal(0.5);
+  result = AR_ADD(args, 2);
+  ASSERT_EQ(result.type, T_DOUBLE);
+
+  args[0] = SI_LongVal(-big);
+  result = AR_ABS(args, 1);
+  ASSERT_EQ(result.type, T_INT64);
+  ASSERT_EQ(result.longval, big);
+
+  result = AR_ROUND(args, 1);
+  ASSERT_EQ(result.longval, -big);
+}
@@ -0,0 +1,103 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "plan_test.h"
+
+#define A_COUNT 3
+#define B_COUNT 4
+#define C_COUNT 5
+
+class CartesianProductTest: public PlanTest {
+    protected:
+
+    static void SetUpTestCase() {
+        PlanTest::SetUpTestCase();
+        _build_graph_context();
+    }
+
+    /* Graph context holding A_COUNT nodes labeled A,
+     * followed by B_COUNT nodes labeled B and C_COUNT nodes labeled C. */
+    static void _build_graph_context() {
+        GraphContext *gc = _new_graph_context(A_COUNT + B_COUNT + C_COUNT, 1);
+
+        Schema *a = GraphContext_AddSchema(gc, "A", SCHEMA_NODE);
+        Schema *b = GraphContext_AddSchema(gc, "B", SCHEMA_NODE);
+        Schema *c = GraphContext_AddSchema(gc, "C", SCHEMA_NODE);
+
+        Node n;
+        Graph_AllocateNodes(gc->g, A_COUNT + B_COUNT + C_COUNT);
+        for(int i = 0; i < A_COUNT; i++) Graph_CreateNode(gc->g, a->id, &n);
+        for(int i = 0; i < B_COUNT; i++) Graph_CreateNode(gc->g, b->id, &n);
+        for(int i = 0; i < C_COUNT; i++) Graph_CreateNode(gc->g, c->id, &n);
+    }
+
+    /* Validates op produces every combination of A, B and C nodes
+     * exactly once, returns the number of records. */
+    static int _validate_product(OpBase *op) {
+        AST *ast = AST_GetFromLTS();
+        int aIdx = AST_GetAliasID(ast, "a");
+        int bIdx = AST_GetAliasID(ast, "b");
+        int cIdx = AST_GetAliasID(ast, "c");
+        bool seen[A_COUNT][B_COUNT][C_COUNT] = {{{false}}};
+        int records = 0;
+        Record r;
+        while((r = op->consume(op))) {
+            NodeID a = ENTITY_GET_ID(Record_GetNode(r, aIdx));
+            NodeID b = ENTITY_GET_ID(Record_GetNode(r, bIdx)) - A_COUNT;
+            NodeID c = ENTITY_GET_ID(Record_GetNode(r, cIdx)) - A_COUNT - B_COUNT;
+            EXPECT_LT(a, A_COUNT);
+            EXPECT_LT(b, B_COUNT);
+            EXPECT_LT(c, C_COUNT);
+            EXPECT_FALSE(seen[a][b][c]);
+            seen[a][b][c] = true;
+            Record_Free(r);
+            records++;
+        }
+        return records;
+    }
+};
+
+TEST_F(CartesianProductTest, BufferedStreams) {
+    ExecutionPlan *plan = _build_plan("MATCH (a:A), (b:B), (c:C) RETURN a, b, c");
+    OpBase *op = _locate_op(plan->root, OPType_CARTESIAN_PRODUCT);
+    ASSERT_TRUE(op != NULL);
+    ASSERT_EQ(op->childCount, 3);
+    CartesianProduct *cp = (CartesianProduct*)op;
+
+    ASSERT_EQ(_validate_product(op), A_COUNT * B_COUNT * C_COUNT);
+    // Every stream but the last was buffered.
+    ASSERT_TRUE(cp->streams[0].buffered);
+    ASSERT_TRUE(cp->streams[1].buffered);
+    ASSERT_FALSE(cp->streams[2].buffered);
+    ASSERT_EQ(array_len(cp->streams[2].records), 0);
+
+    // Reset discards buffered records, execution restarts.
+    OpBase_Reset(op);
+    ASSERT_EQ(_validate_product(op), A_COUNT * B_COUNT * C_COUNT);
+    _free_plan(plan);
+}
+
+TEST_F(CartesianProductTest, BufferCapExceeded) {
+    ExecutionPlan *plan = _build_plan("MATCH (a:A), (b:B), (c:C) RETURN a, b, c");
+    OpBase *op = _locate_op(plan->root, OPType_CARTESIAN_PRODUCT);
+    ASSERT_TRUE(op != NULL);
+    CartesianProduct *cp = (CartesianProduct*)op;
+
+    // Streams producing more records than cap are re-executed.
+    cp->bufferCap = 3;
+    ASSERT_EQ(_validate_product(op), A_COUNT * B_COUNT * C_COUNT);
+    int buffered = 0;
+    int reexecuted = 0;
+    for(int i = 0; i < 2; i++) {
+        if(cp->streams[i].buffered) buffered++;
+        else reexecuted++;
+        ASSERT_LE(array_len(cp->streams[i].records), 3);
+    }
+    ASSERT_EQ(buffered, 1);
+    ASSERT_EQ(reexecuted, 1);
+    _free_plan(plan);
+}
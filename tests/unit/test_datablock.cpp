@@ -151,12 +151,12 @@ TEST_F(DataBlockTest, RemoveItem) {
     ASSERT_EQ(*item, 0);
 
     // Remove item at position 0 and perform validations
-    // A DELETED_MARKER should mark cell as deleted
+    // Cell's occupancy bit should be cleared
     // Index 0 should be added to datablock deletedIdx array.
     DataBlock_DeleteItem(dataBlock, 0);
     ASSERT_EQ(dataBlock->itemCount, itemCount-1);
     ASSERT_EQ(array_len(dataBlock->deletedIdx), 1);
-    ASSERT_TRUE((char)dataBlock->blocks[0]->data[0] && (char)DELETED_MARKER);
+    ASSERT_FALSE(BLOCK_ITEM_OCCUPIED(dataBlock->blocks[0], 0));
 
     // Try to get item from deleted cell.
     item = (int*)DataBlock_GetItem(dataBlock, 0);
@@ -187,3 +187,37 @@ TEST_F(DataBlockTest, RemoveItem) {
     // Cleanup.
     DataBlock_Free(dataBlock);
 }
+
+TEST_F(DataBlockTest, ScanSparse) {
+    // Spread items over multiple blocks and delete most of them,
+    // scan should visit only remaining items, in order.
+    uint itemCount = BLOCK_CAP * 2 + 100;
+    DataBlock *dataBlock = DataBlock_New(itemCount, sizeof(int));
+
+    for(int i = 0 ; i < itemCount; i++) {
+        int *item = (int *)DataBlock_AllocateItem(dataBlock, NULL);
+        *item = i;
+    }
+
+    // Keep every 1000th item.
+    for(int i = 0 ; i < itemCount; i++) {
+        if(i % 1000 != 0) DataBlock_DeleteItem(dataBlock, i);
+    }
+
+    DataBlockIterator *it = DataBlock_Scan(dataBlock);
+    int *item;
+    int expected = 0;
+    while((item = (int*)DataBlockIterator_Next(it))) {
+        ASSERT_EQ(*item, expected);
+        expected += 1000;
+    }
+    ASSERT_EQ(expected, ((itemCount - 1) / 1000 + 1) * 1000);
+
+    // Delete everything, scan should come back empty.
+    for(int i = 0 ; i < itemCount; i += 1000) DataBlock_DeleteItem(dataBlock, i);
+    DataBlockIterator_Reset(it);
+    ASSERT_TRUE(DataBlockIterator_Next(it) == NULL);
+
+    DataBlockIterator_Free(it);
+    DataBlock_Free(dataBlock);
+}
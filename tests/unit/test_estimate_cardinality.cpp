@@ -0,0 +1,206 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "plan_test.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../../src/arithmetic/algebraic_expression.h"
+#include "../../src/execution_plan/optimizations/traverse_order.h"
+#include "../../src/execution_plan/optimizations/select_entry_point.h"
+#include "../../src/execution_plan/optimizations/estimate_cardinality.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#define PERSON_COUNT 1000
+#define CITY_COUNT 10
+#define AGE_COUNT 50    // Number of distinct ages.
+
+class EstimateCardinalityTest: public PlanTest {
+    protected:
+
+    static void SetUpTestCase() {
+        PlanTest::SetUpTestCase();
+        _build_graph_context();
+    }
+
+    static void TearDownTestCase() {
+        GraphContext_DeleteIndex(GraphContext_GetFromLTS(), "Person", "age");
+        PlanTest::TearDownTestCase();
+    }
+
+    /* Graph context holding PERSON_COUNT persons, each with an age attribute,
+     * and CITY_COUNT cities, every person visited a single city
+     * and knows its successor, person ages are indexed. */
+    static void _build_graph_context() {
+        GraphContext *gc = _new_graph_context(PERSON_COUNT + CITY_COUNT, PERSON_COUNT);
+
+        Schema *person = GraphContext_AddSchema(gc, "Person", SCHEMA_NODE);
+        Schema *city = GraphContext_AddSchema(gc, "City", SCHEMA_NODE);
+        Schema *visited = GraphContext_AddSchema(gc, "visited", SCHEMA_EDGE);
+        Schema *knows = GraphContext_AddSchema(gc, "knows", SCHEMA_EDGE);
+        Attribute_ID age = Schema_AddAttribute(person, SCHEMA_NODE, "age");
+
+        Node n;
+        Edge e;
+        Graph_AllocateNodes(gc->g, PERSON_COUNT + CITY_COUNT);
+        for(int i = 0; i < PERSON_COUNT; i++) {
+            Graph_CreateNode(gc->g, person->id, &n);
+            GraphEntity_AddProperty((GraphEntity*)&n, age, SI_LongVal(i % AGE_COUNT));
+        }
+        for(int i = 0; i < CITY_COUNT; i++) Graph_CreateNode(gc->g, city->id, &n);
+        for(int i = 0; i < PERSON_COUNT; i++) {
+            Graph_ConnectNodes(gc->g, i, PERSON_COUNT + (i % CITY_COUNT), visited->id, &e);
+            if(i + 1 < PERSON_COUNT) Graph_ConnectNodes(gc->g, i, i + 1, knows->id, &e);
+        }
+
+        GraphContext_AddIndex(gc, "Person", "age");
+    }
+
+    static AST* _build_ast(const char *query) {
+        char *errMsg;
+        AST *ast = ParseQuery(query, strlen(query), &errMsg);
+        AST_NameAnonymousNodes(ast);
+        pthread_setspecific(_tlsASTKey, ast);
+        return ast;
+    }
+
+    static FT_FilterNode* _build_filter(AST *ast) {
+        if(!ast->whereNode) return NULL;
+        return BuildFiltersTree(ast, ast->whereNode->filters);
+    }
+
+    static AlgebraicExpression** _build_expressions(AST *ast, QueryGraph **q, size_t *exp_count) {
+        GraphContext *gc = GraphContext_GetFromLTS();
+        *q = QueryGraph_New(4, 4);
+        BuildQueryGraph(gc, *q, ast->matchNode->_mergedPatterns);
+        return AlgebraicExpression_From_Query(ast, ast->matchNode->_mergedPatterns, *q, exp_count);
+    }
+
+    static void _free_expressions(AlgebraicExpression **exps, size_t exp_count) {
+        for(size_t i = 0; i < exp_count; i++) AlgebraicExpression_Free(exps[i]);
+        free(exps);
+    }
+};
+
+TEST_F(EstimateCardinalityTest, NodeScan) {
+    GraphContext *gc = GraphContext_GetFromLTS();
+    Node *person = Node_New("Person", "p");
+    Node *any = Node_New(NULL, "p");
+    Node *missing = Node_New("Missing", "p");
+
+    ASSERT_EQ(estimateNodeScan(gc, person, NULL), PERSON_COUNT);
+    ASSERT_EQ(estimateNodeScan(gc, any, NULL), PERSON_COUNT + CITY_COUNT);
+    ASSERT_EQ(estimateNodeScan(gc, missing, NULL), 0);
+
+    // Equality on indexed attribute, one of AGE_COUNT ages.
+    AST *ast = _build_ast("MATCH (p:Person) WHERE p.age = 7 RETURN p");
+    FT_FilterNode *tree = _build_filter(ast);
+    ASSERT_DOUBLE_EQ(estimateNodeScan(gc, person, tree), PERSON_COUNT / AGE_COUNT);
+    FilterTree_Free(tree);
+    AST_Free(ast);
+
+    // Range predicate.
+    ast = _build_ast("MATCH (p:Person) WHERE p.age > 7 RETURN p");
+    tree = _build_filter(ast);
+    ASSERT_DOUBLE_EQ(estimateNodeScan(gc, person, tree), PERSON_COUNT * RANGE_SELECTIVITY);
+    FilterTree_Free(tree);
+    AST_Free(ast);
+
+    // Predicates on other entities are disregarded.
+    ast = _build_ast("MATCH (p:Person), (c:City) WHERE c.name = 'x' RETURN p");
+    tree = _build_filter(ast);
+    ASSERT_DOUBLE_EQ(estimateNodeScan(gc, person, tree), PERSON_COUNT);
+    FilterTree_Free(tree);
+    AST_Free(ast);
+
+    Node_Free(person);
+    Node_Free(any);
+    Node_Free(missing);
+}
+
+TEST_F(EstimateCardinalityTest, SelectEntryPoint) {
+    GraphContext *gc = GraphContext_GetFromLTS();
+    QueryGraph *q;
+    size_t exp_count;
+
+    // There are far fewer cities than persons, scan cities.
+    AST *ast = _build_ast("MATCH (p:Person)-[:visited]->(c:City) RETURN p, c");
+    AlgebraicExpression **exps = _build_expressions(ast, &q, &exp_count);
+    ASSERT_EQ(exp_count, 1);
+    selectEntryPoint(gc, exps[0], NULL);
+    ASSERT_STREQ(exps[0]->src_node->alias, "c");
+    _free_expressions(exps, exp_count);
+    QueryGraph_Free(q);
+    AST_Free(ast);
+
+    // A person of a specific age is estimated to be rarer than a city.
+    ast = _build_ast("MATCH (p:Person)-[:visited]->(c:City) WHERE p.age = 3 AND p.name = 'x' RETURN p, c");
+    FT_FilterNode *tree = _build_filter(ast);
+    exps = _build_expressions(ast, &q, &exp_count);
+    selectEntryPoint(gc, exps[0], tree);
+    ASSERT_STREQ(exps[0]->src_node->alias, "p");
+    _free_expressions(exps, exp_count);
+    FilterTree_Free(tree);
+    QueryGraph_Free(q);
+    AST_Free(ast);
+}
+
+TEST_F(EstimateCardinalityTest, TraverseOrder) {
+    GraphContext *gc = GraphContext_GetFromLTS();
+    QueryGraph *q;
+    size_t exp_count;
+
+    // Entry point is the expression ending at the city.
+    AST *ast = _build_ast("MATCH (a)-[:knows]->(b:Person)-[:visited]->(c:City) RETURN a, b, c");
+    AlgebraicExpression **exps = _build_expressions(ast, &q, &exp_count);
+    ASSERT_EQ(exp_count, 2);
+    ASSERT_EQ(determineTraverseOrder(gc, NULL, exps, exp_count), 1);
+    _free_expressions(exps, exp_count);
+    QueryGraph_Free(q);
+    AST_Free(ast);
+}
+
+TEST_F(EstimateCardinalityTest, PlanEstimates) {
+    GraphContext *gc = GraphContext_GetFromLTS();
+    QueryGraph *q;
+    size_t exp_count;
+
+    // Label scan over persons, followed by a traversal to visited cities.
+    AST *ast = _build_ast("MATCH (p:Person)-[:visited]->(c:City) RETURN p, c");
+    AlgebraicExpression **exps = _build_expressions(ast, &q, &exp_count);
+    AlgebraicExpression *exp = exps[0];
+    Node *p = exp->src_node;
+    AlgebraicExpression_RemoveTerm(exp, exp->operand_count-1, NULL);
+
+    OpBase *scan = NewNodeByLabelScanOp(gc, p);
+    OpBase *traverse = NewCondTraverseOp(gc->g, exp);
+    traverse->children = (OpBase**)malloc(sizeof(OpBase*));
+    traverse->children[0] = scan;
+    traverse->childCount = 1;
+    scan->parent = traverse;
+
+    ExecutionPlan plan;
+    memset(&plan, 0, sizeof(ExecutionPlan));
+    plan.root = traverse;
+    plan.query_graph = q;
+    estimateCardinality(gc, &plan);
+
+    // Every person visited a single city.
+    ASSERT_DOUBLE_EQ(scan->estimate, PERSON_COUNT);
+    ASSERT_DOUBLE_EQ(traverse->estimate, PERSON_COUNT);
+
+    OpBase_Free(scan);
+    OpBase_Free(traverse);
+    free(exps);
+    QueryGraph_Free(q);
+    AST_Free(ast);
+}
@@ -0,0 +1,138 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "plan_test.h"
+
+#define TRIANGLE_COUNT 3
+#define NODE_COUNT (TRIANGLE_COUNT * 3 + 1)
+#define LOOP_NODE (TRIANGLE_COUNT * 3)
+
+class ExpandIntoTest: public PlanTest {
+    protected:
+
+    static void SetUpTestCase() {
+        PlanTest::SetUpTestCase();
+        _build_graph_context();
+    }
+
+    /* Graph context holding TRIANGLE_COUNT triangles, nodes 3t, 3t+1 and 3t+2
+     * are connected by R in a cycle, the last node of each triangle is
+     * connected to the first node of the next triangle. Node LOOP_NODE
+     * is connected to itself by both R and S. */
+    static void _build_graph_context() {
+        GraphContext *gc = _new_graph_context(NODE_COUNT, NODE_COUNT);
+
+        Schema *n = GraphContext_AddSchema(gc, "N", SCHEMA_NODE);
+        Schema *r = GraphContext_AddSchema(gc, "R", SCHEMA_EDGE);
+        Schema *s = GraphContext_AddSchema(gc, "S", SCHEMA_EDGE);
+
+        Node node;
+        Edge e;
+        Graph_AllocateNodes(gc->g, NODE_COUNT);
+        for(int i = 0; i < NODE_COUNT; i++) Graph_CreateNode(gc->g, n->id, &node);
+        for(int t = 0; t < TRIANGLE_COUNT; t++) {
+            for(int i = 0; i < 3; i++) Graph_ConnectNodes(gc->g, 3*t + i, _next(3*t + i), r->id, &e);
+            if(t + 1 < TRIANGLE_COUNT) Graph_ConnectNodes(gc->g, 3*t + 2, 3*(t+1), r->id, &e);
+        }
+        Graph_ConnectNodes(gc->g, LOOP_NODE, LOOP_NODE, r->id, &e);
+        Graph_ConnectNodes(gc->g, LOOP_NODE, LOOP_NODE, s->id, &e);
+    }
+
+    // Node following id within its triangle, LOOP_NODE is followed by itself.
+    static NodeID _next(NodeID id) {
+        if(id == LOOP_NODE) return LOOP_NODE;
+        return (id / 3) * 3 + (id + 1) % 3;
+    }
+
+    // Operation producing the records projected by plan.
+    static OpBase* _projected(ExecutionPlan *plan) {
+        OpBase *project = _locate_op(plan->root, OPType_PROJECT);
+        EXPECT_TRUE(project != NULL);
+        return project->children[0];
+    }
+};
+
+TEST_F(ExpandIntoTest, ClosedCycle) {
+    ExecutionPlan *plan = _build_plan("MATCH (a)-[:R]->(b)-[:R]->(c)-[:R]->(a) RETURN a, b, c");
+    OpBase *expandInto = _locate_op(plan->root, OPType_EXPAND_INTO);
+    ASSERT_TRUE(expandInto != NULL);
+    ASSERT_EQ(expandInto->childCount, 1);
+    ASSERT_TRUE(expandInto->modifies == NULL);
+
+    // Each rotation of every triangle is produced once, as is the self loop.
+    AST *ast = AST_GetFromLTS();
+    int aIdx = AST_GetAliasID(ast, "a");
+    int bIdx = AST_GetAliasID(ast, "b");
+    int cIdx = AST_GetAliasID(ast, "c");
+    OpBase *op = _projected(plan);
+    bool seen[NODE_COUNT] = {false};
+    int records = 0;
+    Record r;
+    while((r = op->consume(op))) {
+        NodeID a = ENTITY_GET_ID(Record_GetNode(r, aIdx));
+        NodeID b = ENTITY_GET_ID(Record_GetNode(r, bIdx));
+        NodeID c = ENTITY_GET_ID(Record_GetNode(r, cIdx));
+        EXPECT_EQ(b, _next(a));
+        EXPECT_EQ(c, _next(b));
+        EXPECT_FALSE(seen[a]);
+        seen[a] = true;
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(records, NODE_COUNT);
+    _free_plan(plan);
+}
+
+TEST_F(ExpandIntoTest, SelfLoop) {
+    ExecutionPlan *plan = _build_plan("MATCH (a)-[:R]->(a) RETURN a");
+    OpBase *op = _projected(plan);
+    ASSERT_EQ(op->type, OPType_EXPAND_INTO);
+    ASSERT_EQ(op->children[0]->type, OPType_ALL_NODE_SCAN);
+
+    int aIdx = AST_GetAliasID(AST_GetFromLTS(), "a");
+    Record r = op->consume(op);
+    ASSERT_TRUE(r != NULL);
+    ASSERT_EQ(ENTITY_GET_ID(Record_GetNode(r, aIdx)), LOOP_NODE);
+    Record_Free(r);
+    ASSERT_TRUE(op->consume(op) == NULL);
+    _free_plan(plan);
+
+    // A record is produced per connecting edge.
+    plan = _build_plan("MATCH (a)-[e]->(a) RETURN a, e");
+    op = _projected(plan);
+    ASSERT_EQ(op->type, OPType_EXPAND_INTO);
+    int eIdx = AST_GetAliasID(AST_GetFromLTS(), "e");
+    bool relations[2] = {false, false};
+    int records = 0;
+    while((r = op->consume(op))) {
+        Edge *e = Record_GetEdge(r, eIdx);
+        ASSERT_EQ(Edge_GetSrcNodeID(e), LOOP_NODE);
+        ASSERT_EQ(Edge_GetDestNodeID(e), LOOP_NODE);
+        ASSERT_FALSE(relations[Edge_GetRelationID(e)]);
+        relations[Edge_GetRelationID(e)] = true;
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(records, 2);
+
+    // Reset discards current record.
+    OpBase_Reset(op);
+    records = 0;
+    while((r = op->consume(op))) {
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(records, 2);
+    _free_plan(plan);
+}
+
+TEST_F(ExpandIntoTest, UnboundDestination) {
+    // Open paths are traversed.
+    ExecutionPlan *plan = _build_plan("MATCH (a)-[:R]->(b)-[:R]->(c) RETURN a, b, c");
+    ASSERT_TRUE(_locate_op(plan->root, OPType_EXPAND_INTO) == NULL);
+    _free_plan(plan);
+}
@@ -648,6 +648,81 @@ TEST_F(GraphTest, RemoveEdges)
     Graph_Free(g);
 }
 
+TEST_F(GraphTest, TransposedMatrices)
+{
+    /* Transposed relation and adjacency matrices must mirror
+     * their counterparts as edges are formed and removed. */
+    Edge e;
+    Node n;
+    GrB_Matrix M;
+    GrB_Matrix TM;
+    GrB_Index nnz;
+    Graph *g = Graph_New(32, 32);
+    Graph_AcquireWriteLock(g);
+    for(int i = 0; i < 3; i++) Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+    int r = Graph_AddRelationType(g);
+
+    // Connect 0 to 1, 0 to 2 and 1 to 2.
+    Graph_ConnectNodes(g, 0, 1, r, &e);
+    Graph_ConnectNodes(g, 0, 2, r, &e);
+    Graph_ConnectNodes(g, 1, 2, r, &e);
+
+    M = Graph_GetRelationMatrix(g, r);
+    TM = Graph_GetTransposedRelationMatrix(g, r);
+    ASSERT_EQ(Graph_GetTransposedMatrix(g, M), TM);
+    GrB_Matrix_nvals(&nnz, TM);
+    ASSERT_EQ(nnz, 3);
+
+    bool x = false;
+    GrB_Matrix_extractElement_BOOL(&x, TM, 0, 1);
+    ASSERT_TRUE(x);
+    x = false;
+    GrB_Matrix_extractElement_BOOL(&x, TM, 1, 2);
+    ASSERT_TRUE(x);
+
+    TM = Graph_GetTransposedAdjacencyMatrix(g);
+    ASSERT_EQ(Graph_GetTransposedMatrix(g, Graph_GetAdjacencyMatrix(g)), TM);
+    GrB_Matrix_nvals(&nnz, TM);
+    ASSERT_EQ(nnz, 3);
+
+    // Incoming edges are read from the transposed matrices.
+    Edge *edges = (Edge *)array_new(Edge, 3);
+    Graph_GetNode(g, 2, &n);
+    Graph_GetNodeEdges(g, &n, GRAPH_EDGE_DIR_INCOMING, r, &edges);
+    ASSERT_EQ(array_len(edges), 2);
+    for(int i = 0; i < array_len(edges); i++) {
+        ASSERT_EQ(Edge_GetDestNodeID(edges + i), 2);
+    }
+
+    // Delete edge connecting 0 to 2.
+    array_clear(edges);
+    Graph_GetEdgesConnectingNodes(g, 0, 2, r, &edges);
+    ASSERT_EQ(array_len(edges), 1);
+    Graph_DeleteEdge(g, edges);
+
+    TM = Graph_GetTransposedRelationMatrix(g, r);
+    x = false;
+    GrB_Matrix_extractElement_BOOL(&x, TM, 0, 2);
+    ASSERT_FALSE(x);
+    GrB_Matrix_nvals(&nnz, TM);
+    ASSERT_EQ(nnz, 2);
+
+    TM = Graph_GetTransposedAdjacencyMatrix(g);
+    GrB_Matrix_nvals(&nnz, TM);
+    ASSERT_EQ(nnz, 2);
+
+    array_clear(edges);
+    Graph_GetNode(g, 2, &n);
+    Graph_GetNodeEdges(g, &n, GRAPH_EDGE_DIR_INCOMING, GRAPH_NO_RELATION, &edges);
+    ASSERT_EQ(array_len(edges), 1);
+    ASSERT_EQ(Edge_GetSrcNodeID(edges), 1);
+
+    // Cleanup.
+    array_free(edges);
+    Graph_ReleaseLock(g);
+    Graph_Free(g);
+}
+
 TEST_F(GraphTest, GetNode)
 {
     /* Create a graph with nodeCount nodes,
@@ -676,6 +751,286 @@ TEST_F(GraphTest, GetNode)
     Graph_Free(g);
 }
 
+TEST_F(GraphTest, GetNodeLabel)
+{
+    /* Create labeled and unlabeled nodes,
+     * Make sure node label is reported correctly
+     * and is cleared from label matrix once node is deleted. */
+
+    Node n;
+    size_t nodeCount = 8;
+    Graph *g = Graph_New(nodeCount, nodeCount);
+    Graph_AcquireWriteLock(g);
+    int labels[2];
+    labels[0] = Graph_AddLabel(g);
+    labels[1] = Graph_AddLabel(g);
+
+    // Nodes alternate between label 0, label 1 and no label.
+    for(int i = 0; i < nodeCount; i++) {
+        int l = (i % 3 == 2) ? GRAPH_NO_LABEL : labels[i % 3];
+        Graph_CreateNode(g, l, &n);
+    }
+
+    for(NodeID i = 0; i < nodeCount; i++) {
+        int expected = (i % 3 == 2) ? GRAPH_NO_LABEL : labels[i % 3];
+        ASSERT_EQ(Graph_GetNodeLabel(g, i), expected);
+    }
+
+    // Delete node 0, labeled as labels[0].
+    GrB_Index nvals;
+    GrB_Matrix L = Graph_GetLabel(g, labels[0]);
+    GrB_Matrix_nvals(&nvals, L);
+    ASSERT_EQ(nvals, 3);
+
+    Graph_GetNode(g, 0, &n);
+    Graph_DeleteNode(g, &n);
+    L = Graph_GetLabel(g, labels[0]);
+    GrB_Matrix_nvals(&nvals, L);
+    ASSERT_EQ(nvals, 2);
+
+    // Label 1 remains intact.
+    GrB_Matrix_nvals(&nvals, Graph_GetLabel(g, labels[1]));
+    ASSERT_EQ(nvals, 3);
+
+    Graph_ReleaseLock(g);
+    Graph_Free(g);
+}
+
+TEST_F(GraphTest, BulkDelete)
+{
+    /* Delete a mix of nodes and edges in a single call,
+     * make sure every matrix is updated accordingly. */
+
+    Node n;
+    size_t nodeCount = 6;
+    Graph *g = Graph_New(nodeCount, nodeCount);
+    Graph_AcquireWriteLock(g);
+    int label = Graph_AddLabel(g);
+    int r0 = Graph_AddRelationType(g);
+    int r1 = Graph_AddRelationType(g);
+    for(int i = 0; i < nodeCount; i++) Graph_CreateNode(g, label, &n);
+
+    /* Connect nodes:
+     * (0)-[r0]->(1), (0)-[r1]->(1), (1)-[r0]->(2),
+     * (2)-[r0]->(3), (3)-[r1]->(4), (4)-[r0]->(5). */
+    Edge edges[6];
+    Graph_ConnectNodes(g, 0, 1, r0, edges + 0);
+    Graph_ConnectNodes(g, 0, 1, r1, edges + 1);
+    Graph_ConnectNodes(g, 1, 2, r0, edges + 2);
+    Graph_ConnectNodes(g, 2, 3, r0, edges + 3);
+    Graph_ConnectNodes(g, 3, 4, r1, edges + 4);
+    Graph_ConnectNodes(g, 4, 5, r0, edges + 5);
+    for(int i = 0; i < 6; i++) edges[i].relationId = (i == 1 || i == 4) ? r1 : r0;
+
+    // Adjacency matrix counts edges connecting each pair.
+    uint32_t edgeCount = 0;
+    GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetAdjacencyMatrix(g), 1, 0);
+    ASSERT_EQ(edgeCount, 2);
+    GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetTransposedAdjacencyMatrix(g), 0, 1);
+    ASSERT_EQ(edgeCount, 2);
+    GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetAdjacencyMatrix(g), 2, 1);
+    ASSERT_EQ(edgeCount, 1);
+
+    /* Delete edges (0)-[r0]->(1) twice, (2)-[r0]->(3),
+     * and node 4, implicitly deleting its two edges. */
+    Edge deleteEdges[3] = {edges[0], edges[3], edges[0]};
+    Node deleteNodes[2];
+    Graph_GetNode(g, 4, deleteNodes);
+    Graph_GetNode(g, 4, deleteNodes + 1);
+
+    uint nodeDeleted;
+    uint edgeDeleted;
+    Graph_BulkDelete(g, deleteNodes, 2, deleteEdges, 3, &nodeDeleted, &edgeDeleted);
+    ASSERT_EQ(nodeDeleted, 1);
+    ASSERT_EQ(edgeDeleted, 2);
+    ASSERT_EQ(Graph_NodeCount(g), nodeCount - 1);
+    ASSERT_EQ(Graph_EdgeCount(g), 2);
+
+    // (0)-[r1]->(1) remains, keeping 0 adjacent to 1.
+    edgeCount = 0;
+    GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetAdjacencyMatrix(g), 1, 0);
+    ASSERT_EQ(edgeCount, 1);
+    edgeCount = 0;
+    GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetTransposedAdjacencyMatrix(g), 0, 1);
+    ASSERT_EQ(edgeCount, 1);
+
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, Graph_GetAdjacencyMatrix(g));
+    ASSERT_EQ(nvals, 2);
+    GrB_Matrix_nvals(&nvals, Graph_GetTransposedAdjacencyMatrix(g));
+    ASSERT_EQ(nvals, 2);
+    GrB_Matrix_nvals(&nvals, Graph_GetRelationMatrix(g, r0));
+    ASSERT_EQ(nvals, 1);
+    GrB_Matrix_nvals(&nvals, Graph_GetTransposedRelationMatrix(g, r0));
+    ASSERT_EQ(nvals, 1);
+    GrB_Matrix_nvals(&nvals, Graph_GetRelationMatrix(g, r1));
+    ASSERT_EQ(nvals, 1);
+    GrB_Matrix_nvals(&nvals, Graph_GetLabel(g, label));
+    ASSERT_EQ(nvals, nodeCount - 1);
+
+    // Deleting already removed entities is a no-op.
+    Graph_BulkDelete(g, NULL, 0, deleteEdges, 1, NULL, &edgeDeleted);
+    ASSERT_EQ(edgeDeleted, 0);
+
+    Graph_ReleaseLock(g);
+    Graph_Free(g);
+
+    // Time removal of a large number of edges.
+    size_t benchNodeCount = 100000;
+    size_t benchEdgeCount = 500000;
+    g = Graph_New(benchNodeCount, benchNodeCount);
+    Graph_AcquireWriteLock(g);
+    int r = Graph_AddRelationType(g);
+    for(int i = 0; i < benchNodeCount; i++) Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+    Edge *benchEdges = (Edge*)malloc(sizeof(Edge) * benchEdgeCount);
+    for(size_t i = 0; i < benchEdgeCount; i++) {
+        NodeID src = rand() % benchNodeCount;
+        NodeID dest = rand() % benchNodeCount;
+        Graph_ConnectNodes(g, src, dest, r, benchEdges + i);
+        benchEdges[i].relationId = r;
+    }
+
+    double tic[2];
+    simple_tic(tic);
+    Graph_BulkDelete(g, NULL, 0, benchEdges, benchEdgeCount, NULL, NULL);
+    printf("Bulk deleting %zu edges took %.6f sec\n", benchEdgeCount, simple_toc(tic));
+    ASSERT_EQ(Graph_EdgeCount(g), 0);
+    GrB_Matrix_nvals(&nvals, Graph_GetAdjacencyMatrix(g));
+    ASSERT_EQ(nvals, 0);
+
+    free(benchEdges);
+    Graph_ReleaseLock(g);
+    Graph_Free(g);
+}
+
+TEST_F(GraphTest, ReconnectNodes)
+{
+    /* Connect the same pair of nodes twice by the same relation,
+     * the second edge replaces the first, make sure deleting
+     * both leaves no adjacency entry behind. */
+
+    Node n;
+    Edge edges[2];
+    Graph *g = Graph_New(2, 2);
+    Graph_AcquireWriteLock(g);
+    int r = Graph_AddRelationType(g);
+    for(int i = 0; i < 2; i++) Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+
+    Graph_ConnectNodes(g, 0, 1, r, edges);
+    Graph_ConnectNodes(g, 0, 1, r, edges + 1);
+    edges[0].relationId = r;
+    edges[1].relationId = r;
+
+    uint32_t edgeCount = 0;
+    GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetAdjacencyMatrix(g), 1, 0);
+    ASSERT_EQ(edgeCount, 1);
+    edgeCount = 0;
+    GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetTransposedAdjacencyMatrix(g), 0, 1);
+    ASSERT_EQ(edgeCount, 1);
+
+    Graph_BulkDelete(g, NULL, 0, edges, 2, NULL, NULL);
+
+    GrB_Info res = GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetAdjacencyMatrix(g), 1, 0);
+    ASSERT_EQ(res, GrB_NO_VALUE);
+    res = GrB_Matrix_extractElement_UINT32(&edgeCount, Graph_GetTransposedAdjacencyMatrix(g), 0, 1);
+    ASSERT_EQ(res, GrB_NO_VALUE);
+
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, Graph_GetRelationMatrix(g, r));
+    ASSERT_EQ(nvals, 0);
+
+    Graph_ReleaseLock(g);
+    Graph_Free(g);
+}
+
+TEST_F(GraphTest, WriterFlushesPending)
+{
+    /* Modify graph under a write lock,
+     * make sure no pending work is left once the lock is released. */
+
+    Node n;
+    Edge e;
+    size_t nodeCount = 16;
+    Graph *g = Graph_New(nodeCount, nodeCount);
+    Graph_AcquireWriteLock(g);
+    int label = Graph_AddLabel(g);
+    int r = Graph_AddRelationType(g);
+    for(int i = 0; i < nodeCount; i++) Graph_CreateNode(g, label, &n);
+    for(int i = 1; i < nodeCount; i++) Graph_ConnectNodes(g, 0, i, r, &e);
+
+    // Connections are applied once matrices are synchronized.
+    ASSERT_EQ(g->_pending_count, nodeCount - 1);
+
+    Graph_ReleaseLock(g);
+    ASSERT_EQ(g->_pending_count, 0);
+
+    bool pending = false;
+    GrB_Matrix matrices[6] = {g->adjacency_matrix, g->_t_adjacency_matrix,
+                              g->labels[label], g->relations[r],
+                              g->_t_relations[r], g->_relations_map[r]};
+    for(int i = 0; i < 6; i++) {
+        GrB_Index nrows;
+        GxB_Matrix_Pending(matrices[i], &pending);
+        GrB_Matrix_nrows(&nrows, matrices[i]);
+        ASSERT_FALSE(pending);
+        ASSERT_EQ(nrows, Graph_RequiredMatrixDim(g));
+    }
+
+    Graph_Free(g);
+}
+
+TEST_F(GraphTest, HypersparseMatrices)
+{
+    /* Sparse relation matrices are held in hypersparse format once enabled,
+     * make sure traversal over them is unaffected and memory is reduced. */
+
+    Node n;
+    Edge e;
+    size_t nodeCount = 100000;
+    Graph *sparse = Graph_New(nodeCount, nodeCount);
+    Graph *hyper = Graph_New(nodeCount, nodeCount);
+    Graph_EnableHypersparseMatrices(hyper);
+
+    Graph *graphs[2] = {sparse, hyper};
+    size_t sizes[2] = {0, 0};
+    for(int i = 0; i < 2; i++) {
+        Graph *g = graphs[i];
+        Graph_AcquireWriteLock(g);
+        int r = Graph_AddRelationType(g);
+        for(int j = 0; j < nodeCount; j++) Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+        // Connect only a handful of nodes.
+        for(NodeID j = 0; j < 10; j++) Graph_ConnectNodes(g, j * 1000, j * 1000 + 1, r, &e);
+        Graph_ReleaseLock(g);
+
+        bool hypersparse;
+        sizes[i] = Graph_MatrixMemoryUsage(Graph_GetRelationMatrix(g, r), &hypersparse);
+        ASSERT_EQ(hypersparse, g == hyper);
+
+        // Outgoing and incoming edges are located through the relation matrices.
+        Edge *edges = (Edge*)array_new(Edge, 1);
+        Graph_GetNode(g, 3000, &n);
+        Graph_GetNodeEdges(g, &n, GRAPH_EDGE_DIR_OUTGOING, r, &edges);
+        ASSERT_EQ(array_len(edges), 1);
+        ASSERT_EQ(Edge_GetDestNodeID(edges), 3001);
+        array_clear(edges);
+        Graph_GetNode(g, 3001, &n);
+        Graph_GetNodeEdges(g, &n, GRAPH_EDGE_DIR_INCOMING, r, &edges);
+        ASSERT_EQ(array_len(edges), 1);
+        ASSERT_EQ(Edge_GetSrcNodeID(edges), 3000);
+        array_clear(edges);
+        Graph_GetNode(g, 3002, &n);
+        Graph_GetNodeEdges(g, &n, GRAPH_EDGE_DIR_OUTGOING, r, &edges);
+        ASSERT_EQ(array_len(edges), 0);
+        array_free(edges);
+    }
+
+    ASSERT_LT(sizes[1] * 10, sizes[0]);
+    printf("Relation matrix memory, sparse: %zu bytes, hypersparse: %zu bytes\n", sizes[0], sizes[1]);
+
+    Graph_Free(sparse);
+    Graph_Free(hyper);
+}
+
 TEST_F(GraphTest, GetEdge)
 {
     /* Create a graph with both nodes and edges.
@@ -785,3 +1140,76 @@ TEST_F(GraphTest, GetEdge)
     Graph_ReleaseLock(g);
     Graph_Free(g);
 }
+
+TEST_F(GraphTest, Statistics)
+{
+    /* Statistics are maintained as nodes and edges
+     * are created and deleted. */
+
+    Node n;
+    Edge e;
+    Graph *g = Graph_New(16, 16);
+    Graph_AcquireWriteLock(g);
+    int person = Graph_AddLabel(g);
+    int city = Graph_AddLabel(g);
+    int knows = Graph_AddRelationType(g);
+    int visited = Graph_AddRelationType(g);
+
+    // Persons 0-3, cities 4-5, unlabeled node 6.
+    for(int i = 0; i < 4; i++) Graph_CreateNode(g, person, &n);
+    for(int i = 0; i < 2; i++) Graph_CreateNode(g, city, &n);
+    Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+
+    // Every person knows its successor and visited both cities.
+    for(int i = 0; i < 3; i++) Graph_ConnectNodes(g, i, i + 1, knows, &e);
+    for(int i = 0; i < 4; i++) {
+        Graph_ConnectNodes(g, i, 4, visited, &e);
+        Graph_ConnectNodes(g, i, 5, visited, &e);
+    }
+    Graph_ConnectNodes(g, 6, 0, knows, &e);
+
+    const GraphStatistics *stats = Graph_GetStatistics(g);
+    ASSERT_EQ(GraphStatistics_NodeCount(stats, person), 4);
+    ASSERT_EQ(GraphStatistics_NodeCount(stats, city), 2);
+    ASSERT_EQ(GraphStatistics_NodeCount(stats, GRAPH_NO_LABEL), 0);
+    ASSERT_EQ(GraphStatistics_EdgeCount(stats, knows), 4);
+    ASSERT_EQ(GraphStatistics_EdgeCount(stats, visited), 8);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, knows, person, true), 3);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, knows, person, false), 4);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, visited, person, true), 8);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, visited, city, false), 8);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, visited, city, true), 0);
+
+    // Labels introduced later are tracked by existing relation types.
+    int country = Graph_AddLabel(g);
+    Graph_CreateNode(g, country, &n);
+    Graph_ConnectNodes(g, 4, 7, visited, &e);
+    stats = Graph_GetStatistics(g);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, visited, country, false), 1);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, visited, city, true), 1);
+
+    // Deleting a city removes its incoming and outgoing edges.
+    Node deleted;
+    Graph_GetNode(g, 4, &deleted);
+    Graph_DeleteNode(g, &deleted);
+    ASSERT_EQ(GraphStatistics_NodeCount(stats, city), 1);
+    ASSERT_EQ(GraphStatistics_EdgeCount(stats, visited), 4);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, visited, person, true), 4);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, visited, city, false), 4);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, visited, country, false), 0);
+    ASSERT_EQ(GraphStatistics_EdgeCount(stats, knows), 4);
+
+    // Reconnecting nodes replaces their edge, statistics remain unchanged.
+    Edge replaced;
+    Graph_ConnectNodes(g, 6, 0, knows, &replaced);
+    replaced.relationId = knows;
+    stats = Graph_GetStatistics(g);
+    ASSERT_EQ(GraphStatistics_EdgeCount(stats, knows), 4);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, knows, person, false), 4);
+    Graph_DeleteEdge(g, &replaced);
+    ASSERT_EQ(GraphStatistics_EdgeCount(stats, knows), 3);
+    ASSERT_EQ(GraphStatistics_LabelEdgeCount(stats, knows, person, false), 3);
+
+    Graph_ReleaseLock(g);
+    Graph_Free(g);
+}
@@ -0,0 +1,138 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "plan_test.h"
+
+#define USER_COUNT 5
+#define PURCHASE_COUNT 20
+#define KEYED_PURCHASE_COUNT 15
+
+class HashJoinTest: public PlanTest {
+    protected:
+
+    static void SetUpTestCase() {
+        PlanTest::SetUpTestCase();
+        _build_graph_context();
+    }
+
+    /* Graph context holding USER_COUNT users followed by PURCHASE_COUNT purchases,
+     * user i has an id attribute set to i, the first KEYED_PURCHASE_COUNT purchases
+     * have a user_id attribute, purchase i made by user i % USER_COUNT. */
+    static void _build_graph_context() {
+        GraphContext *gc = _new_graph_context(USER_COUNT + PURCHASE_COUNT, 1);
+
+        Schema *user = GraphContext_AddSchema(gc, "User", SCHEMA_NODE);
+        Schema *purchase = GraphContext_AddSchema(gc, "Purchase", SCHEMA_NODE);
+        Attribute_ID id = Schema_AddAttribute(user, SCHEMA_NODE, "id");
+        Attribute_ID userID = Schema_AddAttribute(purchase, SCHEMA_NODE, "user_id");
+
+        Node n;
+        Graph_AllocateNodes(gc->g, USER_COUNT + PURCHASE_COUNT);
+        for(int i = 0; i < USER_COUNT; i++) {
+            Graph_CreateNode(gc->g, user->id, &n);
+            GraphEntity_AddProperty((GraphEntity*)&n, id, SI_LongVal(i));
+        }
+        for(int i = 0; i < PURCHASE_COUNT; i++) {
+            Graph_CreateNode(gc->g, purchase->id, &n);
+            if(i < KEYED_PURCHASE_COUNT) {
+                GraphEntity_AddProperty((GraphEntity*)&n, userID, SI_LongVal(i % USER_COUNT));
+            }
+        }
+    }
+
+    // Alias of node scanned by op.
+    static const char* _scanned_alias(OpBase *op) {
+        EXPECT_EQ(op->type, OPType_NODE_BY_LABEL_SCAN);
+        return ((NodeByLabelScan*)op)->node->alias;
+    }
+
+    /* Validates every record produced by join pairs a keyed purchase
+     * with the user who made it, returns the number of records. */
+    static int _validate_join(OpBase *join) {
+        AST *ast = AST_GetFromLTS();
+        int uIdx = AST_GetAliasID(ast, "u");
+        int oIdx = AST_GetAliasID(ast, "o");
+        bool seen[PURCHASE_COUNT] = {false};
+        int records = 0;
+        Record r;
+        while((r = join->consume(join))) {
+            NodeID u = ENTITY_GET_ID(Record_GetNode(r, uIdx));
+            NodeID o = ENTITY_GET_ID(Record_GetNode(r, oIdx)) - USER_COUNT;
+            EXPECT_LT(o, KEYED_PURCHASE_COUNT);
+            EXPECT_EQ(u, o % USER_COUNT);
+            EXPECT_FALSE(seen[o]);
+            seen[o] = true;
+            Record_Free(r);
+            records++;
+        }
+        return records;
+    }
+};
+
+TEST_F(HashJoinTest, JoinPatterns) {
+    // Users are fewer than purchases, users are hashed regardless of pattern order.
+    const char *queries[] = {
+        "MATCH (u:User), (o:Purchase) WHERE u.id = o.user_id RETURN u, o",
+        "MATCH (o:Purchase), (u:User) WHERE o.user_id = u.id RETURN u, o",
+        NULL
+    };
+
+    for(int i = 0; queries[i]; i++) {
+        ExecutionPlan *plan = _build_plan(queries[i]);
+        ASSERT_TRUE(_locate_op(plan->root, OPType_CARTESIAN_PRODUCT) == NULL);
+        ASSERT_TRUE(_locate_op(plan->root, OPType_FILTER) == NULL);
+        OpBase *join = _locate_op(plan->root, OPType_HASH_JOIN);
+        ASSERT_TRUE(join != NULL);
+        ASSERT_EQ(join->childCount, 2);
+        ASSERT_STREQ(_scanned_alias(join->children[0]), "u");
+        ASSERT_STREQ(_scanned_alias(join->children[1]), "o");
+
+        // Purchases missing user_id don't join.
+        ASSERT_EQ(_validate_join(join), KEYED_PURCHASE_COUNT);
+
+        // Probing restarts once reset, build records are kept.
+        OpBase_Reset(join);
+        ASSERT_EQ(_validate_join(join), KEYED_PURCHASE_COUNT);
+        _free_plan(plan);
+    }
+}
+
+TEST_F(HashJoinTest, RemainingPredicates) {
+    // Predicates other than the join key remain filters.
+    ExecutionPlan *plan = _build_plan("MATCH (u:User), (o:Purchase) WHERE u.id = o.user_id AND u.id + o.user_id > 4 RETURN u, o");
+    OpBase *join = _locate_op(plan->root, OPType_HASH_JOIN);
+    ASSERT_TRUE(join != NULL);
+    ASSERT_EQ(join->parent->type, OPType_FILTER);
+    ASSERT_TRUE(_locate_op(plan->root, OPType_CARTESIAN_PRODUCT) == NULL);
+    _free_plan(plan);
+
+    // Each equality predicate joins an additional pattern.
+    plan = _build_plan("MATCH (u:User), (o:Purchase), (q:Purchase) WHERE u.id = o.user_id AND q.user_id = o.user_id RETURN u, o, q");
+    ASSERT_TRUE(_locate_op(plan->root, OPType_CARTESIAN_PRODUCT) == NULL);
+    join = _locate_op(plan->root, OPType_HASH_JOIN);
+    ASSERT_TRUE(join != NULL);
+    OpBase *inner = (join->children[0]->type == OPType_HASH_JOIN) ? join->children[0] : join->children[1];
+    ASSERT_EQ(inner->type, OPType_HASH_JOIN);
+    _free_plan(plan);
+}
+
+TEST_F(HashJoinTest, NotJoined) {
+    const char *queries[] = {
+        "MATCH (u:User), (o:Purchase) WHERE u.id < o.user_id RETURN u, o",
+        "MATCH (u:User), (o:Purchase) WHERE u.id = o.user_id OR u.id = 0 RETURN u, o",
+        "MATCH (u:User), (o:Purchase) WHERE u.id + o.user_id = 3 RETURN u, o",
+        "MATCH (u:User), (o:Purchase) RETURN u, o",
+        NULL
+    };
+
+    for(int i = 0; queries[i]; i++) {
+        ExecutionPlan *plan = _build_plan(queries[i]);
+        ASSERT_TRUE(_locate_op(plan->root, OPType_HASH_JOIN) == NULL) << queries[i];
+        ASSERT_TRUE(_locate_op(plan->root, OPType_CARTESIAN_PRODUCT) != NULL) << queries[i];
+        _free_plan(plan);
+    }
+}
@@ -0,0 +1,257 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "plan_test.h"
+
+extern int _parallelWorkers;        // Number of threads executing a parallel query.
+extern size_t _parallelThreshold;   // Number of scanned nodes above which queries run in parallel.
+
+// Replies are discarded, aggregation replays its result-set header.
+static int _replyWithArray(RedisModuleCtx *, long) { return REDISMODULE_OK; }
+static int _replyWithStringBuffer(RedisModuleCtx *, const char *, size_t) { return REDISMODULE_OK; }
+
+#define PERSON_COUNT 20000
+#define WORKER_COUNT 4
+#define GROUP_COUNT 7
+
+class ParallelScanTest: public PlanTest {
+    protected:
+
+    static void SetUpTestCase() {
+        PlanTest::SetUpTestCase();
+        _build_graph_context();
+    }
+
+    void SetUp() {
+        _parallelWorkers = WORKER_COUNT;
+        _parallelThreshold = PERSON_COUNT / 10;
+    }
+
+    /* Graph context holding PERSON_COUNT persons, person i
+     * has a v attribute set to i, a g attribute set to i % GROUP_COUNT
+     * and knows person i+1. */
+    static void _build_graph_context() {
+        GraphContext *gc = _new_graph_context(PERSON_COUNT, PERSON_COUNT);
+
+        Schema *person = GraphContext_AddSchema(gc, "Person", SCHEMA_NODE);
+        Schema *knows = GraphContext_AddSchema(gc, "knows", SCHEMA_EDGE);
+        Attribute_ID v = Schema_AddAttribute(person, SCHEMA_NODE, "v");
+        Attribute_ID g = Schema_AddAttribute(person, SCHEMA_NODE, "g");
+
+        Node n;
+        Edge e;
+        Graph_AllocateNodes(gc->g, PERSON_COUNT);
+        for(int i = 0; i < PERSON_COUNT; i++) {
+            Graph_CreateNode(gc->g, person->id, &n);
+            GraphEntity_AddProperty((GraphEntity*)&n, v, SI_LongVal(i));
+            GraphEntity_AddProperty((GraphEntity*)&n, g, SI_LongVal(i % GROUP_COUNT));
+        }
+        for(int i = 0; i + 1 < PERSON_COUNT; i++) {
+            Graph_ConnectNodes(gc->g, i, i + 1, knows->id, &e);
+        }
+    }
+};
+
+TEST_F(ParallelScanTest, ScanFilter) {
+    ExecutionPlan *plan = _build_plan("MATCH (n) WHERE n.v < 12000 RETURN count(n)");
+    OpBase *gather = _locate_op(plan->root, OPType_GATHER);
+    ASSERT_TRUE(gather != NULL);
+    ASSERT_EQ(gather->parent->type, OPType_AGGREGATE);
+    ASSERT_EQ(gather->children[0]->type, OPType_FILTER);
+
+    // Every passing node is produced exactly once.
+    int nIdx = AST_GetAliasID(AST_GetFromLTS(), "n");
+    bool *seen = (bool*)calloc(PERSON_COUNT, sizeof(bool));
+    int records = 0;
+    Record r;
+    while((r = gather->consume(gather))) {
+        NodeID id = ENTITY_GET_ID(Record_GetNode(r, nIdx));
+        ASSERT_LT(id, 12000);
+        ASSERT_FALSE(seen[id]);
+        seen[id] = true;
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(records, 12000);
+    ASSERT_TRUE(gather->consume(gather) == NULL);
+
+    free(seen);
+    _free_plan(plan);
+}
+
+TEST_F(ParallelScanTest, LabelScanTraverse) {
+    ExecutionPlan *plan = _build_plan("MATCH (a:Person)-[:knows]->(b) WHERE a.v >= 0 RETURN count(b)");
+    OpBase *gather = _locate_op(plan->root, OPType_GATHER);
+    ASSERT_TRUE(gather != NULL);
+    ASSERT_EQ(gather->children[0]->type, OPType_CONDITIONAL_TRAVERSE);
+
+    AST *ast = AST_GetFromLTS();
+    int aIdx = AST_GetAliasID(ast, "a");
+    int bIdx = AST_GetAliasID(ast, "b");
+    bool *seen = (bool*)calloc(PERSON_COUNT, sizeof(bool));
+    int records = 0;
+    Record r;
+    while((r = gather->consume(gather))) {
+        NodeID src = ENTITY_GET_ID(Record_GetNode(r, aIdx));
+        NodeID dest = ENTITY_GET_ID(Record_GetNode(r, bIdx));
+        ASSERT_EQ(dest, src + 1);
+        ASSERT_FALSE(seen[src]);
+        seen[src] = true;
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(records, PERSON_COUNT - 1);
+
+    free(seen);
+    _free_plan(plan);
+}
+
+TEST_F(ParallelScanTest, EarlyStop) {
+    // Workers blocked on a full exchange are stopped once plan is freed.
+    ExecutionPlan *plan = _build_plan("MATCH (a:Person)-[:knows]->(b) WHERE a.v >= 0 RETURN count(b)");
+    OpBase *gather = _locate_op(plan->root, OPType_GATHER);
+    ASSERT_TRUE(gather != NULL);
+    for(int i = 0; i < 10; i++) {
+        Record r = gather->consume(gather);
+        ASSERT_TRUE(r != NULL);
+        Record_Free(r);
+    }
+
+    // Reset restarts execution.
+    OpBase_Reset(gather);
+    int records = 0;
+    Record r;
+    while((r = gather->consume(gather))) {
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(records, PERSON_COUNT - 1);
+
+    OpBase_Reset(gather);
+    r = gather->consume(gather);
+    ASSERT_TRUE(r != NULL);
+    Record_Free(r);
+    _free_plan(plan);
+}
+
+TEST_F(ParallelScanTest, GroupedAggregation) {
+    ExecutionPlan *plan = _build_plan("MATCH (n:Person) WHERE n.v >= 0 RETURN n.g, count(n), sum(n.v), min(n.v), max(n.v)");
+    OpBase *gather = _locate_op(plan->root, OPType_GATHER);
+    ASSERT_TRUE(gather != NULL);
+    OpBase *aggregate = gather->parent;
+    ASSERT_EQ(aggregate->type, OPType_AGGREGATE);
+
+    // Plan has no result-set, aggregation only populates its header.
+    ResultSet *resultset = (ResultSet*)calloc(1, sizeof(ResultSet));
+    ((Aggregate*)aggregate)->resultset = resultset;
+    RedisModule_ReplyWithArray = _replyWithArray;
+    RedisModule_ReplyWithStringBuffer = _replyWithStringBuffer;
+
+    // Each worker aggregates its own groups, merged groups match a serial aggregation.
+    for(int run = 0; run < 2; run++) {
+        bool seen[GROUP_COUNT] = {false};
+        Record r;
+        int groups = 0;
+        while((r = aggregate->consume(aggregate))) {
+            int64_t g = Record_GetScalar(r, 0).longval;
+            ASSERT_GE(g, 0);
+            ASSERT_LT(g, GROUP_COUNT);
+            ASSERT_FALSE(seen[g]);
+            seen[g] = true;
+
+            double count = 0, sum = 0;
+            for(int i = g; i < PERSON_COUNT; i += GROUP_COUNT) {
+                count++;
+                sum += i;
+            }
+            int last = g + (count - 1) * GROUP_COUNT;
+            ASSERT_EQ(Record_GetScalar(r, 1).doubleval, count);
+            ASSERT_EQ(Record_GetScalar(r, 2).doubleval, sum);
+            ASSERT_EQ(Record_GetScalar(r, 3).longval, g);
+            ASSERT_EQ(Record_GetScalar(r, 4).longval, last);
+            Record_Free(r);
+            groups++;
+        }
+        ASSERT_EQ(groups, GROUP_COUNT);
+
+        // Aggregation is repeated once reset.
+        OpBase_Reset(aggregate);
+        OpBase_Reset(gather);
+    }
+
+    ResultSet_Free(resultset);
+    _free_plan(plan);
+}
+
+TEST_F(ParallelScanTest, WorkerBudget) {
+    const char *query = "MATCH (a:Person)-[:knows]->(b) WHERE a.v >= 0 RETURN count(b)";
+    ExecutionPlan *plan = _build_plan(query);
+    AST *ast = AST_GetFromLTS();
+    Gather *gather = (Gather*)_locate_op(plan->root, OPType_GATHER);
+    ASSERT_TRUE(gather != NULL);
+
+    // First query takes the entire budget.
+    Record r = gather->op.consume((OpBase*)gather);
+    ASSERT_TRUE(r != NULL);
+    Record_Free(r);
+    ASSERT_EQ(gather->threadCount, WORKER_COUNT);
+
+    // Concurrent query is executed by the calling thread.
+    ExecutionPlan *other = _build_plan(query);
+    Gather *otherGather = (Gather*)_locate_op(other->root, OPType_GATHER);
+    ASSERT_TRUE(otherGather != NULL);
+    int records = 0;
+    while((r = otherGather->op.consume((OpBase*)otherGather))) {
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(otherGather->threadCount, 0);
+    ASSERT_EQ(records, PERSON_COUNT - 1);
+    _free_plan(other);
+    pthread_setspecific(_tlsASTKey, ast);
+
+    // Workers are returned to the budget once stopped.
+    OpBase_Reset((OpBase*)gather);
+    _parallelWorkers = 2;
+    records = 0;
+    while((r = gather->op.consume((OpBase*)gather))) {
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(gather->threadCount, 2);
+    ASSERT_EQ(records, PERSON_COUNT - 1);
+    _free_plan(plan);
+}
+
+TEST_F(ParallelScanTest, NotParallelized) {
+    // Below threshold.
+    _parallelThreshold = PERSON_COUNT * 2;
+    ExecutionPlan *plan = _build_plan("MATCH (n:Person) WHERE n.v > 5 RETURN n");
+    ASSERT_TRUE(_locate_op(plan->root, OPType_GATHER) == NULL);
+    _free_plan(plan);
+
+    // Single worker.
+    _parallelThreshold = PERSON_COUNT / 10;
+    _parallelWorkers = 1;
+    plan = _build_plan("MATCH (n:Person) WHERE n.v > 5 RETURN n");
+    ASSERT_TRUE(_locate_op(plan->root, OPType_GATHER) == NULL);
+    _free_plan(plan);
+    _parallelWorkers = WORKER_COUNT;
+
+    // Nothing but a scan.
+    plan = _build_plan("MATCH (n:Person) RETURN count(n)");
+    ASSERT_TRUE(_locate_op(plan->root, OPType_GATHER) == NULL);
+    _free_plan(plan);
+
+    // Projection is performed by the workers.
+    plan = _build_plan("MATCH (n:Person) RETURN n.v ORDER BY n.v");
+    OpBase *gather = _locate_op(plan->root, OPType_GATHER);
+    ASSERT_TRUE(gather != NULL);
+    ASSERT_EQ(gather->parent->type, OPType_SORT);
+    ASSERT_EQ(gather->children[0]->type, OPType_PROJECT);
+    _free_plan(plan);
+}
@@ -0,0 +1,228 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include "../../src/graph/graph.h"
+#include "../../src/graph/path_cache.h"
+#include "../../src/graph/query_graph.h"
+#include "../../src/query_executor.h"
+#include "../../src/arithmetic/algebraic_expression.h"
+#include "../../src/util/rmalloc.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class PathCacheTest: public ::testing::Test {
+    protected:
+
+    static void SetUpTestCase() {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+        GxB_Global_Option_set(GxB_FORMAT, GxB_BY_COL); // all matrices in CSC format
+        GxB_Global_Option_set(GxB_HYPER, GxB_NEVER_HYPER); // matrices are never hypersparse
+    }
+
+    static void TearDownTestCase() {
+        GrB_finalize();
+    }
+
+    static GrB_Matrix _new_product(GrB_Index entries) {
+        GrB_Matrix m;
+        GrB_Matrix_new(&m, GrB_BOOL, 1024, 1024);
+        for(GrB_Index i = 0; i < entries; i++) GrB_Matrix_setElement_BOOL(m, true, i, i);
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, m);    // Flush pending entries.
+        return m;
+    }
+
+    static size_t _product_size(GrB_Matrix m) {
+        size_t size;
+        GxB_Matrix_MemoryUsage(m, &size, NULL);
+        return size;
+    }
+
+    // Builds expression for (a)-[:R]->(b)-[:R]->(c).
+    static AlgebraicExpression *_two_hop_expression(Graph *g, PathCache *cache) {
+        QueryGraph *q = QueryGraph_New(3, 2);
+        Node *a = Node_New(NULL, "a");
+        Node *b = Node_New(NULL, "b");
+        Node *c = Node_New(NULL, "c");
+        Edge *e1 = Edge_New(a, b, "R", "e1");
+        Edge *e2 = Edge_New(b, c, "R", "e2");
+        e1->mat = Graph_GetRelationMatrix(g, 0);
+        e2->mat = Graph_GetRelationMatrix(g, 0);
+        QueryGraph_AddNode(q, a, (char*)"a");
+        QueryGraph_AddNode(q, b, (char*)"b");
+        QueryGraph_AddNode(q, c, (char*)"c");
+        QueryGraph_ConnectNodes(q, a, b, e1, (char*)"e1");
+        QueryGraph_ConnectNodes(q, b, c, e2, (char*)"e2");
+
+        const char *query = "MATCH (a)-[e1:R]->(b)-[e2:R]->(c) RETURN a, c";
+        AST *ast = ParseQuery(query, strlen(query), NULL);
+        size_t exp_count = 0;
+        AlgebraicExpression **exps = AlgebraicExpression_From_Query(ast, ast->matchNode->_mergedPatterns, q, &exp_count);
+        EXPECT_EQ(exp_count, 1);
+        AlgebraicExpression *exp = exps[0];
+        AlgebraicExpression_SetPathCache(exp, g, cache);
+
+        free(exps);
+        AST_Free(ast);
+        QueryGraph_Free(q);
+        return exp;
+    }
+};
+
+TEST_F(PathCacheTest, GetPut) {
+    PathCacheStats stats;
+    PathCache *cache = PathCache_New(1 << 20);
+    ASSERT_TRUE(PathCache_Get(cache, "R0.R0", 1) == NULL);
+
+    GrB_Matrix m = _new_product(8);
+    PathCacheEntry *entry = PathCache_Put(cache, "R0.R0", 1, m);
+    ASSERT_TRUE(entry != NULL);
+    ASSERT_EQ(PathCacheEntry_Product(entry), m);
+    PathCache_Release(cache, entry);
+
+    entry = PathCache_Get(cache, "R0.R0", 1);
+    ASSERT_TRUE(entry != NULL);
+    ASSERT_EQ(PathCacheEntry_Product(entry), m);
+    PathCache_Release(cache, entry);
+
+    // Unknown key.
+    ASSERT_TRUE(PathCache_Get(cache, "R0.R1'", 1) == NULL);
+
+    PathCache_GetStats(cache, &stats);
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 2);
+    ASSERT_EQ(stats.entries, 1);
+    ASSERT_EQ(stats.bytes, _product_size(m));
+
+    // Graph was modified, product is discarded.
+    ASSERT_TRUE(PathCache_Get(cache, "R0.R0", 2) == NULL);
+    PathCache_GetStats(cache, &stats);
+    ASSERT_EQ(stats.entries, 0);
+    ASSERT_EQ(stats.bytes, 0);
+    ASSERT_EQ(stats.evictions, 1);
+
+    PathCache_Free(cache);
+}
+
+TEST_F(PathCacheTest, LRUEviction) {
+    PathCacheStats stats;
+    GrB_Matrix a = _new_product(16);
+    GrB_Matrix b = _new_product(16);
+    GrB_Matrix c = _new_product(16);
+    size_t size = _product_size(a);
+
+    // Cache fits two products.
+    PathCache *cache = PathCache_New(size * 2);
+    PathCache_Release(cache, PathCache_Put(cache, "A", 0, a));
+    PathCache_Release(cache, PathCache_Put(cache, "B", 0, b));
+
+    // Use A, making B least recently used.
+    PathCache_Release(cache, PathCache_Get(cache, "A", 0));
+
+    // Referenced entries are evicted but kept alive until released.
+    PathCacheEntry *entry = PathCache_Get(cache, "B", 0);
+    PathCache_Release(cache, PathCache_Get(cache, "A", 0));
+    PathCache_Release(cache, PathCache_Put(cache, "C", 0, c));
+    ASSERT_TRUE(PathCache_Get(cache, "B", 0) == NULL);
+    GrB_Index nvals;
+    ASSERT_EQ(GrB_Matrix_nvals(&nvals, PathCacheEntry_Product(entry)), GrB_SUCCESS);
+    ASSERT_EQ(nvals, 16);
+    PathCache_Release(cache, entry);
+
+    entry = PathCache_Get(cache, "A", 0);
+    ASSERT_TRUE(entry != NULL);
+    PathCache_Release(cache, entry);
+    entry = PathCache_Get(cache, "C", 0);
+    ASSERT_TRUE(entry != NULL);
+    PathCache_Release(cache, entry);
+
+    PathCache_GetStats(cache, &stats);
+    ASSERT_EQ(stats.entries, 2);
+    ASSERT_EQ(stats.evictions, 1);
+
+    // Products larger than the cap are rejected.
+    GrB_Matrix large = _new_product(1024);
+    ASSERT_TRUE(PathCache_Put(cache, "L", 0, large) == NULL);
+    GrB_Matrix_free(&large);
+
+    PathCache_Free(cache);
+}
+
+TEST_F(PathCacheTest, SharedAcrossExpressions) {
+    size_t node_count = 64;
+    Graph *g = Graph_New(node_count, node_count);
+    Graph_AddRelationType(g);
+    Graph_AllocateNodes(g, node_count);
+    Node n;
+    Edge e;
+    for(size_t i = 0; i < node_count; i++) Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+    for(size_t i = 0; i < node_count; i++) Graph_ConnectNodes(g, i, (i + 1) % node_count, 0, &e);
+
+    PathCacheStats stats;
+    PathCache *cache = PathCache_New(1 << 20);
+    GrB_Index dim = Graph_RequiredMatrixDim(g);
+    GrB_Matrix F;
+    GrB_Matrix res;
+    GrB_Matrix_new(&F, GrB_BOOL, dim, 1);
+    GrB_Matrix_new(&res, GrB_BOOL, dim, 1);
+    GrB_Matrix_setElement_BOOL(F, true, 0, 0);
+
+    // First query computes the product after a few multiplications.
+    AlgebraicExpression *exp = _two_hop_expression(g, cache);
+    for(int i = 0; i < 8; i++) AlgebraicExpression_MultiplyRight(exp, F, res);
+    ASSERT_TRUE(exp->cacheEntry != NULL);
+    AlgebraicExpression_Free(exp);
+
+    PathCache_GetStats(cache, &stats);
+    ASSERT_EQ(stats.entries, 1);
+    ASSERT_EQ(stats.misses, 1);
+
+    // Second query is served from the cache right away.
+    exp = _two_hop_expression(g, cache);
+    AlgebraicExpression_MultiplyRight(exp, F, res);
+    ASSERT_TRUE(exp->cacheEntry != NULL);
+    bool reached = false;
+    ASSERT_EQ(GrB_Matrix_extractElement_BOOL(&reached, res, 2, 0), GrB_SUCCESS);
+    ASSERT_TRUE(reached);
+    AlgebraicExpression_Free(exp);
+
+    PathCache_GetStats(cache, &stats);
+    ASSERT_EQ(stats.hits, 1);
+
+    // Connecting nodes invalidates the product.
+    uint64_t version = Graph_Version(g);
+    Graph_ConnectNodes(g, 0, 5, 0, &e);
+    ASSERT_GT(Graph_Version(g), version);
+
+    exp = _two_hop_expression(g, cache);
+    AlgebraicExpression_MultiplyRight(exp, F, res);
+    ASSERT_TRUE(exp->cacheEntry == NULL);
+    AlgebraicExpression_Free(exp);
+
+    PathCache_GetStats(cache, &stats);
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 2);
+    ASSERT_EQ(stats.entries, 0);
+
+    GrB_Matrix_free(&F);
+    GrB_Matrix_free(&res);
+    PathCache_Free(cache);
+    Graph_Free(g);
+}
@@ -0,0 +1,186 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "../../src/graph/graph.h"
+#include "../../src/graph/entities/property_store.h"
+#include "../../src/util/simple_timer.h"
+#include "../../src/util/rmalloc.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class PropertyStoreTest : public ::testing::Test
+{
+  protected:
+    static void SetUpTestCase()
+    {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+        GxB_Global_Option_set(GxB_FORMAT, GxB_BY_COL); // all matrices in CSC format
+        GxB_Global_Option_set(GxB_HYPER, GxB_NEVER_HYPER); // matrices are never hypersparse
+    }
+
+    static void TearDownTestCase()
+    {
+        GrB_finalize();
+    }
+};
+
+// Populates a graph with node_count labeled nodes,
+// each holding attr_count numeric attributes.
+static Graph *_BuildGraph(size_t node_count, int attr_count, bool columnar)
+{
+    Node n;
+    Graph *g = Graph_New(node_count, node_count);
+    if(columnar) Graph_EnableColumnarProperties(g);
+    int label = Graph_AddLabel(g);
+
+    for(size_t i = 0; i < node_count; i++) {
+        Graph_CreateNode(g, label, &n);
+        for(Attribute_ID a = 0; a < attr_count; a++) {
+            GraphEntity_AddProperty((GraphEntity*)&n, a, SI_DoubleVal(i + a));
+        }
+    }
+
+    return g;
+}
+
+// Scan all nodes, counting those for which attr > threshold.
+static size_t _ScanFilter(const Graph *g, Attribute_ID attr, double threshold)
+{
+    Node n;
+    size_t count = 0;
+    Entity *en;
+    DataBlockIterator *it = Graph_ScanNodes(g);
+    while((en = (Entity*)DataBlockIterator_Next(it))) {
+        n.entity = en;
+        SIValue *v = GraphEntity_GetProperty((GraphEntity*)&n, attr);
+        if(v != PROPERTY_NOTFOUND && v->doubleval > threshold) count++;
+    }
+    DataBlockIterator_Free(it);
+    return count;
+}
+
+TEST_F(PropertyStoreTest, SetGetRemove)
+{
+    PropertyStore *store = PropertyStore_New();
+
+    // Empty store.
+    ASSERT_EQ(PropertyStore_ColumnCount(store), 0);
+    ASSERT_EQ(PropertyStore_Get(store, 0, 0), PROPERTY_NOTFOUND);
+
+    // Set attribute 3 of entity 5, columns 0-2 remain empty.
+    SIValue *v = PropertyStore_Set(store, 3, 5, SI_LongVal(7));
+    ASSERT_EQ(v->longval, 7);
+    ASSERT_EQ(PropertyStore_ColumnCount(store), 4);
+    ASSERT_EQ(PropertyStore_Get(store, 3, 5)->longval, 7);
+    ASSERT_EQ(PropertyStore_Get(store, 3, 4), PROPERTY_NOTFOUND);
+    ASSERT_EQ(PropertyStore_Get(store, 0, 5), PROPERTY_NOTFOUND);
+
+    // Entity far beyond column's initial capacity.
+    EntityID far = 100000;
+    PropertyStore_Set(store, 3, far, SI_ConstStringVal((char*)"far"));
+    ASSERT_STREQ(PropertyStore_Get(store, 3, far)->stringval, "far");
+    ASSERT_EQ(PropertyStore_Get(store, 3, 5)->longval, 7);
+
+    // Removing an entity clears all of its attributes.
+    PropertyStore_Set(store, 1, 5, SI_BoolVal(true));
+    PropertyStore_RemoveEntity(store, 5);
+    ASSERT_EQ(PropertyStore_Get(store, 1, 5), PROPERTY_NOTFOUND);
+    ASSERT_EQ(PropertyStore_Get(store, 3, 5), PROPERTY_NOTFOUND);
+    ASSERT_STREQ(PropertyStore_Get(store, 3, far)->stringval, "far");
+
+    PropertyStore_Free(store);
+}
+
+TEST_F(PropertyStoreTest, ColumnarGraph)
+{
+    Node n;
+    Edge e;
+    Graph *g = Graph_New(16, 16);
+    Graph_EnableColumnarProperties(g);
+    int label = Graph_AddLabel(g);
+    int relation = Graph_AddRelationType(g);
+
+    // Labeled nodes are backed by store, unlabeled nodes hold their own properties.
+    Graph_CreateNode(g, label, &n);
+    ASSERT_TRUE(n.entity->store != NULL);
+    GraphEntity_AddProperty((GraphEntity*)&n, 0, SI_LongVal(1));
+    GraphEntity_AddProperty((GraphEntity*)&n, 2, SI_LongVal(3));
+    ASSERT_EQ(ENTITY_PROP_COUNT(&n), 2);
+    ASSERT_TRUE(ENTITY_PROPS(&n) == NULL);
+    ASSERT_EQ(GraphEntity_GetProperty((GraphEntity*)&n, 2)->longval, 3);
+    ASSERT_EQ(GraphEntity_GetProperty((GraphEntity*)&n, 1), PROPERTY_NOTFOUND);
+
+    GraphEntity_SetProperty((GraphEntity*)&n, 2, SI_LongVal(4));
+    ASSERT_EQ(GraphEntity_GetProperty((GraphEntity*)&n, 2)->longval, 4);
+
+    // Adding an existing attribute replaces its value.
+    GraphEntity_AddProperty((GraphEntity*)&n, 2, SI_LongVal(5));
+    ASSERT_EQ(ENTITY_PROP_COUNT(&n), 2);
+    ASSERT_EQ(GraphEntity_GetProperty((GraphEntity*)&n, 2)->longval, 5);
+
+    Node m;
+    Graph_CreateNode(g, GRAPH_NO_LABEL, &m);
+    ASSERT_TRUE(m.entity->store == NULL);
+    GraphEntity_AddProperty((GraphEntity*)&m, 0, SI_LongVal(5));
+    ASSERT_EQ(GraphEntity_GetProperty((GraphEntity*)&m, 0)->longval, 5);
+    GraphEntity_AddProperty((GraphEntity*)&m, 0, SI_LongVal(6));
+    ASSERT_EQ(ENTITY_PROP_COUNT(&m), 1);
+    ASSERT_EQ(GraphEntity_GetProperty((GraphEntity*)&m, 0)->longval, 6);
+
+    // Edges are backed by their relation store.
+    Graph_ConnectNodes(g, 0, 1, relation, &e);
+    ASSERT_TRUE(e.entity->store != NULL);
+    GraphEntity_AddProperty((GraphEntity*)&e, 0, SI_DoubleVal(0.5));
+    ASSERT_EQ(GraphEntity_GetProperty((GraphEntity*)&e, 0)->doubleval, 0.5);
+
+    // Deleted node's attributes are not visible to a node reusing its ID.
+    Graph_DeleteNode(g, &n);
+    Graph_CreateNode(g, label, &n);
+    ASSERT_EQ(ENTITY_GET_ID(&n), 0);
+    ASSERT_EQ(GraphEntity_GetProperty((GraphEntity*)&n, 0), PROPERTY_NOTFOUND);
+
+    Graph_Free(g);
+}
+
+TEST_F(PropertyStoreTest, ScanFilterBenchmark)
+{
+    // Compare scan + filter throughput of per-entity and columnar layouts.
+    size_t node_count = 200000;
+    int attr_count = 8;
+    Attribute_ID attr = attr_count - 1;
+    double threshold = node_count / 2;
+    double tic[2];
+
+    Graph *g = _BuildGraph(node_count, attr_count, false);
+    simple_tic(tic);
+    size_t entity_count = _ScanFilter(g, attr, threshold);
+    double entity_time = simple_toc(tic);
+    Graph_Free(g);
+
+    g = _BuildGraph(node_count, attr_count, true);
+    simple_tic(tic);
+    size_t columnar_count = _ScanFilter(g, attr, threshold);
+    double columnar_time = simple_toc(tic);
+    Graph_Free(g);
+
+    ASSERT_EQ(entity_count, columnar_count);
+    printf("Scan + filter %zu nodes, entity layout: %.6f sec, columnar layout: %.6f sec\n",
+           node_count, entity_time, columnar_time);
+}
@@ -0,0 +1,285 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "plan_test.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdio.h>
+#include "../../src/util/simple_timer.h"
+#include "../../src/execution_plan/record_batch.h"
+#include "../../src/execution_plan/ops/op_filter.h"
+#include "../../src/execution_plan/ops/op_project.h"
+#include "../../src/execution_plan/ops/op_node_by_label_scan.h"
+#include "../../src/execution_plan/ops/op_conditional_traverse.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#define PERSON_COUNT 500000
+#define KNOWS_COUNT 3000   // Persons [0, KNOWS_COUNT) know their successor.
+
+class RecordBatchTest: public PlanTest {
+    protected:
+
+    static void SetUpTestCase() {
+        PlanTest::SetUpTestCase();
+        _build_graph_context();
+    }
+
+    /* Graph context holding PERSON_COUNT Person nodes,
+     * each with an age attribute in range [0, PERSON_COUNT),
+     * even persons below KNOWS_COUNT also like their successor. */
+    static void _build_graph_context() {
+        GraphContext *gc = _new_graph_context(PERSON_COUNT, PERSON_COUNT);
+
+        Schema *s = GraphContext_AddSchema(gc, "Person", SCHEMA_NODE);
+        Attribute_ID age = Schema_AddAttribute(s, SCHEMA_NODE, "age");
+
+        Node n;
+        Graph_SetMatrixPolicy(gc->g, RESIZE_TO_CAPACITY);
+        Graph_AllocateNodes(gc->g, PERSON_COUNT);
+        for(int i = 0; i < PERSON_COUNT; i++) {
+            Graph_CreateNode(gc->g, s->id, &n);
+            GraphEntity_AddProperty((GraphEntity*)&n, age, SI_LongVal(i));
+        }
+
+        Edge e;
+        Schema *knows = GraphContext_AddSchema(gc, "knows", SCHEMA_EDGE);
+        Schema *likes = GraphContext_AddSchema(gc, "likes", SCHEMA_EDGE);
+        for(int i = 0; i < KNOWS_COUNT; i++) {
+            Graph_ConnectNodes(gc->g, i, i + 1, knows->id, &e);
+            if(i % 2 == 0) Graph_ConnectNodes(gc->g, i, i + 1, likes->id, &e);
+        }
+        Graph_SetMatrixPolicy(gc->g, SYNC_AND_MINIMIZE_SPACE);
+        Graph_ApplyAllPending(gc->g);
+    }
+
+    AST* _build_ast(const char *query) {
+        char *errMsg;
+        AST *ast = ParseQuery(query, strlen(query), &errMsg);
+        AST_NameAnonymousNodes(ast);
+        pthread_setspecific(_tlsASTKey, ast);
+        return ast;
+    }
+
+    static void _add_child(OpBase *parent, OpBase *child) {
+        parent->children = (OpBase**)malloc(sizeof(OpBase*));
+        parent->children[0] = child;
+        parent->childCount = 1;
+        child->parent = parent;
+    }
+
+    /* Project builds its expressions lazily, replying with the
+     * result-set header which requires a Redis context,
+     * as such expressions are built upfront. */
+    static OpBase* _build_project(AST *ast) {
+        OpBase *project = NewProjectOp(NULL);
+        uint expCount = array_len(ast->returnNode->returnElements);
+        Project *p = (Project*)project;
+        p->projectedRecordLen = expCount;
+        p->expressions = (AR_ExpNode**)array_newlen(AR_ExpNode*, expCount);
+        for(uint i = 0; i < expCount; i++) {
+            AST_ArithmeticExpressionNode *exp = ast->returnNode->returnElements[i]->exp;
+            p->expressions[i] = AR_EXP_BuildFromAST(ast, exp);
+        }
+        return project;
+    }
+
+    // Builds label scan -> filter -> project.
+    OpBase* _build_plan(AST *ast, Node **n, FT_FilterNode **tree) {
+        GraphContext *gc = GraphContext_GetFromLTS();
+        *n = Node_New("Person", "n");
+        *tree = BuildFiltersTree(ast, ast->whereNode->filters);
+
+        OpBase *scan = NewNodeByLabelScanOp(gc, *n);
+        OpBase *filter = NewFilterOp(*tree);
+        OpBase *project = _build_project(ast);
+        _add_child(filter, scan);
+        _add_child(project, filter);
+        return project;
+    }
+
+    void _free_plan(OpBase *project, Node *n, FT_FilterNode *tree) {
+        OpBase *filter = project->children[0];
+        OpBase *scan = filter->children[0];
+        OpBase_Free(scan);
+        OpBase_Free(filter);
+        OpBase_Free(project);
+        FilterTree_Free(tree);
+        Node_Free(n);
+    }
+};
+
+TEST_F(RecordBatchTest, SlotReuse) {
+    RecordBatch *batch = RecordBatch_New(4);
+    ASSERT_EQ(batch->len, 0);
+    ASSERT_EQ(batch->cap, 4);
+
+    // Slot of matching length is recycled and cleared.
+    Record r = RecordBatch_Slot(batch, 0, 3);
+    Record_AddScalar(r, 1, SI_DuplicateStringVal("recycled"));
+    ASSERT_EQ(RecordBatch_Slot(batch, 0, 3), r);
+    ASSERT_EQ(Record_GetType(r, 1), REC_TYPE_UNKNOWN);
+
+    // Slot of a different length is replaced.
+    r = RecordBatch_Slot(batch, 0, 5);
+    ASSERT_EQ(Record_length(r), 5);
+
+    Record s = Record_New(2);
+    RecordBatch_Set(batch, 1, s);
+    RecordBatch_Swap(batch, 0, 1);
+    ASSERT_EQ(batch->records[0], s);
+    ASSERT_EQ(batch->records[1], r);
+
+    RecordBatch_Free(batch);
+}
+
+TEST_F(RecordBatchTest, BatchMatchesSingleRecord) {
+    AST *ast = _build_ast("MATCH (n:Person) WHERE n.age >= 1000 AND n.age < 2000 RETURN n.age, n.age * 2");
+    Node *n;
+    FT_FilterNode *tree;
+
+    // Single record path.
+    OpBase *plan = _build_plan(ast, &n, &tree);
+    int64_t expected[1000];
+    int single_count = 0;
+    Record r;
+    while((r = plan->consume(plan))) {
+        ASSERT_LT(single_count, 1000);
+        expected[single_count++] = Record_GetScalar(r, 0).longval;
+        Record_Free(r);
+    }
+    ASSERT_EQ(single_count, 1000);
+    _free_plan(plan, n, tree);
+
+    // Batch path, records are produced in the same order.
+    plan = _build_plan(ast, &n, &tree);
+    int batch_count = 0;
+    RecordBatch *batch;
+    while((batch = OpBase_ConsumeBatch(plan))) {
+        ASSERT_GT(batch->len, 0);
+        ASSERT_LE(batch->len, RECORD_BATCH_CAP);
+        for(uint i = 0; i < batch->len; i++) {
+            ASSERT_LT(batch_count, single_count);
+            ASSERT_EQ(Record_GetScalar(batch->records[i], 0).longval, expected[batch_count]);
+            ASSERT_EQ(Record_GetScalar(batch->records[i], 1).longval, expected[batch_count] * 2);
+            batch_count++;
+        }
+    }
+    ASSERT_EQ(batch_count, single_count);
+    _free_plan(plan, n, tree);
+
+    AST_Free(ast);
+}
+
+TEST_F(RecordBatchTest, TraverseBatchMatchesSingleRecord) {
+    AST *ast = _build_ast("MATCH (n:Person)-[e:knows|:likes]->(m:Person) RETURN n.age, m.age, e");
+    GraphContext *gc = GraphContext_GetFromLTS();
+    int expected_count = KNOWS_COUNT + KNOWS_COUNT / 2;
+    int64_t *expected = (int64_t*)malloc(sizeof(int64_t) * expected_count);
+    int single_count = 0;
+    int batch_count = 0;
+
+    for(int batched = 0; batched < 2; batched++) {
+        // Builds label scan -> conditional traverse -> project.
+        Vector *pattern;
+        size_t exp_count = 0;
+        QueryGraph *q = QueryGraph_New(2, 1);
+        BuildQueryGraph(gc, q, ast->matchNode->_mergedPatterns);
+        Vector_Get(ast->matchNode->patterns, 0, &pattern);
+        AlgebraicExpression **exps = AlgebraicExpression_From_Query(ast, pattern, q, &exp_count);
+        ASSERT_EQ(exp_count, 1);
+        AlgebraicExpression *exp = exps[0];
+        // Source label matrix is replaced by label scan.
+        AlgebraicExpression_RemoveTerm(exp, exp->operand_count-1, NULL);
+
+        OpBase *scan = NewNodeByLabelScanOp(gc, exp->src_node);
+        OpBase *traverse = NewCondTraverseOp(gc->g, exp);
+        OpBase *project = _build_project(ast);
+        _add_child(traverse, scan);
+        _add_child(project, traverse);
+
+        if(!batched) {
+            Record r;
+            while((r = project->consume(project))) {
+                ASSERT_LT(single_count, expected_count);
+                int64_t src = Record_GetScalar(r, 0).longval;
+                ASSERT_EQ(Record_GetScalar(r, 1).longval, src + 1);
+                expected[single_count++] = src;
+                Record_Free(r);
+            }
+        } else {
+            RecordBatch *batch;
+            while((batch = OpBase_ConsumeBatch(project))) {
+                for(uint i = 0; i < batch->len; i++) {
+                    ASSERT_LT(batch_count, expected_count);
+                    int64_t src = Record_GetScalar(batch->records[i], 0).longval;
+                    ASSERT_EQ(src, expected[batch_count]);
+                    ASSERT_EQ(Record_GetScalar(batch->records[i], 1).longval, src + 1);
+                    batch_count++;
+                }
+            }
+        }
+
+        // Traversal width grows while the scan fills entire batches.
+        CondTraverse *ct = (CondTraverse*)traverse;
+        ASSERT_GT(ct->recordsCap, 16);
+        ASSERT_LE(ct->recordsCap, ct->recordsMax);
+
+        OpBase_Free(scan);
+        OpBase_Free(traverse);
+        OpBase_Free(project);
+        QueryGraph_Free(q);
+        free(exps);
+    }
+
+    // Each edge forms a record.
+    ASSERT_EQ(single_count, expected_count);
+    ASSERT_EQ(batch_count, expected_count);
+
+    free(expected);
+    AST_Free(ast);
+}
+
+TEST_F(RecordBatchTest, ScanFilterProjectBenchmark) {
+    // Compare label scan + filter + project throughput
+    // of the single record and batch execution paths.
+    AST *ast = _build_ast("MATCH (n:Person) WHERE n.age > 1000 RETURN n.age, n.age + 1");
+    Node *n;
+    FT_FilterNode *tree;
+    double tic[2];
+
+    OpBase *plan = _build_plan(ast, &n, &tree);
+    size_t single_count = 0;
+    Record r;
+    simple_tic(tic);
+    while((r = plan->consume(plan))) {
+        single_count++;
+        Record_Free(r);
+    }
+    double single_time = simple_toc(tic);
+    _free_plan(plan, n, tree);
+
+    plan = _build_plan(ast, &n, &tree);
+    size_t batch_count = 0;
+    RecordBatch *batch;
+    simple_tic(tic);
+    while((batch = OpBase_ConsumeBatch(plan))) batch_count += batch->len;
+    double batch_time = simple_toc(tic);
+    _free_plan(plan, n, tree);
+
+    ASSERT_EQ(single_count, PERSON_COUNT - 1001);
+    ASSERT_EQ(batch_count, single_count);
+    printf("Scan + filter + project %d nodes, single record: %.6f sec (%.0f rows/sec), batch: %.6f sec (%.0f rows/sec)\n",
+           PERSON_COUNT, single_time, single_count / single_time, batch_time, batch_count / batch_time);
+
+    AST_Free(ast);
+}
@@ -0,0 +1,183 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "plan_test.h"
+
+#define PERSON_COUNT 10
+#define CITY_COUNT 2
+
+class ReduceCountTest: public PlanTest {
+    protected:
+
+    static void SetUpTestCase() {
+        PlanTest::SetUpTestCase();
+        _build_graph_context();
+    }
+
+    /* Graph context holding PERSON_COUNT persons and CITY_COUNT cities,
+     * every person knows its successor and visited every city. */
+    static void _build_graph_context() {
+        GraphContext *gc = _new_graph_context(PERSON_COUNT + CITY_COUNT, PERSON_COUNT);
+
+        Schema *person = GraphContext_AddSchema(gc, "Person", SCHEMA_NODE);
+        Schema *city = GraphContext_AddSchema(gc, "City", SCHEMA_NODE);
+        Schema *visited = GraphContext_AddSchema(gc, "visited", SCHEMA_EDGE);
+        Schema *knows = GraphContext_AddSchema(gc, "knows", SCHEMA_EDGE);
+
+        Node n;
+        Edge e;
+        Graph_AllocateNodes(gc->g, PERSON_COUNT + CITY_COUNT);
+        for(int i = 0; i < PERSON_COUNT; i++) Graph_CreateNode(gc->g, person->id, &n);
+        for(int i = 0; i < CITY_COUNT; i++) Graph_CreateNode(gc->g, city->id, &n);
+        for(int i = 0; i < PERSON_COUNT; i++) {
+            for(int j = 0; j < CITY_COUNT; j++) {
+                Graph_ConnectNodes(gc->g, i, PERSON_COUNT + j, visited->id, &e);
+            }
+            if(i + 1 < PERSON_COUNT) Graph_ConnectNodes(gc->g, i, i + 1, knows->id, &e);
+        }
+    }
+
+    /* Validates query is reduced to a single entity count operation
+     * producing expected count. */
+    static void _validate_count(const char *query, double expected) {
+        ExecutionPlan *plan = _build_plan(query);
+        ASSERT_EQ(plan->root->childCount, 1);
+        OpBase *op = plan->root->children[0];
+        ASSERT_EQ(op->type, OPType_ENTITY_COUNT);
+        ASSERT_EQ(op->childCount, 0);
+
+        // Plan has no result-set to populate.
+        ((EntityCount*)op)->init = true;
+        Record r = op->consume(op);
+        ASSERT_TRUE(r != NULL);
+        ASSERT_EQ(Record_GetScalar(r, 0).doubleval, expected);
+        Record_Free(r);
+        ASSERT_TRUE(op->consume(op) == NULL);
+
+        _free_plan(plan);
+    }
+};
+
+TEST_F(ReduceCountTest, CountNodes) {
+    _validate_count("MATCH (n:Person) RETURN count(n)", PERSON_COUNT);
+    _validate_count("MATCH (n:City) RETURN count(*)", CITY_COUNT);
+    _validate_count("MATCH (n:Missing) RETURN count(n)", 0);
+    _validate_count("MATCH (n) RETURN count(n)", PERSON_COUNT + CITY_COUNT);
+}
+
+TEST_F(ReduceCountTest, CountEdges) {
+    _validate_count("MATCH ()-[r:knows]->() RETURN count(r)", PERSON_COUNT - 1);
+    _validate_count("MATCH ()<-[r:visited]-() RETURN count(r)", PERSON_COUNT * CITY_COUNT);
+    _validate_count("MATCH ()-[r]->() RETURN count(r)", PERSON_COUNT * CITY_COUNT + PERSON_COUNT - 1);
+    _validate_count("MATCH (a)-[:visited]->(b) RETURN count(a), count(*)", PERSON_COUNT * CITY_COUNT);
+}
+
+TEST_F(ReduceCountTest, GroupedCount) {
+    // Every person visited every city, knows its successor.
+    const char *query = "MATCH (a:Person)-[:visited]->(c) RETURN a, count(c)";
+    ExecutionPlan *plan = _build_plan(query);
+    OpBase *aggregate = plan->root->children[0];
+    ASSERT_EQ(aggregate->type, OPType_AGGREGATE);
+    OpBase *op = aggregate->children[0];
+    ASSERT_EQ(op->type, OPType_EXPAND_COUNT);
+    ASSERT_EQ(op->children[0]->type, OPType_NODE_BY_LABEL_SCAN);
+
+    // Each person is passed on once, along with its degree.
+    int countRecIdx = ((ExpandCount*)op)->countRecIdx;
+    int records = 0;
+    Record r;
+    while((r = op->consume(op))) {
+        ASSERT_EQ(Record_GetScalar(r, countRecIdx).longval, CITY_COUNT);
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(records, PERSON_COUNT);
+    _free_plan(plan);
+
+    // The last person knows no one.
+    plan = _build_plan("MATCH (a:Person)-[r:knows]->(b) RETURN a.name, count(r) ORDER BY a.name");
+    op = plan->root->children[0]->children[0]->children[0];
+    ASSERT_EQ(op->type, OPType_EXPAND_COUNT);
+    records = 0;
+    while((r = op->consume(op))) {
+        ASSERT_EQ(Record_GetScalar(r, ((ExpandCount*)op)->countRecIdx).longval, 1);
+        Record_Free(r);
+        records++;
+    }
+    ASSERT_EQ(records, PERSON_COUNT - 1);
+    _free_plan(plan);
+
+    // Untyped edges are counted through the adjacency matrix.
+    plan = _build_plan("MATCH (a:Person)-[r]->(b) RETURN a, count(r)");
+    op = plan->root->children[0]->children[0];
+    ASSERT_EQ(op->type, OPType_EXPAND_COUNT);
+    ASSERT_TRUE(((ExpandCount*)op)->countEdges);
+    int edges = 0;
+    while((r = op->consume(op))) {
+        edges += Record_GetScalar(r, ((ExpandCount*)op)->countRecIdx).longval;
+        Record_Free(r);
+    }
+    ASSERT_EQ(edges, PERSON_COUNT * CITY_COUNT + PERSON_COUNT - 1);
+    _free_plan(plan);
+
+    // Grouping by destination or ordering by it can't be reduced.
+    const char *queries[] = {
+        "MATCH (a:Person)-[:visited]->(c) RETURN c, count(a)",
+        "MATCH (a:Person)-[:visited]->(c) RETURN a, count(c) ORDER BY c.name",
+        "MATCH (a:Person)-[:visited]->(c) RETURN a, collect(c)",
+        "MATCH (a:Person)-[r:knows|:visited]->(c) RETURN a, count(r)",
+        NULL
+    };
+    for(int i = 0; queries[i]; i++) {
+        plan = _build_plan(queries[i]);
+        bool reduced = false;
+        for(op = plan->root; op; op = (op->childCount) ? op->children[0] : NULL) {
+            if(op->type == OPType_EXPAND_COUNT) reduced = true;
+        }
+        ASSERT_FALSE(reduced) << queries[i];
+        _free_plan(plan);
+    }
+}
+
+TEST_F(ReduceCountTest, NotReduced) {
+    const char *queries[] = {
+        "MATCH (n:Person) WHERE n.name = 'x' RETURN count(n)",
+        "MATCH (n:Person) RETURN n.name, count(n)",
+        "MATCH (n:Person) RETURN count(n.name)",
+        "MATCH (n:Person)-[:visited]->(c) RETURN count(n)",
+        "MATCH ()-[r:knows|:visited]->() RETURN count(r)",
+        "MATCH ()-[:knows*]->() RETURN count(*)",
+        "MATCH (n:Person) RETURN count(n) ORDER BY count(n)",
+        NULL
+    };
+
+    for(int i = 0; queries[i]; i++) {
+        ExecutionPlan *plan = _build_plan(queries[i]);
+        bool reduced = false;
+        for(OpBase *op = plan->root; op; op = (op->childCount) ? op->children[0] : NULL) {
+            if(op->type == OPType_ENTITY_COUNT) reduced = true;
+        }
+        ASSERT_FALSE(reduced) << queries[i];
+        _free_plan(plan);
+    }
+}
+
+TEST_F(ReduceCountTest, StarArgument) {
+    // Only count accepts *, regardless of case.
+    char *errMsg = NULL;
+    const char *query = "MATCH (n) RETURN COUNT(*)";
+    AST *ast = ParseQuery(query, strlen(query), &errMsg);
+    ASSERT_TRUE(ast != NULL);
+    ASSERT_TRUE(errMsg == NULL);
+    AST_Free(ast);
+
+    query = "MATCH (n) RETURN sum(*)";
+    ast = ParseQuery(query, strlen(query), &errMsg);
+    ASSERT_TRUE(ast == NULL);
+    ASSERT_TRUE(errMsg != NULL);
+    free(errMsg);
+}
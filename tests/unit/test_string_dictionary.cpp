@@ -0,0 +1,130 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../../src/value.h"
+#include "../../src/util/rmalloc.h"
+#include "../../src/util/string_dictionary.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class StringDictionaryTest: public ::testing::Test {
+  protected:
+    static void SetUpTestCase() {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+    }
+};
+
+TEST_F(StringDictionaryTest, Intern) {
+    bool hit;
+    StringDictionary *dict = StringDictionary_New();
+    ASSERT_EQ(StringDictionary_Count(dict), 0);
+    ASSERT_TRUE(StringDictionary_Lookup(dict, "US") == NULL);
+
+    // First occurrence introduces string.
+    char us[] = "US";
+    const char *a = StringDictionary_Intern(dict, us, &hit);
+    ASSERT_FALSE(hit);
+    ASSERT_STREQ(a, "US");
+    ASSERT_TRUE(a != us);
+
+    // Repeated strings share a single copy.
+    const char *b = StringDictionary_Intern(dict, "US", &hit);
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(a, b);
+    ASSERT_EQ(StringDictionary_Lookup(dict, "US"), a);
+
+    const char *c = StringDictionary_Intern(dict, "UK", &hit);
+    ASSERT_FALSE(hit);
+    ASSERT_NE(a, c);
+
+    // IDs are assigned in order of introduction.
+    ASSERT_EQ(StringDictionary_Count(dict), 2);
+    ASSERT_EQ(StringDictionary_GetID(a), 0);
+    ASSERT_EQ(StringDictionary_GetID(c), 1);
+    ASSERT_EQ(StringDictionary_GetString(dict, 1), c);
+
+    ASSERT_EQ(dict->hits, 1);
+    ASSERT_EQ(dict->misses, 2);
+
+    StringDictionary_Free(dict);
+}
+
+TEST_F(StringDictionaryTest, InternValue) {
+    bool hit;
+    uint32_t cardinality = 0;
+    StringDictionary *dict = StringDictionary_New();
+
+    // Non string values are left untouched.
+    SIValue v = StringDictionary_InternValue(dict, SI_DoubleVal(1.5), &cardinality, &hit);
+    ASSERT_FALSE(hit);
+    ASSERT_EQ(v.type, T_DOUBLE);
+    ASSERT_EQ(StringDictionary_Count(dict), 0);
+
+    // Owned strings are freed and replaced by a constant reference.
+    SIValue a = StringDictionary_InternValue(dict, SI_DuplicateStringVal("active"), &cardinality, &hit);
+    ASSERT_FALSE(hit);
+    ASSERT_EQ(a.type, T_CONSTSTRING);
+    SIValue b = StringDictionary_InternValue(dict, SI_ConstStringVal((char*)"active"), &cardinality, &hit);
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(a.stringval, b.stringval);
+
+    // Interned values compare equal by address.
+    ASSERT_EQ(SIValue_Compare(a, b), 0);
+
+    StringDictionary_Free(dict);
+}
+
+TEST_F(StringDictionaryTest, AttributeCap) {
+    bool hit;
+    char buf[32];
+    uint32_t full = STRING_DICTIONARY_ATTRIBUTE_CAP;
+    uint32_t cardinality = 0;
+    StringDictionary *dict = StringDictionary_New();
+
+    // Introducing a string counts against the attribute, reusing one doesn't.
+    SIValue a = StringDictionary_InternValue(dict, SI_ConstStringVal((char*)"a"), &cardinality, &hit);
+    ASSERT_EQ(a.type, T_CONSTSTRING);
+    ASSERT_EQ(cardinality, 1);
+    StringDictionary_InternValue(dict, SI_ConstStringVal((char*)"a"), &cardinality, &hit);
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(cardinality, 1);
+
+    // Attribute at its cap only shares existing strings.
+    SIValue b = StringDictionary_InternValue(dict, SI_ConstStringVal((char*)"a"), &full, &hit);
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(b.stringval, a.stringval);
+
+    // New strings are kept as owned copies.
+    for(int i = 0; i < 10; i++) {
+        sprintf(buf, "value_%d", i);
+        SIValue v = StringDictionary_InternValue(dict, SI_ConstStringVal(buf), &full, &hit);
+        ASSERT_FALSE(hit);
+        ASSERT_EQ(v.type, T_STRING);
+        ASSERT_NE(v.stringval, buf);
+        ASSERT_STREQ(v.stringval, buf);
+        SIValue_Free(&v);
+
+        SIValue owned = SI_DuplicateStringVal(buf);
+        char *str = owned.stringval;
+        v = StringDictionary_InternValue(dict, owned, &full, &hit);
+        ASSERT_EQ(v.stringval, str);
+        SIValue_Free(&v);
+    }
+    ASSERT_EQ(StringDictionary_Count(dict), 1);
+    ASSERT_EQ(full, STRING_DICTIONARY_ATTRIBUTE_CAP);
+
+    StringDictionary_Free(dict);
+}
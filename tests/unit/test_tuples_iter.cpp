@@ -374,4 +374,118 @@ TEST_F(TuplesTest, ColumnIteratorEmptyMatrixTest) {
 
     GxB_MatrixTupleIter_free(iter);
     GrB_Matrix_free(&A);
-}
\ No newline at end of file
+}
+TEST_F(TuplesTest, HypersparseMatrixIteratorTest) {
+    //--------------------------------------------------------------------------
+    // Build a 1024X1024 hypersparse matrix with entries in a few columns
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 1024;
+    GrB_Index nvals = 3;
+    GrB_Index I[3] = {5, 1, 7};
+    GrB_Index J[3] = {2, 500, 1000};
+    bool X[3] = {true, true, true};
+    GrB_Matrix A = CreateSquareNByNEmptyMatrix(n);
+    GxB_Matrix_Option_set(A, GxB_HYPER, GxB_ALWAYS_HYPER);
+    GrB_Matrix_build_BOOL(A, I, J, X, nvals, GrB_FIRST_BOOL);
+
+    bool hyper = false;
+    size_t size;
+    GxB_Matrix_MemoryUsage(A, &size, &hyper);
+    ASSERT_TRUE(hyper);
+
+    GrB_Index row;
+    GrB_Index col;
+    bool depleted = false;
+    GxB_MatrixTupleIter *iter;
+    GxB_MatrixTupleIter_new(&iter, A);
+
+    //--------------------------------------------------------------------------
+    // Scan entire matrix, columns are reported rather than vector indices
+    //--------------------------------------------------------------------------
+
+    for(int i = 0; i < nvals; i++) {
+      GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+      ASSERT_FALSE(depleted);
+      ASSERT_EQ(row, I[i]);
+      ASSERT_EQ(col, J[i]);
+    }
+    GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+    ASSERT_TRUE(depleted);
+
+    //--------------------------------------------------------------------------
+    // Scan a single populated column and a single empty column
+    //--------------------------------------------------------------------------
+
+    GxB_MatrixTupleIter_iterate_column(iter, 500);
+    GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+    ASSERT_FALSE(depleted);
+    ASSERT_EQ(row, 1);
+    ASSERT_EQ(col, 500);
+    GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+    ASSERT_TRUE(depleted);
+
+    GxB_MatrixTupleIter_iterate_column(iter, 501);
+    GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+    ASSERT_TRUE(depleted);
+
+    GxB_MatrixTupleIter_free(iter);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(TuplesTest, RangeIteratorTest) {
+    //--------------------------------------------------------------------------
+    // Build a 1024X1024 matrix with entries in a few columns
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 1024;
+    GrB_Index nvals = 4;
+    GrB_Index I[4] = {5, 1, 3, 7};
+    GrB_Index J[4] = {2, 500, 500, 1000};
+    bool X[4] = {true, true, true, true};
+
+    for(int hyper = 0; hyper < 2; hyper++) {
+      GrB_Matrix A = CreateSquareNByNEmptyMatrix(n);
+      GxB_Matrix_Option_set(A, GxB_HYPER, (hyper) ? GxB_ALWAYS_HYPER : GxB_NEVER_HYPER);
+      GrB_Matrix_build_BOOL(A, I, J, X, nvals, GrB_FIRST_BOOL);
+
+      GrB_Index row;
+      GrB_Index col;
+      bool depleted = false;
+      GxB_MatrixTupleIter *iter;
+      GxB_MatrixTupleIter_new(&iter, A);
+
+      //------------------------------------------------------------------------
+      // Scan columns [2, 1000), last column is excluded
+      //------------------------------------------------------------------------
+
+      GxB_MatrixTupleIter_iterate_range(iter, 2, 1000);
+      for(int i = 0; i < 3; i++) {
+        GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+        ASSERT_FALSE(depleted);
+        ASSERT_EQ(row, I[i]);
+        ASSERT_EQ(col, J[i]);
+      }
+      GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+      ASSERT_TRUE(depleted);
+
+      //------------------------------------------------------------------------
+      // Scan an empty range and a range exceeding matrix dimensions
+      //------------------------------------------------------------------------
+
+      GxB_MatrixTupleIter_iterate_range(iter, 3, 500);
+      GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+      ASSERT_TRUE(depleted);
+
+      GxB_MatrixTupleIter_iterate_range(iter, 501, 4096);
+      GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+      ASSERT_FALSE(depleted);
+      ASSERT_EQ(row, 7);
+      ASSERT_EQ(col, 1000);
+      GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+      ASSERT_TRUE(depleted);
+
+      GxB_MatrixTupleIter_free(iter);
+      GrB_Matrix_free(&A);
+    }
+}
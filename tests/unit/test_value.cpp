@@ -46,6 +46,34 @@ TEST(ValueTest, TestNumerics) {
     SIValue_Free(&v);
 }
 
+TEST(ValueTest, TestInt64Compare) {
+    // Integers above 2^53 differ only beyond double precision.
+    SIValue a = SI_LongVal(9007199254740993LL);
+    SIValue b = SI_LongVal(9007199254740992LL);
+    ASSERT_GT(SIValue_Compare(a, b), 0);
+    ASSERT_LT(SIValue_Compare(b, a), 0);
+    ASSERT_EQ(SIValue_Compare(a, a), 0);
+
+    // Mixed numeric types are compared as doubles.
+    ASSERT_EQ(SIValue_Compare(SI_LongVal(3), SI_DoubleVal(3)), 0);
+    ASSERT_LT(SIValue_Compare(SI_LongVal(3), SI_DoubleVal(3.5)), 0);
+}
+
+TEST(ValueTest, TestHashCode) {
+    // Values which compare as equal share a hash.
+    ASSERT_EQ(SIValue_HashCode(SI_LongVal(3)), SIValue_HashCode(SI_DoubleVal(3)));
+    ASSERT_EQ(SIValue_HashCode(SI_DoubleVal(0.0)), SIValue_HashCode(SI_DoubleVal(-0.0)));
+    ASSERT_NE(SIValue_HashCode(SI_LongVal(3)), SIValue_HashCode(SI_LongVal(4)));
+
+    char str[] = "hash";
+    SIValue owned = SI_DuplicateStringVal(str);
+    ASSERT_EQ(SIValue_HashCode(owned), SIValue_HashCode(SI_ConstStringVal(str)));
+    ASSERT_NE(SIValue_HashCode(owned), SIValue_HashCode(SI_ConstStringVal((char*)"hasH")));
+    SIValue_Free(&owned);
+
+    ASSERT_EQ(SIValue_HashCode(SI_NullVal()), SIValue_HashCode(SI_NullVal()));
+}
+
 TEST(ValueTest, TestStrings) {
     Alloc_Reset();
     SIValue v;